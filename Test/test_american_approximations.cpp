@@ -0,0 +1,75 @@
+#include <catch2/catch_all.hpp>
+
+#include "../include/models/BaroneAdesiWhaleyModel.hpp"
+#include "../include/models/BjerksundStenslandModel.hpp"
+#include "../include/models/AmericanOptionPricer.hpp"
+#include "../include/models/BlackScholesModel.hpp"
+#include "../include/Factory/PricingModelFactory.hpp"
+#include "../include/util/MathHelpers.hpp"
+#include "../include/domain/OptionBatch.hpp"
+
+#include <cmath>
+#include <vector>
+
+TEST_CASE("Loi normale bivariée", "[MathHelpers]") {
+    const double pi = 3.141592653589793;
+    for (const double rho : {-0.99, -0.5, 0.0, 0.3, 0.8, 0.95}) {
+        REQUIRE(bivariateNormcdf(0.0, 0.0, rho) == Catch::Approx(0.25 + std::asin(rho) / (2.0 * pi)).margin(1e-7));
+    }
+    // Corrélation nulle : produit des marginales ; bornes
+    REQUIRE(bivariateNormcdf(1.0, -0.5, 0.0) == Catch::Approx(normcdf(1.0) * normcdf(-0.5)).margin(1e-7));
+    REQUIRE(bivariateNormcdf(8.0, 0.7, 0.6) == Catch::Approx(normcdf(0.7)).margin(1e-7));
+}
+
+TEST_CASE("Approximations américaines proches du PDE dans la zone de confiance", "[AmericanApproximation]") {
+    TrustedRegion approximationOnly;
+    approximationOnly.fallbackToPde = false;
+    const BaroneAdesiWhaleyModel baw(approximationOnly);
+    const BjerksundStenslandModel bjerksund(approximationOnly);
+    const AmericanOptionPricer pde(400, 0.0005);
+
+    for (const double T : {0.25, 1.0}) {
+        for (const double sigma : {0.1, 0.3}) {
+            for (const double r : {0.02, 0.08}) {
+                for (const double S : {80.0, 100.0, 120.0}) {
+                    const OptionSpec put{S, 100.0, r, sigma, T, OptionType::Put};
+                    REQUIRE(baw.isTrusted(put));
+                    const double reference = pde.calculatePrice(put);
+                    REQUIRE(baw.calculatePrice(put) == Catch::Approx(reference).margin(0.1));
+                    REQUIRE(bjerksund.calculatePrice(put) == Catch::Approx(reference).margin(0.1));
+                    // Bjerksund-Stensland : borne inférieure (stratégie d'exercice sous-optimale)
+                    REQUIRE(bjerksund.calculatePrice(put) <= reference + 2e-3);
+                    REQUIRE(baw.calculatePrice(put) >= std::max(100.0 - S, 0.0));
+                }
+            }
+        }
+    }
+
+    // Sans dividende, le call américain vaut le call européen
+    BlackScholesModel bs;
+    const OptionSpec call{110.0, 100.0, 0.05, 0.25, 1.0, OptionType::Call};
+    REQUIRE(baw.calculatePrice(call) == Catch::Approx(bs.calculatePrice(call)).margin(1e-10));
+    REQUIRE(bjerksund.calculatePrice(call) == Catch::Approx(bs.calculatePrice(call)).margin(1e-10));
+}
+
+TEST_CASE("Repli sur le PDE hors zone de confiance et pricing par lot", "[AmericanApproximation]") {
+    const BaroneAdesiWhaleyModel baw;
+    const AmericanOptionPricer pde(baw.getTrustedRegion().pdeAssetSteps, baw.getTrustedRegion().pdeTimeStep);
+
+    const OptionSpec longDated{100.0, 100.0, 0.05, 0.3, 5.0, OptionType::Put};
+    REQUIRE_FALSE(baw.isTrusted(longDated));
+    REQUIRE(baw.calculatePrice(longDated) == pde.calculatePrice(longDated));
+
+    OptionBatch batch;
+    for (int i = 0; i < 40; ++i) {
+        batch.add(70.0 + i, 100.0, 0.05, 0.25, i % 10 == 0 ? 4.0 : 0.75, i % 3 == 0);
+    }
+    auto model = PricingModelFactory::createModel("BjerksundStensland", {{"maxMaturity", 1.0}});
+    std::vector<double> prices;
+    model->calculatePrices(batch, prices);
+    REQUIRE(prices.size() == batch.size());
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        REQUIRE(prices[i] == model->calculatePrice(batch.spec(i)));
+    }
+    REQUIRE_THROWS_AS(PricingModelFactory::createModel("BaroneAdesiWhaley", {{"paths", 10}}), std::invalid_argument);
+}
@@ -0,0 +1,107 @@
+#include <catch2/catch_all.hpp>
+
+#include "../include/util/BatchPricer.hpp"
+#include "../include/models/BlackScholesModel.hpp"
+#include "../include/models/BinomialModel.hpp"
+#include "../include/util/GreeksCalculator.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<std::string> lines(const std::string& text) {
+    std::vector<std::string> out;
+    std::istringstream stream(text);
+    std::string line;
+    while (std::getline(stream, line)) {
+        out.push_back(line);
+    }
+    return out;
+}
+
+std::string runBatch(const std::string& input, const BatchSettings& settings, BatchSummary& summary) {
+    std::istringstream in(input);
+    std::ostringstream out;
+    BatchPricer pricer(settings);
+    summary = pricer.run(in, out);
+    return out.str();
+}
+
+} // namespace
+
+TEST_CASE("Mode portefeuille : colonnes, modèles et erreurs par ligne", "[BatchPricer]") {
+    const std::string input =
+        "type,strike,spot,rate,volatility,maturity,id,model\n"
+        "call,100,100,0.05,0.2,1,A,\n"
+        "put,110,100,0.05,0.25,0.5,B,Binomial:steps=201;american=1\n"
+        "\n"
+        "put,100,-5,0.05,0.2,1,C,\n"
+        "call,100,100,0.05,0.2,1,D,NoSuchModel\n";
+
+    BatchSettings settings;
+    settings.greeks = {GreekColumn::Delta, GreekColumn::Vega};
+    BatchSummary summary;
+    const std::vector<std::string> out = lines(runBatch(input, settings, summary));
+
+    REQUIRE(summary.rows == 4);
+    REQUIRE(summary.failed == 2);
+    REQUIRE(out.size() == 5);
+    REQUIRE(out[0] == "id,model,price,delta,vega,status");
+
+    // Les nombres relisent exactement le double calculé
+    const OptionSpec call{100.0, 100.0, 0.05, 0.2, 1.0, OptionType::Call};
+    const Greeks expected = GreeksCalculator::greeks(BlackScholesModel(), call);
+    std::istringstream first(out[1]);
+    std::string id, model, price, delta, vega, status;
+    std::getline(first, id, ',');
+    std::getline(first, model, ',');
+    std::getline(first, price, ',');
+    std::getline(first, delta, ',');
+    std::getline(first, vega, ',');
+    std::getline(first, status, ',');
+    REQUIRE(id == "A");
+    REQUIRE(model == "BlackScholes");
+    REQUIRE(std::stod(price) == expected.price);
+    REQUIRE(std::stod(delta) == expected.delta);
+    REQUIRE(std::stod(vega) == expected.vega);
+    REQUIRE(status == "ok");
+
+    const OptionSpec put{100.0, 110.0, 0.05, 0.25, 0.5, OptionType::Put};
+    const double american = BinomialModel(201, ExerciseStyle::American).calculatePrice(put);
+    REQUIRE(out[2].rfind("B,Binomial:steps=201;american=1,", 0) == 0);
+    REQUIRE(std::stod(out[2].substr(out[2].find(',', out[2].find(',') + 1) + 1)) == american);
+
+    REQUIRE(out[3].rfind("C,BlackScholes,,,,", 0) == 0);
+    REQUIRE(out[4].rfind("D,NoSuchModel,,,,", 0) == 0);
+    REQUIRE(out[4].find("NoSuchModel", 16) != std::string::npos);
+}
+
+TEST_CASE("Mode portefeuille : sortie indépendante de la taille des paquets", "[BatchPricer]") {
+    std::ostringstream input;
+    input << "spot,strike,rate,volatility,maturity,type\n";
+    for (int i = 0; i < 200; ++i) {
+        input << 80 + 0.2 * i << ",100,0.03," << 0.15 + 0.001 * i << ",0.75," << (i % 2 ? "call" : "put") << "\n";
+    }
+
+    BatchSettings small;
+    small.chunkRows = 7;
+    small.greeks = {GreekColumn::Gamma, GreekColumn::Theta, GreekColumn::Rho};
+    BatchSettings large = small;
+    large.chunkRows = 4096;
+
+    BatchSummary smallSummary, largeSummary;
+    const std::string a = runBatch(input.str(), small, smallSummary);
+    const std::string b = runBatch(input.str(), large, largeSummary);
+    REQUIRE(a == b);
+    REQUIRE(smallSummary.rows == 200);
+    REQUIRE(smallSummary.chunks == 29);
+    REQUIRE(largeSummary.chunks == 1);
+    REQUIRE(lines(a)[1].rfind("1,BlackScholes,", 0) == 0);
+
+    std::istringstream missing("spot,strike,rate,volatility,type\n100,100,0.05,0.2,call\n");
+    std::ostringstream sink;
+    BatchPricer pricer;
+    REQUIRE_THROWS_AS(pricer.run(missing, sink), std::invalid_argument);
+}
@@ -0,0 +1,81 @@
+#include <catch2/catch_all.hpp>
+
+#include "../include/models/BinomialModel.hpp"
+#include "../include/models/BlackScholesModel.hpp"
+#include "../include/models/AmericanOptionPricer.hpp"
+#include "../include/Factory/PricingModelFactory.hpp"
+#include "../include/util/GreeksCalculator.hpp"
+#include "../include/util/LatticeKernel.hpp"
+
+#include <cmath>
+#include <vector>
+
+TEST_CASE("Arbre européen proche de Black-Scholes, Greeks lus sur l'arbre", "[BinomialModel]") {
+    BlackScholesModel bs;
+    const OptionSpec call{95.0, 100.0, 0.05, 0.2, 1.0, OptionType::Call};
+    const Greeks exact = bs.calculateGreeks(call);
+
+    const BinomialModel leisenReimer(200, ExerciseStyle::European, LatticeType::LeisenReimer);
+    const Greeks lr = leisenReimer.calculateGreeks(call);
+    REQUIRE(lr.price == Catch::Approx(exact.price).margin(1e-4));
+    REQUIRE(lr.delta == Catch::Approx(exact.delta).margin(1e-4));
+    REQUIRE(lr.gamma == Catch::Approx(exact.gamma).margin(1e-4));
+    REQUIRE(lr.theta == Catch::Approx(exact.theta).margin(1e-2));
+    // Nombre de pas pair arrondi à l'impair supérieur
+    REQUIRE(leisenReimer.calculatePrice(call) == BinomialModel(201, ExerciseStyle::European, LatticeType::LeisenReimer).calculatePrice(call));
+
+    const Greeks crr = GreeksCalculator::greeks(BinomialModel(400), call);
+    REQUIRE(crr.price == Catch::Approx(exact.price).margin(5e-3));
+    REQUIRE(crr.delta == Catch::Approx(exact.delta).margin(1e-3));
+    REQUIRE(crr.vega == Catch::Approx(exact.vega).margin(0.1));
+    REQUIRE(crr.rho == Catch::Approx(exact.rho).margin(0.1));
+
+    REQUIRE_THROWS_AS(BinomialModel(3), std::invalid_argument);
+}
+
+TEST_CASE("Exercice américain et bermudéen", "[BinomialModel]") {
+    const OptionSpec put{100.0, 100.0, 0.05, 0.2, 1.0, OptionType::Put};
+    const double pde = AmericanOptionPricer(400, 0.0005).calculatePrice(put);
+
+    const double american = BinomialModel(501, ExerciseStyle::American, LatticeType::LeisenReimer).calculatePrice(put);
+    const double bermudan = BinomialModel(501, ExerciseStyle::Bermudan, LatticeType::LeisenReimer, 4).calculatePrice(put);
+    const double european = BinomialModel(501, ExerciseStyle::European, LatticeType::LeisenReimer).calculatePrice(put);
+    REQUIRE(american == Catch::Approx(pde).margin(3e-3));
+    REQUIRE(european < bermudan);
+    REQUIRE(bermudan < american);
+
+    // Factory : pas, exercice et paramétrisation nommés
+    auto model = PricingModelFactory::createModel("Binomial", {{"steps", 501}, {"american", 1}, {"leisenReimer", 1}});
+    REQUIRE(model->calculatePrice(put) == american);
+}
+
+TEST_CASE("Remontée par tuiles identique à la remontée niveau par niveau", "[BinomialModel]") {
+    const int steps = 3001;
+    const double dt = 1.0 / steps;
+    const double u = std::exp(0.3 * std::sqrt(dt));
+    const double growth = std::exp(0.05 * dt);
+    const double q = (growth - 1.0 / u) / (u - 1.0 / u);
+    const LatticeParameters p{q / growth, (1.0 - q) / growth, u, 100.0, false};
+
+    // Exercice un niveau sur trois pour couvrir les niveaux sans exercice
+    std::vector<unsigned char> exercisable(steps + 1);
+    for (int s = 0; s <= steps; ++s) {
+        exercisable[s] = s % 3 == 0;
+    }
+
+    auto rollback = [&](int tileWidth, int tileLevels) {
+        std::vector<double> values(steps + 1), spots(steps + 1);
+        double spot = 100.0 * std::pow(u, -steps);
+        for (int i = 0; i <= steps; ++i, spot *= u * u) {
+            spots[i] = spot;
+            values[i] = std::max(100.0 - spot, 0.0);
+        }
+        rollbackLattice(steps, 0, p, exercisable.data(), values.data(), spots.data(), tileWidth, tileLevels);
+        return values[0];
+    };
+
+    const double reference = rollback(steps + 1, 1);
+    REQUIRE(rollback(2048, 32) == reference);
+    REQUIRE(rollback(97, 13) == reference);
+    REQUIRE(rollback(8, 64) == reference);
+}
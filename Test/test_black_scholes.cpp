@@ -0,0 +1,81 @@
+#include <catch2/catch_all.hpp>
+
+#include "../include/models/BlackScholesModel.hpp"
+#include "../include/domain/OptionBatch.hpp"
+#include "../include/domain/Option.hpp"
+#include "../include/util/VectorMath.hpp"
+#include "../include/util/GreeksCalculator.hpp"
+
+#include <cmath>
+#include <vector>
+
+TEST_CASE("exp et log vectorisés proches de la libm", "[VectorMath]") {
+    for (double x = -50.0; x <= 50.0; x += 0.37) {
+        REQUIRE(std::fabs(vecmath::exp(x) / std::exp(x) - 1.0) < 1e-14);
+    }
+    for (double x = 1e-6; x <= 1e6; x *= 1.7) {
+        REQUIRE(std::fabs(vecmath::log(x) - std::log(x)) < 1e-14 * std::max(1.0, std::fabs(std::log(x))));
+    }
+}
+
+TEST_CASE("Pricing par lot identique au pricing option par option", "[BlackScholesModel]") {
+    BlackScholesModel model;
+    OptionBatch batch;
+    std::vector<Option> options;
+    for (int i = 0; i < 257; ++i) {
+        const double K = 60.0 + 0.3 * i;
+        const double vol = 0.05 + 0.002 * i;
+        const double T = 0.05 + 0.02 * i;
+        const std::string type = (i % 3 == 0) ? "put" : "call";
+        options.emplace_back(100.0, K, 0.03, vol, T, type);
+        batch.add(options.back());
+    }
+
+    std::vector<double> simd, scalar;
+    model.calculatePrices(batch, simd);
+    model.calculatePricesScalar(batch, scalar);
+
+    REQUIRE(simd.size() == options.size());
+    for (std::size_t i = 0; i < options.size(); ++i) {
+        const double reference = model.calculatePrice(options[i]);
+        REQUIRE(std::fabs(scalar[i] - reference) < 1e-12);
+        REQUIRE(std::fabs(simd[i] - reference) < 1e-10);
+    }
+}
+
+TEST_CASE("Validation des paramètres du lot", "[OptionBatch]") {
+    OptionBatch batch;
+    REQUIRE_THROWS_AS(batch.add(-1.0, 100.0, 0.05, 0.2, 1.0, true), std::invalid_argument);
+    REQUIRE(batch.size() == 0);
+}
+
+TEST_CASE("Greeks analytiques cohérents avec les différences finies", "[GreeksCalculator]") {
+    BlackScholesModel model;
+    for (const std::string type : {"call", "put"}) {
+        Option option(95.0, 100.0, 0.04, 0.25, 0.75, type);
+        const Greeks g = GreeksCalculator::greeks(model, option);
+
+        REQUIRE(g.price == Catch::Approx(model.calculatePrice(option)).margin(1e-12));
+        REQUIRE(g.delta == Catch::Approx(GreeksCalculator::calculateDelta(model, option, 0.5)).margin(1e-3));
+        REQUIRE(g.gamma == Catch::Approx(GreeksCalculator::calculateGamma(model, option, 0.5)).margin(1e-4));
+        REQUIRE(g.vega == Catch::Approx(GreeksCalculator::calculateVega(model, option, 1e-4)).margin(1e-3));
+        REQUIRE(g.rho == Catch::Approx(GreeksCalculator::calculateRho(model, option, 1e-4)).margin(1e-3));
+
+        // Theta = dV/dT : différence centrée sur la maturité
+        const double h = 1e-4;
+        Option longer(95.0, 100.0, 0.04, 0.25, 0.75 + h, type);
+        Option shorter(95.0, 100.0, 0.04, 0.25, 0.75 - h, type);
+        const double thetaFD = (model.calculatePrice(longer) - model.calculatePrice(shorter)) / (2.0 * h);
+        REQUIRE(g.theta == Catch::Approx(thetaFD).margin(1e-3));
+
+        // Sensibilités du second ordre à partir des Greeks du premier ordre
+        Option volUp(95.0, 100.0, 0.04, 0.25 + h, 0.75, type);
+        Option volDown(95.0, 100.0, 0.04, 0.25 - h, 0.75, type);
+        const Greeks gUp = model.calculateGreeks(volUp);
+        const Greeks gDown = model.calculateGreeks(volDown);
+        REQUIRE(g.vanna == Catch::Approx((gUp.delta - gDown.delta) / (2.0 * h)).margin(1e-4));
+        REQUIRE(g.volga == Catch::Approx((gUp.vega - gDown.vega) / (2.0 * h)).margin(1e-2));
+        const double charmFD = (model.calculateGreeks(longer).delta - model.calculateGreeks(shorter).delta) / (2.0 * h);
+        REQUIRE(g.charm == Catch::Approx(charmFD).margin(1e-4));
+    }
+}
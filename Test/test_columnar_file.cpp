@@ -0,0 +1,229 @@
+#include <catch2/catch_all.hpp>
+
+#include "../include/util/ColumnarFile.hpp"
+#include "../include/util/BatchPricer.hpp"
+#include "../include/models/BlackScholesModel.hpp"
+#include "../include/models/BinomialModel.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string temporaryPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() / ("test_columnar_" + name)).string();
+}
+
+// Version du format, à l'octet 8 de l'en-tête
+std::uint32_t fileVersion(const std::string& path) {
+    std::uint32_t version = 0;
+    std::ifstream file(path, std::ios::binary);
+    file.seekg(8);
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    return version;
+}
+
+void setFileVersion(const std::string& path, std::uint32_t version) {
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(8);
+    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+}
+
+} // namespace
+
+TEST_CASE("Format binaire : blocs, alignement et ajout", "[ColumnarFile]") {
+    const std::string path = temporaryPath("roundtrip.opcb");
+    const ColumnSchema schema{{"id", ColumnType::Int64}, {"spot", ColumnType::Float64}, {"type", ColumnType::UInt8}};
+
+    std::vector<std::int64_t> ids;
+    std::vector<double> spots;
+    std::vector<unsigned char> types;
+    for (int i = 0; i < 250; ++i) {
+        ids.push_back(1000 + i);
+        spots.push_back(80.0 + i / 3.0);
+        types.push_back(static_cast<unsigned char>(i % 2));
+    }
+
+    {
+        // 250 lignes en blocs de 64 : ajouts directs et lignes mises en attente
+        ColumnarWriter writer(path, schema, WriteMode::Truncate, 64);
+        const void* first[] = {ids.data(), spots.data(), types.data()};
+        writer.append(10, first);
+        const void* rest[] = {ids.data() + 10, spots.data() + 10, types.data() + 10};
+        writer.append(190, rest);
+        REQUIRE(writer.rows() == 200);
+    }
+    {
+        ColumnarWriter writer(path, schema, WriteMode::Append, 64);
+        const void* tail[] = {ids.data() + 200, spots.data() + 200, types.data() + 200};
+        writer.append(50, tail);
+    }
+
+    const ColumnarReader reader(path);
+    REQUIRE(ColumnarReader::isColumnarFile(path));
+    REQUIRE(reader.rows() == 250);
+    REQUIRE(reader.schema().size() == 3);
+    REQUIRE(reader.columnIndex("spot") == 1);
+    REQUIRE(reader.columnIndex("volatility") == -1);
+
+    std::size_t row = 0;
+    for (std::size_t b = 0; b < reader.blockCount(); ++b) {
+        const double* spot = reader.float64(b, 1);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(spot) % 64 == 0);
+        for (std::size_t i = 0; i < reader.blockRows(b); ++i, ++row) {
+            REQUIRE(reader.int64(b, 0)[i] == ids[row]);
+            REQUIRE(spot[i] == spots[row]);
+            REQUIRE(reader.uint8(b, 2)[i] == types[row]);
+        }
+    }
+    REQUIRE(row == 250);
+    REQUIRE_THROWS_AS(reader.float64(0, 0), std::logic_error);
+
+    // Ajout avec un autre schéma refusé ; fichier tronqué détecté
+    REQUIRE_THROWS_AS(ColumnarWriter(path, {{"spot", ColumnType::Float64}}, WriteMode::Append),
+                      std::invalid_argument);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+    REQUIRE_THROWS_AS(ColumnarReader(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Format binaire : conversion CSV exacte et pricing sans copie", "[ColumnarFile]") {
+    const std::string path = temporaryPath("book.opcb");
+    const std::string resultPath = temporaryPath("prices.opcb");
+
+    std::ostringstream csv;
+    csv << "id,spot,strike,rate,volatility,maturity,type,model\n";
+    for (int i = 0; i < 300; ++i) {
+        csv << i << ',' << 70.0 + i * 0.2 << ",100,0.03," << 0.1 + i * 0.001 << ",0.5,"
+            << (i % 3 ? "call" : "put") << ",\n";
+    }
+    csv << "300,-5,100,0.03,0.2,0.5,put,\n";
+    std::istringstream input(csv.str());
+    REQUIRE(convertCsvToColumnar(input, path, 128) == 301);
+
+    // Retour en CSV : mêmes valeurs, cellules model vides comprises
+    std::ostringstream back;
+    REQUIRE(convertColumnarToCsv(path, back) == 301);
+    std::istringstream lines(back.str());
+    std::string line;
+    std::getline(lines, line);
+    REQUIRE(line == "id,spot,strike,rate,volatility,maturity,type,model");
+    std::getline(lines, line);
+    REQUIRE(line == "0,70,100,0.03,0.1,0.5,put,");
+
+    BatchSettings settings;
+    settings.chunkRows = 100;
+    BatchPricer pricer(settings);
+    const ColumnarReader book(path);
+    BatchSummary summary;
+    {
+        ColumnarWriter output(resultPath, pricer.resultSchema());
+        summary = pricer.run(book, output);
+    }
+    REQUIRE(summary.rows == 301);
+    REQUIRE(summary.failed == 1);
+
+    const ColumnarReader results(resultPath);
+    REQUIRE(results.rows() == 301);
+    const BlackScholesModel bs;
+    std::size_t row = 0;
+    for (std::size_t b = 0; b < results.blockCount(); ++b) {
+        const double* price = results.float64(b, 1);
+        const unsigned char* status = results.uint8(b, 2);
+        for (std::size_t i = 0; i < results.blockRows(b); ++i, ++row) {
+            REQUIRE(results.int64(b, 0)[i] == static_cast<std::int64_t>(row));
+            if (row < 300) {
+                const OptionSpec option{70.0 + row * 0.2, 100.0, 0.03, 0.1 + row * 0.001, 0.5,
+                                        row % 3 ? OptionType::Call : OptionType::Put};
+                REQUIRE(status[i] == static_cast<unsigned char>(BatchStatus::Ok));
+                REQUIRE(price[i] == Catch::Approx(bs.calculatePrice(option)).epsilon(1e-12).margin(1e-12));
+            } else {
+                REQUIRE(status[i] == static_cast<unsigned char>(BatchStatus::InvalidInput));
+                REQUIRE(std::isnan(price[i]));
+            }
+        }
+    }
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(resultPath);
+}
+
+TEST_CASE("Format binaire : colonne model conservée, un modèle par ligne", "[ColumnarFile]") {
+    const std::string path = temporaryPath("models.opcb");
+    const std::string resultPath = temporaryPath("models_prices.opcb");
+
+    // Blocs de 4 lignes : chaque bloc porte sa propre table de chaînes
+    std::ostringstream csv;
+    csv << "id,spot,strike,rate,volatility,maturity,type,model\n";
+    const char* models[] = {"Binomial:steps=501;american=1", "BlackScholes", "", "Binomial:steps=51", "Nope"};
+    for (int i = 0; i < 10; ++i) {
+        csv << i << ',' << 90 + i << ",100,0.03,0.2,1,put," << models[i % 5] << "\n";
+    }
+    std::istringstream input(csv.str());
+    REQUIRE(convertCsvToColumnar(input, path, 4) == 10);
+
+    std::ostringstream back;
+    convertColumnarToCsv(path, back);
+    REQUIRE(back.str() == csv.str());
+
+    const ColumnarReader book(path);
+    REQUIRE(book.schema()[7].type == ColumnType::Text);
+    REQUIRE(book.blockStrings(0).size() == 4);
+    REQUIRE(book.blockStrings(0)[book.text(0, 7)[0]] == "Binomial:steps=501;american=1");
+    REQUIRE(book.blockStrings(1)[book.text(1, 7)[0]] == "Nope");
+
+    // Colonne Text : version 2 ; annoncée en version 1 (ou inconnue), le fichier est refusé
+    REQUIRE(fileVersion(path) == 2);
+    const std::string relabelled = temporaryPath("models_v1.opcb");
+    std::filesystem::copy_file(path, relabelled, std::filesystem::copy_options::overwrite_existing);
+    setFileVersion(relabelled, 1);
+    REQUIRE_THROWS_AS(ColumnarReader(relabelled), std::runtime_error);
+    setFileVersion(relabelled, 3);
+    std::string message;
+    try {
+        ColumnarReader reader(relabelled);
+    } catch (const std::runtime_error& e) {
+        message = e.what();
+    }
+    REQUIRE(message.find("unsupported version 3") != std::string::npos);
+    std::filesystem::remove(relabelled);
+
+    BatchSettings settings;
+    settings.defaultModel = "Binomial:steps=101";
+    BatchPricer pricer(settings);
+    BatchSummary summary;
+    {
+        ColumnarWriter output(resultPath, pricer.resultSchema());
+        summary = pricer.run(book, output);
+    }
+    REQUIRE(summary.failed == 2);
+
+    // Sans colonne Text : toujours écrit en version 1, lisible par les lecteurs antérieurs
+    REQUIRE(fileVersion(resultPath) == 1);
+    const ColumnarReader results(resultPath);
+    std::vector<double> prices;
+    std::vector<unsigned char> status;
+    for (std::size_t b = 0; b < results.blockCount(); ++b) {
+        for (std::size_t i = 0; i < results.blockRows(b); ++i) {
+            prices.push_back(results.float64(b, 1)[i]);
+            status.push_back(results.uint8(b, 2)[i]);
+        }
+    }
+    REQUIRE(prices.size() == 10);
+    auto put = [](int i) { return OptionSpec{90.0 + i, 100.0, 0.03, 0.2, 1.0, OptionType::Put}; };
+    REQUIRE(prices[0] == BinomialModel(501, ExerciseStyle::American).calculatePrice(put(0)));
+    REQUIRE(prices[1] == Catch::Approx(BlackScholesModel().calculatePrice(put(1))).epsilon(1e-12));
+    REQUIRE(prices[2] == BinomialModel(101).calculatePrice(put(2)));  // Cellule vide : defaultModel
+    REQUIRE(prices[3] == BinomialModel(51).calculatePrice(put(3)));
+    REQUIRE(status[4] == static_cast<unsigned char>(BatchStatus::InvalidInput));
+    REQUIRE(prices[5] == BinomialModel(501, ExerciseStyle::American).calculatePrice(put(5)));
+    REQUIRE(status[9] == static_cast<unsigned char>(BatchStatus::InvalidInput));
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(resultPath);
+}
@@ -7,7 +7,18 @@ int main(int argc, char* argv[]) {
 }
 
 #include "../include/models/FiniteDifferenceModel.hpp"
+#include "../include/models/BlackScholesModel.hpp"
 #include "../include/domain/Option.hpp"
+#include "../include/util/TridiagonalSolver.hpp"
+#include "../include/util/SpotGrid.hpp"
+#include "../include/models/AmericanOptionPricer.hpp"
+#include "../include/Factory/PricingModelFactory.hpp"
+#include "../include/util/GreeksCalculator.hpp"
+#include "../include/util/Greeks.hpp"
+#include "../include/domain/LocalVolatilitySurface.hpp"
+#include <memory>
+#include <cmath>
+#include <vector>
 
 TEST_CASE("Test du constructeur FiniteDifferenceModel", "[FiniteDifferenceModel]") {
     REQUIRE_NOTHROW(FiniteDifferenceModel(50, 100)); // Construction valide
@@ -27,3 +38,206 @@ TEST_CASE("Calcul du prix avec Crank-Nicolson", "[FiniteDifferenceModel]") {
     REQUIRE(putPrice > 0.0);
     REQUIRE(callPrice != putPrice);
 }
+
+TEST_CASE("Solveur tridiagonal : résolution et produit en place", "[TridiagonalSolver]") {
+    const int n = 6;
+    const std::vector<double> lower = {0.0, -1.0, 0.5, -0.3, 0.2, -0.7};
+    const std::vector<double> diagonal = {4.0, 3.5, 5.0, 4.2, 3.9, 4.4};
+    const std::vector<double> upper = {1.0, -0.6, 0.8, 0.1, -0.9, 0.0};
+    const std::vector<double> solution = {1.0, -2.0, 0.5, 3.0, -1.5, 2.5};
+
+    std::vector<double> x = solution;
+    multiplyTridiagonal(lower.data(), diagonal.data(), upper.data(), x.data(), n);
+    REQUIRE(x[2] == Catch::Approx(0.5 * -2.0 + 5.0 * 0.5 + 0.8 * 3.0));
+
+    TridiagonalSolver solver;
+    solver.factorize(lower.data(), diagonal.data(), upper.data(), n);
+    solver.solve(x.data());
+    for (int i = 0; i < n; ++i) {
+        REQUIRE(x[i] == Catch::Approx(solution[i]).margin(1e-12));
+    }
+}
+
+TEST_CASE("Crank-Nicolson proche de Black-Scholes", "[FiniteDifferenceModel]") {
+    FiniteDifferenceModel model(100, 200);
+    BlackScholesModel bs;
+    for (const double spot : {80.0, 100.0, 125.0}) {
+        Option callOption(spot, 100.0, 0.05, 0.2, 1.0, "call");
+        Option putOption(spot, 100.0, 0.05, 0.2, 1.0, "put");
+        REQUIRE(model.calculatePrice(callOption) == Catch::Approx(bs.calculatePrice(callOption)).margin(2e-2));
+        REQUIRE(model.calculatePrice(putOption) == Catch::Approx(bs.calculatePrice(putOption)).margin(2e-2));
+    }
+}
+
+TEST_CASE("Solution complète : Greeks lus sur la grille", "[FiniteDifferenceModel]") {
+    FiniteDifferenceModel model(100, 200);
+    BlackScholesModel bs;
+    Option option(100.0, 100.0, 0.05, 0.2, 1.0, "put");
+    const FiniteDifferenceSolution solution = model.solve(option);
+
+    REQUIRE(solution.price(option.getSpotPrice()) == Catch::Approx(model.calculatePrice(option)));
+    for (const double spot : {70.0, 100.0, 130.0}) {
+        const Greeks exact = bs.calculateGreeks(option.spec().withSpot(spot));
+        const Greeks g = solution.greeks(spot);
+        REQUIRE(g.price == Catch::Approx(exact.price).margin(2e-2));
+        REQUIRE(g.delta == Catch::Approx(exact.delta).margin(2e-3));
+        REQUIRE(g.gamma == Catch::Approx(exact.gamma).margin(5e-4));
+        REQUIRE(g.theta == Catch::Approx(exact.theta).margin(2e-2));
+    }
+    REQUIRE_THROWS_AS(solution.price(-1.0), std::out_of_range);
+}
+
+TEST_CASE("Grille sinh : spot sur un noeud et précision à nombre de noeuds égal", "[SpotGrid]") {
+    std::vector<double> nodes;
+    const int spotIndex = buildSpotGrid(GridType::Sinh, 300.0, 50, 100.0, 97.0, nodes);
+    REQUIRE(nodes.size() == 51);
+    REQUIRE(nodes.front() == 0.0);
+    REQUIRE(nodes.back() == Catch::Approx(300.0));
+    REQUIRE(nodes[spotIndex] == Catch::Approx(97.0).epsilon(1e-14));
+    for (std::size_t i = 1; i < nodes.size(); ++i) {
+        REQUIRE(nodes[i] > nodes[i - 1]);
+    }
+    REQUIRE_THROWS_AS(buildSpotGrid(GridType::Sinh, 300.0, 50, 100.0, 400.0, nodes), std::out_of_range);
+
+    // À nombre de noeuds égal, la grille sinh est plus précise que la grille uniforme
+    FiniteDifferenceModel sinhModel(100, 50, GridType::Sinh);
+    FiniteDifferenceModel uniformModel(100, 50, GridType::Uniform);
+    BlackScholesModel bs;
+    double sinhError = 0.0, uniformError = 0.0;
+    for (const double spot : {85.0, 100.0, 115.0}) {
+        Option option(spot, 100.0, 0.05, 0.2, 1.0, "call");
+        const double exact = bs.calculatePrice(option);
+        sinhError = std::max(sinhError, std::fabs(sinhModel.calculatePrice(option) - exact));
+        uniformError = std::max(uniformError, std::fabs(uniformModel.calculatePrice(option) - exact));
+    }
+    REQUIRE(sinhError < uniformError);
+}
+
+TEST_CASE("Pas de temps : Rannacher et extrapolation de Richardson", "[FiniteDifferenceModel]") {
+    BlackScholesModel bs;
+    Option option(100.0, 100.0, 0.05, 0.2, 1.0, "call");
+    const double exact = bs.calculatePrice(option);
+    const double exactGamma = bs.calculateGreeks(option.spec()).gamma;
+
+    // Sans Rannacher, le coude du payoff pollue le gamma quand les pas sont grands
+    TimeSteppingPolicy crankNicolson;
+    crankNicolson.rannacherSteps = 0;
+    const FiniteDifferenceSolution plain = FiniteDifferenceModel(25, 400, GridType::Sinh, crankNicolson).solve(option);
+    const FiniteDifferenceSolution damped = FiniteDifferenceModel(25, 400).solve(option);
+    REQUIRE(std::fabs(damped.gamma(100.0) - exactGamma) < 1e-4);
+    REQUIRE(std::fabs(plain.gamma(100.0) - exactGamma) > 1e-2);
+
+    // Richardson : 25 pas suffisent pour atteindre l'erreur spatiale
+    TimeSteppingPolicy extrapolated;
+    extrapolated.richardson = true;
+    FiniteDifferenceModel richardson(25, 400, GridType::Sinh, extrapolated);
+    REQUIRE(richardson.calculatePrice(option) == Catch::Approx(exact).margin(2e-4));
+    REQUIRE(std::fabs(richardson.calculatePrice(option) - exact) <
+            std::fabs(FiniteDifferenceModel(25, 400).calculatePrice(option) - exact));
+
+    TimeSteppingPolicy invalid;
+    invalid.rannacherSteps = -1;
+    REQUIRE_THROWS_AS(FiniteDifferenceModel(25, 400, GridType::Sinh, invalid), std::invalid_argument);
+}
+
+TEST_CASE("Option américaine : Brennan-Schwartz et PSOR projeté", "[AmericanOptionPricer]") {
+    // Solveur projeté : x >= obstacle, exact quand la zone contrainte est en fin de système
+    std::vector<double> lower = {0.0, -1.0, -1.0}, diagonal = {2.0, 2.0, 2.0}, upper = {-1.0, -1.0, 0.0};
+    TridiagonalSolver solver;
+    solver.factorize(lower.data(), diagonal.data(), upper.data(), 3);
+    std::vector<double> x = {1.0, 0.0, 0.0};
+    const std::vector<double> obstacle = {0.0, 0.0, 1.0};
+    solver.solveProjected(x.data(), obstacle.data());
+    REQUIRE(x[2] == Catch::Approx(1.0));
+    REQUIRE(x[1] == Catch::Approx(1.0)); // 2 x1 - x0 = 1 avec x2 fixé
+    REQUIRE(x[0] == Catch::Approx(1.0));
+
+    const double direct = AmericanOptionPricer(100, 100, 1, 0.2, 0.05, 200, 0.001, "put").Value();
+    const double psor = AmericanOptionPricer(100, 100, 1, 0.2, 0.05, 200, 0.001, "put",
+                                             AmericanSolver::ProjectedSOR).Value();
+    REQUIRE(direct == Catch::Approx(psor).margin(1e-4));
+    REQUIRE(direct == Catch::Approx(6.0904).margin(2e-3));
+
+    // Sans dividende, le call américain vaut le call européen
+    BlackScholesModel bs;
+    const double call = AmericanOptionPricer(100, 100, 1, 0.2, 0.05, 200, 0.001, "call").Value();
+    REQUIRE(call == Catch::Approx(bs.calculatePrice(Option(100, 100, 0.05, 0.2, 1, "call"))).margin(2e-3));
+}
+
+TEST_CASE("Option américaine : configuration seule, résolutions mémorisées", "[AmericanOptionPricer]") {
+    const AmericanOptionPricer pricer(200, 0.001);
+    Option option(100, 100, 0.05, 0.2, 1, "put");
+
+    // Même résultat que le pricer lié à l'option, et appels répétés identiques
+    const double price = pricer.calculatePrice(option);
+    REQUIRE(price == AmericanOptionPricer(100, 100, 1, 0.2, 0.05, 200, 0.001, "put").Value());
+    REQUIRE(pricer.calculatePrice(option) == price);
+    REQUIRE(pricer.calculatePrice(option.spec().withSpot(90.0)) > price);
+
+    // Grille indépendante du spot : les bumps de spot sont lus sur la même
+    // tranche, le gamma ne dépend pas de la taille du bump
+    REQUIRE(GreeksCalculator::gamma(pricer, option) ==
+            Catch::Approx(GreeksCalculator::calculateGamma(pricer, option, 1.0)).margin(1e-4));
+
+    REQUIRE_THROWS_AS(AmericanOptionPricer(1, 0.001), std::invalid_argument);
+    REQUIRE_THROWS_AS(pricer.Value(), std::logic_error);
+
+    auto model = PricingModelFactory::createModel("American", {{"assetSteps", 200}, {"timeStep", 0.001}});
+    REQUIRE(model->calculatePrice(option) == price);
+}
+
+TEST_CASE("Volatilité locale : surfaces plate, temporelle et avec skew", "[FiniteDifferenceModel]") {
+    BlackScholesModel bs;
+    const OptionSpec put{100.0, 90.0, 0.05, 0.2, 1.0, OptionType::Put};
+
+    // Surface plate : même prix que Black-Scholes, la volatilité de l'option est ignorée
+    auto flat = std::make_shared<const LocalVolatilitySurface>(LocalVolatilitySurface::flat(0.2));
+    const FiniteDifferenceModel flatModel(200, 400, GridType::Sinh, TimeSteppingPolicy(), flat);
+    REQUIRE(flatModel.calculatePrice(put.withVol(0.9)) == Catch::Approx(bs.calculatePrice(put)).margin(1e-4));
+
+    // sigma(t) linéaire de 0.1 à 0.3 : Black-Scholes avec la variance moyenne (0.01 + 0.03 + 0.09) / 3
+    auto term = std::make_shared<const LocalVolatilitySurface>(
+        std::vector<double>{100.0}, std::vector<double>{0.0, 1.0}, std::vector<double>{0.1, 0.3});
+    const FiniteDifferenceModel termModel(200, 400, GridType::Sinh, TimeSteppingPolicy(), term);
+    const double averageVol = std::sqrt(0.13 / 3.0);
+    for (double strike : {80.0, 100.0, 120.0}) {
+        const OptionSpec call{100.0, strike, 0.05, averageVol, 1.0, OptionType::Call};
+        REQUIRE(termModel.calculatePrice(call) == Catch::Approx(bs.calculatePrice(call)).margin(1e-3));
+    }
+
+    // Skew : volatilité décroissante en spot, les puts hors de la monnaie renchérissent
+    const std::vector<double> spots{50.0, 75.0, 100.0, 125.0, 150.0};
+    const std::vector<double> skew{0.4, 0.3, 0.2, 0.15, 0.12};
+    std::vector<double> volatilities(skew);
+    volatilities.insert(volatilities.end(), skew.begin(), skew.end());
+    auto bilinear = std::make_shared<const LocalVolatilitySurface>(spots, std::vector<double>{0.0, 1.0}, volatilities);
+    auto spline = std::make_shared<const LocalVolatilitySurface>(spots, std::vector<double>{0.0, 1.0}, volatilities,
+                                                                 SurfaceInterpolation::Spline);
+    REQUIRE(bilinear->volatility(87.5, 0.3) == Catch::Approx(0.25));
+    REQUIRE(bilinear->volatility(10.0, 5.0) == Catch::Approx(0.4));
+    REQUIRE(spline->volatility(100.0, 0.5) == Catch::Approx(0.2));
+
+    const FiniteDifferenceModel skewModel(100, 200, GridType::Sinh, TimeSteppingPolicy(), bilinear);
+    const double skewed = skewModel.calculatePrice(put.withStrike(80.0));
+    REQUIRE(skewed > bs.calculatePrice(put.withStrike(80.0)) + 0.3);
+    REQUIRE(FiniteDifferenceModel(100, 200, GridType::Sinh, TimeSteppingPolicy(), spline)
+                .calculatePrice(put.withStrike(80.0)) == Catch::Approx(skewed).margin(0.1));
+
+    // Table partagée par les options de même échéance : résultat indépendant de l'ordre des appels
+    const double atTheMoney = skewModel.calculatePrice(put.withStrike(100.0));
+    REQUIRE(skewModel.calculatePrice(put.withStrike(80.0)) == skewed);
+    REQUIRE(FiniteDifferenceModel(100, 200, GridType::Sinh, TimeSteppingPolicy(), bilinear)
+                .calculatePrice(put.withStrike(100.0)) == atTheMoney);
+
+    // Richardson et Greeks lus sur la grille fonctionnent aussi en volatilité locale
+    TimeSteppingPolicy richardson;
+    richardson.richardson = true;
+    const FiniteDifferenceModel richardsonModel(100, 400, GridType::Sinh, richardson, flat);
+    const FiniteDifferenceSolution solution = richardsonModel.solve(put);
+    REQUIRE(solution.price(100.0) == Catch::Approx(bs.calculatePrice(put)).margin(1e-4));
+    REQUIRE(solution.delta(100.0) == Catch::Approx(bs.calculateGreeks(put).delta).margin(1e-3));
+
+    REQUIRE_THROWS_AS(LocalVolatilitySurface({100.0, 90.0}, {0.0}, {0.2, 0.2}), std::invalid_argument);
+    REQUIRE_THROWS_AS(LocalVolatilitySurface({100.0}, {0.0, 1.0}, {0.2}), std::invalid_argument);
+    REQUIRE_THROWS_AS(LocalVolatilitySurface({100.0}, {0.0}, {-0.2}), std::invalid_argument);
+}
@@ -0,0 +1,95 @@
+#include <catch2/catch_all.hpp>
+
+#include "../include/models/ImpliedVolatilitySolver.hpp"
+#include "../include/models/BlackScholesModel.hpp"
+#include "../include/models/BaroneAdesiWhaleyModel.hpp"
+#include "../include/models/AmericanOptionPricer.hpp"
+
+#include <cmath>
+#include <vector>
+
+TEST_CASE("Volatilité implicite européenne : aller-retour et statuts", "[ImpliedVolatility]") {
+    const ImpliedVolatilitySolver solver;
+    const BlackScholesModel bs;
+
+    // normcdf() de BlackScholesModel est précis à 1e-7 : l'écart toléré en découle
+    for (double strike : {70.0, 95.0, 100.0, 110.0, 140.0}) {
+        for (double vol : {0.1, 0.25, 0.6}) {
+            for (OptionType type : {OptionType::Call, OptionType::Put}) {
+                const OptionSpec option{100.0, strike, 0.03, vol, 1.0, type};
+                const ImpliedVolResult result = solver.solve(option, bs.calculatePrice(option));
+                REQUIRE(result.status == ImpliedVolStatus::Converged);
+                REQUIRE(result.iterations <= 4);
+                REQUIRE(result.volatility == Catch::Approx(vol).margin(2e-5));
+            }
+        }
+    }
+
+    const OptionSpec call{100.0, 90.0, 0.05, 0.2, 1.0, OptionType::Call};
+    const double forwardIntrinsic = 100.0 - 90.0 * std::exp(-0.05);
+    REQUIRE(solver.solve(call, forwardIntrinsic - 0.01).status == ImpliedVolStatus::BelowIntrinsic);
+    REQUIRE(std::isnan(solver.solve(call, forwardIntrinsic).volatility));
+    REQUIRE(solver.solve(call, 100.0).status == ImpliedVolStatus::AboveMaximum);
+    REQUIRE(solver.solve(call.withMaturity(0.0), 12.0).status == ImpliedVolStatus::InvalidInput);
+}
+
+TEST_CASE("Volatilité implicite par lot identique à l'inversion unitaire", "[ImpliedVolatility]") {
+    const ImpliedVolatilitySolver solver;
+    const BlackScholesModel bs;
+
+    OptionBatch quotes;
+    for (int i = 0; i < 3000; ++i) {
+        quotes.add(100.0, 80.0 + 0.0133 * i, 0.02, 0.15 + 0.0002 * i, 0.25 + 0.001 * i, i % 2 == 0);
+    }
+    std::vector<double> prices;
+    bs.calculatePrices(quotes, prices);
+    prices[7] = -1.0; // Cotation aberrante : le lot continue
+
+    ImpliedVolBatch results;
+    solver.solve(quotes, prices, results);
+    REQUIRE(results.size() == quotes.size());
+    REQUIRE(results.status[7] == ImpliedVolStatus::BelowIntrinsic);
+    REQUIRE(results.convergedCount() == quotes.size() - 1);
+    for (std::size_t i : {0u, 1u, 1500u, 2999u}) {
+        const ImpliedVolResult single = solver.solve(quotes.spec(i), prices[i]);
+        REQUIRE(results.volatility[i] == single.volatility);
+        REQUIRE(results.iterations[i] == single.iterations);
+    }
+
+    REQUIRE_THROWS_AS(solver.solve(quotes, std::vector<double>(3), results), std::invalid_argument);
+}
+
+TEST_CASE("Volatilité implicite américaine par encadrement", "[ImpliedVolatility]") {
+    const ImpliedVolatilitySolver solver;
+    const BaroneAdesiWhaleyModel baw;
+    const AmericanOptionPricer pde(200, 0.001);
+
+    const OptionSpec put{100.0, 110.0, 0.05, 0.3, 1.0, OptionType::Put};
+    for (const OptionPricingModel* model : {static_cast<const OptionPricingModel*>(&baw),
+                                            static_cast<const OptionPricingModel*>(&pde)}) {
+        const ImpliedVolResult result = solver.solveAmerican(*model, put, model->calculatePrice(put));
+        REQUIRE(result.status == ImpliedVolStatus::Converged);
+        REQUIRE(result.volatility == Catch::Approx(0.3).margin(1e-6));
+        REQUIRE(result.iterations <= 10);
+    }
+
+    // La volatilité européenne du même prix est une borne haute
+    const double americanPrice = baw.calculatePrice(put);
+    REQUIRE(solver.solve(put, americanPrice).volatility > 0.3);
+
+    // Put très dans la monnaie exercé immédiatement : prix = valeur intrinsèque
+    REQUIRE(solver.solveAmerican(baw, put.withSpot(60.0), 50.0).status == ImpliedVolStatus::BelowIntrinsic);
+
+    OptionBatch quotes;
+    std::vector<double> prices;
+    for (double strike : {90.0, 100.0, 110.0}) {
+        quotes.add(100.0, strike, 0.05, 0.25, 0.5, false);
+        prices.push_back(baw.calculatePrice(quotes.spec(quotes.size() - 1)));
+    }
+    ImpliedVolBatch results;
+    solver.solveAmerican(baw, quotes, prices, results);
+    REQUIRE(results.convergedCount() == 3);
+    for (double vol : results.volatility) {
+        REQUIRE(vol == Catch::Approx(0.25).margin(1e-6));
+    }
+}
@@ -0,0 +1,273 @@
+#include <catch2/catch_all.hpp>
+
+#include "../include/models/MonteCarloModel.hpp"
+#include "../include/models/BlackScholesModel.hpp"
+#include "../include/util/Philox.hpp"
+#include "../include/util/SobolSequence.hpp"
+#include "../include/util/BrownianBridge.hpp"
+#include "../include/Factory/PricingModelFactory.hpp"
+#include "../include/domain/Option.hpp"
+
+#include <omp.h>
+#include <cmath>
+#include <vector>
+
+TEST_CASE("Philox4x32-10 : vecteurs de référence Random123", "[Philox]") {
+    std::uint32_t out[4];
+    Philox4x32(0).generate(0, 0, 0, 0, out);
+    REQUIRE(out[0] == 0x6627e8d5u);
+    REQUIRE(out[1] == 0xe169c58du);
+    REQUIRE(out[2] == 0xbc57ac4cu);
+    REQUIRE(out[3] == 0x9b00dbd8u);
+
+    Philox4x32((static_cast<std::uint64_t>(0x299f31d0u) << 32) | 0xa4093822u)
+        .generate(0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u, out);
+    REQUIRE(out[0] == 0xd16cfe09u);
+    REQUIRE(out[1] == 0x94fdccebu);
+    REQUIRE(out[2] == 0x5001e420u);
+    REQUIRE(out[3] == 0x24126ea1u);
+}
+
+TEST_CASE("Génération par bloc identique au tirage unitaire", "[Philox]") {
+    const Philox4x32 generator(1234);
+    double z0[37], z1[37];
+    generator.normalPairs(1000, 37, 5, z0, z1);
+    for (int i = 0; i < 37; ++i) {
+        REQUIRE(z0[i] == generator.normal(1000 + i, 10));
+        REQUIRE(z1[i] == generator.normal(1000 + i, 11));
+    }
+}
+
+TEST_CASE("Prix Monte Carlo indépendant du nombre de threads", "[MonteCarloModel]") {
+    MonteCarloModel model(50000, 7);
+    Option option(100.0, 105.0, 0.03, 0.25, 1.0, "call");
+
+    const int previousThreads = omp_get_max_threads();
+    omp_set_num_threads(1);
+    const double singleThread = model.calculatePrice(option);
+    omp_set_num_threads(4);
+    const double fourThreads = model.calculatePrice(option);
+    omp_set_num_threads(3);
+    const double threeThreads = model.calculatePrice(option);
+    omp_set_num_threads(previousThreads);
+
+    REQUIRE(singleThread == fourThreads);
+    REQUIRE(singleThread == threeThreads);
+    REQUIRE(model.calculatePrice(option, 7) == singleThread);
+    REQUIRE(model.calculatePrice(option, 8) != singleThread);
+}
+
+TEST_CASE("Prix Monte Carlo proche de Black-Scholes", "[MonteCarloModel]") {
+    MonteCarloModel model(400000);
+    BlackScholesModel bs;
+    for (const std::string type : {"call", "put"}) {
+        Option option(100.0, 100.0, 0.05, 0.2, 1.0, type);
+        REQUIRE(model.calculatePrice(option) == Catch::Approx(bs.calculatePrice(option)).margin(0.05));
+    }
+    REQUIRE_THROWS_AS(MonteCarloModel(0), std::invalid_argument);
+}
+
+TEST_CASE("Suite de Sobol : premiers points et stratification", "[SobolSequence]") {
+    const SobolSequence sobol(40);
+    const double expected[] = {0.0, 0.5, 0.75, 0.25, 0.375, 0.875, 0.625, 0.125};
+    std::uint32_t x[8];
+    sobol.generate(0, 8, 0, x);
+    for (int i = 0; i < 8; ++i) {
+        REQUIRE(x[i] * 2.3283064365386963e-10 == expected[i]);
+    }
+
+    // Chaque dimension est une (0,1)-suite : 2^m points consécutifs alignés
+    // remplissent exactement une fois chaque intervalle dyadique de largeur 2^-m
+    const int m = 8;
+    std::vector<std::uint32_t> column(1 << m);
+    for (int d = 0; d < sobol.dimensions(); ++d) {
+        sobol.generate(256, column.size(), d, column.data());
+        std::vector<int> counts(1 << m, 0);
+        for (std::uint32_t value : column) {
+            ++counts[value >> (32 - m)];
+        }
+        for (int c : counts) {
+            REQUIRE(c == 1);
+        }
+    }
+
+    // La génération par récurrence de Gray coïncide avec le calcul direct
+    std::vector<std::uint32_t> direct(40);
+    sobol.point(1000, direct.data());
+    for (int d = 0; d < 40; ++d) {
+        std::uint32_t value;
+        sobol.generate(1000, 1, d, &value);
+        REQUIRE(value == direct[d]);
+    }
+}
+
+TEST_CASE("Pont brownien : covariance min(t_i, t_j)", "[BrownianBridge]") {
+    const std::vector<double> times = {0.1, 0.25, 0.3, 0.55, 0.8, 1.0, 1.7};
+    const BrownianBridge bridge(times);
+    const int n = bridge.numSteps();
+
+    // W = A z est linéaire : les colonnes de A s'obtiennent avec z = e_m
+    std::vector<std::vector<double>> columns(n, std::vector<double>(n));
+    for (int m = 0; m < n; ++m) {
+        std::vector<double> z(n, 0.0);
+        z[m] = 1.0;
+        bridge.buildPath(z.data(), columns[m].data());
+    }
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            double covariance = 0.0;
+            for (int m = 0; m < n; ++m) {
+                covariance += columns[m][i] * columns[m][j];
+            }
+            REQUIRE(covariance == Catch::Approx(std::min(times[i], times[j])).margin(1e-12));
+        }
+    }
+}
+
+TEST_CASE("Quasi Monte Carlo : précision et erreur standard", "[MonteCarloModel]") {
+    BlackScholesModel bs;
+    Option option(100.0, 110.0, 0.05, 0.3, 0.5, "put");
+    const double reference = bs.calculatePrice(option);
+
+    MonteCarloModel qmc(4096, SamplingMethod::Sobol, 16);
+    const MonteCarloResult result = qmc.simulate(option);
+    REQUIRE(result.pathsUsed == 4096);
+    REQUIRE(result.standardError > 0.0);
+    REQUIRE(result.price == Catch::Approx(reference).margin(4.0 * result.standardError + 1e-3));
+
+    // Même budget en pseudo-aléatoire : erreur standard bien plus grande
+    MonteCarloModel mc(4096);
+    REQUIRE(mc.simulate(option).standardError > 10.0 * result.standardError);
+
+    auto model = PricingModelFactory::createModel("QuasiMonteCarlo", {{"paths", 2048}, {"randomizations", 8}});
+    REQUIRE(model->calculatePrice(option) == Catch::Approx(reference).margin(0.02));
+    REQUIRE_THROWS_AS(PricingModelFactory::createModel("MonteCarlo", {{"steps", 10}}), std::invalid_argument);
+
+    // Paramètres entiers : lus exactement, valeurs négatives, fractionnaires ou hors bornes refusées
+    auto seeded = PricingModelFactory::createModelFromSpec("MonteCarlo:paths=100;seed=18446744073709551557");
+    REQUIRE(dynamic_cast<const MonteCarloModel&>(*seeded).getSeed() == 18446744073709551557ULL);
+    for (const std::string spec : {"MonteCarlo:seed=-1", "MonteCarlo:seed=1.5", "MonteCarlo:seed=1e30",
+                                   "MonteCarlo:paths=3000000000", "Binomial:steps=100.5"}) {
+        REQUIRE_THROWS_AS(PricingModelFactory::createModelFromSpec(spec), std::invalid_argument);
+    }
+    REQUIRE_THROWS_AS(PricingModelFactory::createModel("MonteCarlo", {{"seed", -1.0}}), std::invalid_argument);
+    REQUIRE_THROWS_AS(PricingModelFactory::createModel("Binomial", {{"exerciseDates", 1e10}}), std::invalid_argument);
+}
+
+TEST_CASE("Monte Carlo adaptatif : arrêt sur l'erreur standard cible", "[MonteCarloModel]") {
+    BlackScholesModel bs;
+    MonteCarloModel model;
+    for (const std::string type : {"call", "put"}) {
+        Option option(100.0, 95.0, 0.04, 0.25, 1.0, type);
+        const double reference = bs.calculatePrice(option);
+
+        AdaptiveSettings settings;
+        settings.targetStandardError = 5e-3;
+        settings.maxSeconds = 60.0;
+        const MonteCarloResult result = model.simulateAdaptive(option, settings);
+
+        REQUIRE(result.standardError <= settings.targetStandardError);
+        REQUIRE(result.price == Catch::Approx(reference).margin(4.0 * result.standardError));
+        REQUIRE(result.varianceReductionRatio > 1.5);
+        REQUIRE(result.pathsUsed % 2 == 0);
+
+        // Sans réduction de variance il faut davantage de trajectoires
+        AdaptiveSettings crude = settings;
+        crude.antithetic = false;
+        crude.controlVariate = false;
+        const MonteCarloResult plain = model.simulateAdaptive(option, crude);
+        REQUIRE(plain.pathsUsed > result.pathsUsed);
+        REQUIRE(plain.varianceReductionRatio == Catch::Approx(1.0).margin(0.05));
+    }
+}
+
+TEST_CASE("Trajectoires : barrière désactivante continue et parité in/out", "[MonteCarloModel]") {
+    const double S = 100.0, K = 100.0, r = 0.05, sigma = 0.2, T = 1.0, B = 90.0;
+    Option option(S, K, r, sigma, T, "call");
+
+    // Down-and-out call, B <= K (Reiner-Rubinstein) : C - C_di
+    const double lambda = (r + 0.5 * sigma * sigma) / (sigma * sigma);
+    const double y = std::log(B * B / (S * K)) / (sigma * std::sqrt(T)) + lambda * sigma * std::sqrt(T);
+    const auto N = [](double x) { return 0.5 * std::erfc(-x / std::sqrt(2.0)); };
+    const double downIn = S * std::pow(B / S, 2.0 * lambda) * N(y) -
+                          K * std::exp(-r * T) * std::pow(B / S, 2.0 * lambda - 2.0) * N(y - sigma * std::sqrt(T));
+    const double vanilla = BlackScholesModel().calculatePrice(option);
+
+    MonteCarloModel model(200000, 11);
+    PathDependentPayoff payoff;
+    payoff.product = PathProduct::BarrierDownAndOut;
+    payoff.barrier = B;
+    payoff.monitoringDates = 25;
+    const MonteCarloResult out = model.simulatePathDependent(option, payoff);
+    REQUIRE(out.price == Catch::Approx(vanilla - downIn).margin(4.0 * out.standardError));
+
+    // Sans correction, la surveillance discrète surestime le prix
+    payoff.continuousMonitoring = false;
+    REQUIRE(model.simulatePathDependent(option, payoff).price > out.price + 4.0 * out.standardError);
+
+    payoff.continuousMonitoring = true;
+    payoff.product = PathProduct::BarrierDownAndIn;
+    const MonteCarloResult in = model.simulatePathDependent(option, payoff);
+    REQUIRE(in.price == Catch::Approx(downIn).margin(4.0 * in.standardError));
+    REQUIRE(in.price + out.price == Catch::Approx(vanilla).margin(4.0 * (in.standardError + out.standardError)));
+}
+
+TEST_CASE("Trajectoires : asiatique, lookback et reproductibilité", "[MonteCarloModel]") {
+    Option option(100.0, 100.0, 0.03, 0.3, 1.0, "put");
+
+    // Un seul fixing : l'asiatique est l'option européenne, mêmes tirages
+    MonteCarloModel model(20000, 5);
+    PathDependentPayoff payoff;
+    payoff.monitoringDates = 1;
+    REQUIRE(model.simulatePathDependent(option, payoff).price ==
+            Catch::Approx(model.calculatePrice(option)).epsilon(1e-12));
+
+    // La moyenne réduit la volatilité : asiatique moins chère que l'européenne
+    payoff.monitoringDates = 52;
+    const MonteCarloResult asian = model.simulatePathDependent(option, payoff);
+    REQUIRE(asian.price < BlackScholesModel().calculatePrice(option));
+
+    // Sobol + pont brownien : même prix, erreur standard plus faible
+    MonteCarloModel qmc(20000, SamplingMethod::Sobol);
+    const MonteCarloResult asianQmc = qmc.simulatePathDependent(option, payoff);
+    REQUIRE(asianQmc.price == Catch::Approx(asian.price).margin(4.0 * asian.standardError));
+    REQUIRE(asianQmc.standardError < 0.5 * asian.standardError);
+
+    // Lookback à strike flottant : toujours positif, indépendant du nombre de threads
+    payoff.product = PathProduct::LookbackFloating;
+    const int previousThreads = omp_get_max_threads();
+    omp_set_num_threads(1);
+    const double singleThread = model.simulatePathDependent(option, payoff).price;
+    omp_set_num_threads(3);
+    const double threeThreads = model.simulatePathDependent(option, payoff).price;
+    omp_set_num_threads(previousThreads);
+    REQUIRE(singleThread == threeThreads);
+    REQUIRE(singleThread > 0.0);
+
+    payoff.product = PathProduct::BarrierUpAndOut;
+    payoff.barrier = 0.0;
+    REQUIRE_THROWS_AS(model.simulatePathDependent(option, payoff), std::invalid_argument);
+}
+
+TEST_CASE("Greeks Monte Carlo trajectoriels sur une seule simulation", "[MonteCarloModel]") {
+    BlackScholesModel bs;
+    MonteCarloModel model(400000, 21);
+    for (const std::string type : {"call", "put"}) {
+        Option option(100.0, 110.0, 0.04, 0.3, 0.75, type);
+        const Greeks exact = bs.calculateGreeks(option);
+        const MonteCarloGreeks mc = model.simulateGreeks(option);
+
+        // Même tirages que le prix
+        REQUIRE(mc.value.price == Catch::Approx(model.calculatePrice(option)).epsilon(1e-12));
+
+        REQUIRE(mc.value.delta == Catch::Approx(exact.delta).margin(4.0 * mc.standardError.delta));
+        REQUIRE(mc.value.gamma == Catch::Approx(exact.gamma).margin(4.0 * mc.standardError.gamma));
+        REQUIRE(mc.value.vega == Catch::Approx(exact.vega).margin(4.0 * mc.standardError.vega));
+        REQUIRE(mc.value.theta == Catch::Approx(exact.theta).margin(4.0 * mc.standardError.theta));
+        REQUIRE(mc.value.rho == Catch::Approx(exact.rho).margin(4.0 * mc.standardError.rho));
+
+        REQUIRE(mc.standardError.delta > 0.0);
+        REQUIRE(mc.standardError.delta < 5e-3);
+        REQUIRE(mc.pathsUsed == 400000);
+    }
+}
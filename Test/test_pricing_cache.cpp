@@ -0,0 +1,327 @@
+#include <catch2/catch_all.hpp>
+
+#include "../include/util/PricingCache.hpp"
+#include "../include/util/BatchPricer.hpp"
+#include "../include/util/GreeksCalculator.hpp"
+#include "../include/models/CachedPricingModel.hpp"
+#include "../include/models/BinomialModel.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+std::string temporaryPath(const std::string& name) {
+    const std::string path = (std::filesystem::temp_directory_path() / ("test_pricing_cache_" + name)).string();
+    std::filesystem::remove(path);
+    return path;
+}
+
+OptionSpec optionNumber(int i) {
+    return OptionSpec{80.0 + i * 0.5, 100.0, 0.03, 0.2, 1.0, i % 2 ? OptionType::Call : OptionType::Put};
+}
+
+} // namespace
+
+TEST_CASE("Cache de résultats : quantification, partage du fichier et remplacement LRU", "[PricingCache]") {
+    const std::string path = temporaryPath("table.bin");
+    CacheSettings settings;
+    settings.capacity = 8;
+    PricingCache writer(path, settings);
+    PricingCache reader(path);  // Deuxième projection du même fichier, comme un autre processus
+    REQUIRE(reader.stats().capacity == 8);
+
+    const std::uint64_t model = writer.modelId("Binomial:steps=501");
+    REQUIRE(model == reader.modelId("Binomial:steps=501"));
+    REQUIRE(model != writer.modelId("Binomial:steps=201"));
+
+    // Requêtes presque identiques : même clé, option ramenée sur la même grille
+    CacheKey key, near, far;
+    const OptionSpec option{100.0, 100.0, 0.05, 0.2, 1.0, OptionType::Put};
+    REQUIRE(writer.makeKey(model, option, key));
+    REQUIRE(reader.makeKey(model, option.withSpot(100.0 * (1 + 1e-12)).withRate(0.05 + 1e-13), near));
+    REQUIRE(reader.makeKey(model, option.withSpot(100.01), far));
+    REQUIRE(key.hash == near.hash);
+    REQUIRE(key.option.spot == near.option.spot);
+    REQUIRE(key.option.spot == Catch::Approx(100.0).epsilon(1e-9));
+    REQUIRE(key.hash != far.hash);
+    REQUIRE_FALSE(writer.makeKey(model, option.withVol(-0.2), far));
+
+    double price = 0.0;
+    REQUIRE_FALSE(reader.findPrice(near, price));
+    writer.storePrice(key, 5.57);
+    REQUIRE(reader.findPrice(near, price));
+    REQUIRE(price == 5.57);
+
+    // Une entrée de prix ne sert pas une demande de Greeks ; l'entrée complète sert les deux
+    Greeks g;
+    REQUIRE_FALSE(reader.findGreeks(key, g));
+    Greeks stored;
+    stored.price = 5.58;
+    stored.delta = -0.36;
+    stored.charm = 0.06;
+    writer.storeGreeks(key, stored);
+    REQUIRE(reader.findGreeks(key, g));
+    REQUIRE(g.delta == -0.36);
+    REQUIRE(g.charm == 0.06);
+    REQUIRE(reader.findPrice(key, price));
+    REQUIRE(price == 5.58);
+
+    CacheStats stats = reader.stats();
+    REQUIRE(stats.entries == 1);
+    REQUIRE(stats.hits == 3);
+    REQUIRE(stats.misses == 2);
+    REQUIRE(stats.inserts == 2);
+    REQUIRE(stats.hitRate() == Catch::Approx(3.0 / 5.0));
+
+    // Table pleine : l'entrée la moins récemment utilisée est remplacée
+    CacheKey keys[9];
+    for (int i = 0; i < 9; ++i) {
+        REQUIRE(writer.makeKey(model, optionNumber(i), keys[i]));
+    }
+    for (int i = 0; i < 7; ++i) {
+        writer.storePrice(keys[i], i);
+    }
+    REQUIRE(writer.findPrice(key, price));
+    writer.storePrice(keys[7], 7.0);
+    REQUIRE(writer.stats().evictions == 1);
+    REQUIRE(writer.stats().entries == 8);
+    REQUIRE(writer.findPrice(key, price));
+    REQUIRE_FALSE(writer.findPrice(keys[0], price));
+    REQUIRE(writer.findPrice(keys[7], price));
+    REQUIRE(price == 7.0);
+
+    writer.clear();
+    REQUIRE_FALSE(reader.findPrice(keys[7], price));
+    REQUIRE(reader.stats().entries == 0);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Cache de résultats : un fichier qui n'est pas un cache est laissé intact", "[PricingCache]") {
+    const std::string path = temporaryPath("book.csv");
+    const std::string content = "id,spot,strike,rate,volatility,maturity,type\n1,100,100,0.05,0.2,1,put\n";
+    {
+        std::ofstream file(path);
+        file << content;
+    }
+    REQUIRE_THROWS_AS(PricingCache(path), std::runtime_error);
+    REQUIRE(std::filesystem::file_size(path) == content.size());
+    std::ifstream file(path);
+    const std::string read((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    REQUIRE(read == content);
+
+    // Fichier vide (créé d'avance, mktemp) : devient un cache
+    const std::string empty = temporaryPath("empty.bin");
+    std::ofstream(empty).close();
+    PricingCache cache(empty);
+    REQUIRE(cache.stats().capacity > 0);
+    std::filesystem::remove(path);
+    std::filesystem::remove(empty);
+}
+
+TEST_CASE("Cache de résultats : une autre version est remplacée sans être tronquée", "[PricingCache]") {
+    const std::string path = temporaryPath("version.bin");
+    CacheSettings settings;
+    settings.capacity = 8;
+    PricingCache previous(path, settings);
+    CacheKey key;
+    REQUIRE(previous.makeKey(previous.modelId("BlackScholes"), optionNumber(1), key));
+    previous.storePrice(key, 4.25);
+
+    // Fichier laissé par une autre version du format, toujours projeté par 'previous'
+    const std::uint32_t otherVersion = 999;
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(8);
+        file.write(reinterpret_cast<const char*>(&otherVersion), sizeof(otherVersion));
+    }
+    const std::uintmax_t size = std::filesystem::file_size(path);
+
+    PricingCache current(path, settings);
+    double price = 0.0;
+    REQUIRE_FALSE(current.findPrice(key, price));
+    current.storePrice(key, 5.5);
+    // L'ancien fichier n'a pas été tronqué : son utilisateur le lit toujours, sans voir le nouveau
+    REQUIRE(previous.findPrice(key, price));
+    REQUIRE(price == 4.25);
+    REQUIRE(std::filesystem::file_size(path) == size);
+    REQUIRE(PricingCache(path, settings).findPrice(key, price));
+    REQUIRE(price == 5.5);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Cache de résultats : une entrée abandonnée par un écrivain mort est reprise", "[PricingCache]") {
+    const std::string path = temporaryPath("abandoned.bin");
+    CacheSettings settings;
+    settings.capacity = 8;
+    PricingCache cache(path, settings);
+    const std::uint64_t model = cache.modelId("BlackScholes");
+    CacheKey keys[9];
+    for (int i = 0; i < 9; ++i) {
+        REQUIRE(cache.makeKey(model, optionNumber(i), keys[i]));
+    }
+    for (int i = 0; i < 8; ++i) {
+        cache.storePrice(keys[i], i);
+    }
+    REQUIRE(cache.stats().entries == 8);
+
+    // Écrivain mort entre les deux incréments de version : l'entrée reste impaire
+    constexpr std::uint64_t slotBytes = 192;
+    const std::uint64_t slots = std::filesystem::file_size(path) - 8 * slotBytes;
+    auto version = [&](std::fstream& file, int slot) {
+        std::uint64_t value = 0;
+        file.seekg(static_cast<std::streamoff>(slots + slot * slotBytes));
+        file.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return value;
+    };
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        const std::uint64_t odd = version(file, 3) + 1;
+        file.seekp(static_cast<std::streamoff>(slots + 3 * slotBytes));
+        file.write(reinterpret_cast<const char*>(&odd), sizeof(odd));
+    }
+    int lost = -1;
+    double price = 0.0;
+    for (int i = 0; i < 8; ++i) {
+        if (!cache.findPrice(keys[i], price)) {
+            REQUIRE(lost == -1);
+            lost = i;
+        }
+    }
+    REQUIRE(lost >= 0);
+
+    // Plus d'une génération d'accès plus tard, l'entrée abandonnée est la plus ancienne : reprise
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 8; ++i) {
+            cache.findPrice(keys[i], price);
+        }
+    }
+    cache.storePrice(keys[8], 8.0);
+    REQUIRE(cache.findPrice(keys[8], price));
+    REQUIRE(price == 8.0);
+    for (int i = 0; i < 8; ++i) {
+        REQUIRE(cache.findPrice(keys[i], price) == (i != lost));
+    }
+    std::fstream file(path, std::ios::in | std::ios::binary);
+    for (int slot = 0; slot < 8; ++slot) {
+        REQUIRE(version(file, slot) % 2 == 0);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Cache de résultats : écritures concurrentes de plusieurs processus", "[PricingCache]") {
+    const std::string path = temporaryPath("processes.bin");
+    CacheSettings settings;
+    settings.capacity = 64;
+    PricingCache cache(path, settings);
+    const std::uint64_t model = cache.modelId("MonteCarlo");
+
+    // Quatre processus écrivent (et remplacent) en même temps : chaque entrée lue doit être intacte
+    const int writers = 4;
+    pid_t children[writers];
+    for (int w = 0; w < writers; ++w) {
+        children[w] = ::fork();
+        if (children[w] == 0) {
+            PricingCache child(path);
+            for (int round = 0; round < 200; ++round) {
+                for (int i = 0; i < 100; ++i) {
+                    CacheKey key;
+                    child.makeKey(model, optionNumber(i), key);
+                    Greeks g;
+                    g.price = i;
+                    g.delta = i * 0.5;
+                    g.charm = -i;
+                    child.storeGreeks(key, g);
+                }
+            }
+            ::_exit(0);
+        }
+    }
+
+    std::size_t hits = 0;
+    bool consistent = true;
+    for (int round = 0; round < 200; ++round) {
+        for (int i = 0; i < 100; ++i) {
+            CacheKey key;
+            cache.makeKey(model, optionNumber(i), key);
+            Greeks g;
+            if (cache.findGreeks(key, g)) {
+                ++hits;
+                consistent = consistent && g.price == i && g.delta == i * 0.5 && g.charm == -i;
+            }
+        }
+    }
+    for (pid_t child : children) {
+        int status = 0;
+        ::waitpid(child, &status, 0);
+        REQUIRE(WIFEXITED(status));
+    }
+    REQUIRE(consistent);
+
+    const CacheStats stats = cache.stats();
+    REQUIRE(stats.entries <= 64);
+    REQUIRE(stats.evictions > 0);
+    REQUIRE(stats.hits == hits);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Cache de résultats : modèle enveloppé et portefeuille", "[PricingCache]") {
+    const std::string path = temporaryPath("model.bin");
+    auto cache = std::make_shared<PricingCache>(path);
+    auto binomial = std::make_shared<const BinomialModel>(301, ExerciseStyle::American);
+    const CachedPricingModel cached(binomial, cache, "Binomial:steps=301;american=1");
+    REQUIRE(cached.costHint(OptionSpec{}) == binomial->costHint(OptionSpec{}));
+
+    // Valeur calculée sur l'option ramenée sur la grille, relue telle quelle ensuite
+    const OptionSpec option{95.0, 100.0, 0.04, 0.25, 0.75, OptionType::Put};
+    CacheKey key;
+    REQUIRE(cache->makeKey(cache->modelId("Binomial:steps=301;american=1"), option, key));
+    const double price = cached.calculatePrice(option);
+    REQUIRE(price == binomial->calculatePrice(key.option));
+    REQUIRE(cached.calculatePrice(option) == price);
+
+    const Greeks g = GreeksCalculator::greeks(cached, option);
+    const Greeks expected = GreeksCalculator::greeks(*binomial, key.option);
+    REQUIRE(g.delta == expected.delta);
+    REQUIRE(g.vega == expected.vega);
+    REQUIRE(GreeksCalculator::greeks(cached, option).rho == expected.rho);
+    REQUIRE(cache->stats().hits == 2);
+
+    // Deuxième passage d'un portefeuille : tout est lu dans le cache
+    std::ostringstream csv;
+    csv << "id,spot,strike,rate,volatility,maturity,type,model\n";
+    for (int i = 0; i < 20; ++i) {
+        csv << i << ',' << 90 + i << ",100,0.03,0.2,1,put,Binomial:steps=101;american=1\n";
+        csv << i << ',' << 90 + i << ",100,0.03,0.2,1,call,BlackScholes\n";
+    }
+    BatchSettings settings;
+    settings.cache = cache;
+    std::string first;
+    for (int pass = 0; pass < 2; ++pass) {
+        cache->clear();
+        if (pass == 1) {
+            std::istringstream warm(csv.str());
+            std::ostringstream ignored;
+            BatchPricer(settings).run(warm, ignored);
+        }
+        std::istringstream input(csv.str());
+        std::ostringstream output;
+        BatchPricer pricer(settings);
+        REQUIRE(pricer.run(input, output).failed == 0);
+        if (pass == 0) {
+            first = output.str();
+            REQUIRE(cache->stats().misses == 20);  // Black-Scholes n'est pas mis en cache
+        } else {
+            REQUIRE(output.str() == first);
+            REQUIRE(cache->stats().hits == 20);
+        }
+    }
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,97 @@
+#include <catch2/catch_all.hpp>
+
+#include "../include/util/PricingScheduler.hpp"
+#include "../include/util/GreeksCalculator.hpp"
+#include "../include/models/BlackScholesModel.hpp"
+#include "../include/models/BinomialModel.hpp"
+#include "../include/models/FiniteDifferenceModel.hpp"
+#include "../include/models/MonteCarloModel.hpp"
+#include "../include/models/AmericanOptionPricer.hpp"
+
+#include <cmath>
+#include <vector>
+
+TEST_CASE("Ordonnanceur : portefeuille hétérogène, résultats et durées par tâche", "[PricingScheduler]") {
+    const BlackScholesModel bs;
+    const BinomialModel binomial(301, ExerciseStyle::American);
+    const FiniteDifferenceModel fd(80, 80);
+    const MonteCarloModel mc(1 << 14);
+    const AmericanOptionPricer american(100, 0.01);
+    const std::vector<const OptionPricingModel*> models{&bs, &binomial, &fd, &mc, &american};
+
+    REQUIRE(mc.isInternallyParallel());
+    REQUIRE_FALSE(fd.isInternallyParallel());
+    REQUIRE(binomial.costHint(OptionSpec{}) > bs.costHint(OptionSpec{}));
+
+    std::vector<PricingTask> tasks;
+    for (int i = 0; i < 600; ++i) {
+        const OptionSpec option{90.0 + (i % 21), 100.0, 0.03, 0.15 + 0.01 * (i % 7), 0.5 + 0.25 * (i % 3),
+                                i % 2 ? OptionType::Call : OptionType::Put};
+        // Surtout des formules fermées, quelques modèles coûteux
+        const OptionPricingModel* model = i % 20 == 0 ? models[1 + (i / 20) % 4] : &bs;
+        tasks.push_back({option, model});
+    }
+    tasks.push_back({OptionSpec{100.0, 100.0, 0.03, 0.2, 1.0, OptionType::Put}, nullptr});
+
+    SchedulerSettings settings;
+    settings.threads = 4;
+    PricingScheduler scheduler(settings);
+    REQUIRE(scheduler.calibration(fd) == scheduler.calibration(bs));
+
+    std::vector<PricingTaskResult> results;
+    const SchedulerReport report = scheduler.run(tasks, results);
+
+    REQUIRE(results.size() == tasks.size());
+    REQUIRE(report.failed == 1);
+    REQUIRE(report.threads == 4);
+    REQUIRE(report.chunks > 0);
+    REQUIRE(report.efficiency() > 0.0);
+    REQUIRE(report.efficiency() <= 1.0);
+    for (std::size_t i = 0; i + 1 < tasks.size(); ++i) {
+        REQUIRE(results[i].error.empty());
+        REQUIRE(results[i].greeks.price == tasks[i].model->calculatePrice(tasks[i].option));
+        REQUIRE(results[i].seconds >= 0.0);
+        if (tasks[i].model == &mc) {
+            REQUIRE(results[i].thread == -1);
+        } else {
+            REQUIRE(results[i].thread >= 0);
+            REQUIRE(results[i].thread < 4);
+        }
+    }
+    REQUIRE_FALSE(results.back().error.empty());
+    REQUIRE(std::isnan(results.back().greeks.price));
+
+    // Calibration apprise par modèle : seconde revalorisation identique
+    REQUIRE(scheduler.calibration(fd) != scheduler.calibration(bs));
+    const BinomialModel otherBinomial(301, ExerciseStyle::American);
+    REQUIRE(scheduler.calibration(otherBinomial) != scheduler.calibration(binomial));
+    std::vector<PricingTaskResult> again;
+    scheduler.run(tasks, again);
+    for (std::size_t i = 0; i + 1 < tasks.size(); ++i) {
+        REQUIRE(again[i].greeks.price == results[i].greeks.price);
+    }
+}
+
+TEST_CASE("Ordonnanceur : Greeks et portefeuille vide", "[PricingScheduler]") {
+    const BlackScholesModel bs;
+    const FiniteDifferenceModel fd(60, 60);
+    const OptionSpec option{105.0, 100.0, 0.02, 0.25, 1.0, OptionType::Call};
+
+    SchedulerSettings settings;
+    settings.computeGreeks = true;
+    PricingScheduler scheduler(settings);
+
+    std::vector<PricingTaskResult> results;
+    scheduler.run({{option, &bs}, {option, &fd}}, results);
+    const Greeks analytic = GreeksCalculator::greeks(bs, option);
+    const Greeks grid = GreeksCalculator::greeks(fd, option);
+    REQUIRE(results[0].greeks.delta == analytic.delta);
+    REQUIRE(results[0].greeks.vega == analytic.vega);
+    REQUIRE(results[1].greeks.gamma == grid.gamma);
+    REQUIRE(results[1].greeks.rho == grid.rho);
+
+    const SchedulerReport empty = scheduler.run({}, results);
+    REQUIRE(results.empty());
+    REQUIRE(empty.chunks == 0);
+    REQUIRE_THROWS_AS(PricingScheduler(SchedulerSettings{-1}), std::invalid_argument);
+}
@@ -0,0 +1,246 @@
+#include <catch2/catch_all.hpp>
+
+#include "../include/util/PricingServer.hpp"
+#include "../include/util/PricingService.hpp"
+#include "../include/util/Json.hpp"
+#include "../include/models/BlackScholesModel.hpp"
+#include "../include/models/BinomialModel.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+double number(const JsonValue& object, const std::string& key) {
+    const JsonValue* value = object.find(key);
+    REQUIRE(value != nullptr);
+    REQUIRE(value->isNumber());
+    return value->number;
+}
+
+std::string text(const JsonValue& object, const std::string& key) {
+    const JsonValue* value = object.find(key);
+    REQUIRE(value != nullptr);
+    REQUIRE(value->isString());
+    return value->string;
+}
+
+std::size_t processThreads() {
+    const std::filesystem::directory_iterator tasks("/proc/self/task");
+    return static_cast<std::size_t>(std::distance(tasks, std::filesystem::directory_iterator()));
+}
+
+// Les threads de connexion détachés se terminent peu après la fermeture du client
+bool waitForThreads(std::size_t expected) {
+    for (int i = 0; i < 200 && processThreads() != expected; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return processThreads() == expected;
+}
+
+} // namespace
+
+TEST_CASE("JSON : lecture, écriture et erreurs", "[PricingServer]") {
+    const JsonValue value = parseJson(R"( {"a": [1, -2.5e3, true, null], "b": "x\"é\n", "c": {}} )");
+    REQUIRE(value.isObject());
+    REQUIRE(value.find("a")->values.size() == 4);
+    REQUIRE(value.find("a")->values[1].number == -2500.0);
+    REQUIRE(value.find("b")->string == "x\"\xc3\xa9\n");
+    REQUIRE(value.find("missing") == nullptr);
+
+    std::string out;
+    appendJson(out, value);
+    REQUIRE(out == R"({"a":[1,-2500,true,null],"b":"x\")" "\xc3\xa9" R"(\n","c":{}})");
+
+    REQUIRE_THROWS_AS(parseJson("{\"a\": 1,}"), std::invalid_argument);
+    REQUIRE_THROWS_AS(parseJson("[01]"), std::invalid_argument);
+    REQUIRE_THROWS_AS(parseJson("{} {}"), std::invalid_argument);
+}
+
+TEST_CASE("Service de pricing : requêtes simples, lots et erreurs", "[PricingServer]") {
+    PricingService service;
+    const OptionSpec put{100.0, 100.0, 0.05, 0.2, 1.0, OptionType::Put};
+
+    JsonValue reply = parseJson(service.handle(
+        R"({"id": 7, "spot": 100, "strike": 100, "rate": 0.05, "volatility": 0.2, "maturity": 1, "type": "put", "greeks": true})"));
+    REQUIRE(number(reply, "id") == 7);
+    REQUIRE(text(reply, "status") == "ok");
+    REQUIRE(number(reply, "price") == Catch::Approx(BlackScholesModel().calculatePrice(put)).epsilon(1e-12));
+    REQUIRE(number(reply, "vega") == Catch::Approx(37.524).epsilon(1e-4));
+
+    // Lot : modèle par défaut du lot, modèle propre à une option, option invalide
+    reply = parseJson(service.handle(
+        R"({"id": "book", "model": "Binomial:steps=201;american=1", "options": [)"
+        R"({"id": 1, "spot": 100, "strike": 100, "rate": 0.05, "volatility": 0.2, "maturity": 1, "type": "put"},)"
+        R"({"id": 2, "spot": 100, "strike": 100, "rate": 0.05, "volatility": 0.2, "maturity": 1, "type": "put", "model": "BlackScholes"},)"
+        R"({"id": 3, "spot": 100, "strike": 100, "rate": 0.05, "volatility": 0.2, "maturity": 1, "type": "straddle"}]})"));
+    REQUIRE(text(reply, "id") == "book");
+    REQUIRE(number(reply, "failed") == 1);
+    const JsonValue& results = *reply.find("results");
+    REQUIRE(results.values.size() == 3);
+    REQUIRE(number(results.values[0], "price") == BinomialModel(201, ExerciseStyle::American).calculatePrice(put));
+    REQUIRE(number(results.values[1], "price") == BlackScholesModel().calculatePrice(put));
+    REQUIRE(results.values[1].find("delta") == nullptr);
+    REQUIRE(text(results.values[2], "status") == "error");
+    REQUIRE(number(results.values[2], "id") == 3);
+
+    // Requêtes invalides : une réponse d'erreur, jamais d'exception
+    for (const std::string bad : {"not json", "[1, 2]", R"({"id": 4, "spot": 100})",
+                                  R"({"id": 5, "spot": 100, "strike": 100, "rate": 0.05, "volatility": 0.2, "maturity": 1, "type": "put", "model": "Nope"})",
+                                  R"({"command": "reboot"})"}) {
+        reply = parseJson(service.handle(bad));
+        REQUIRE(text(reply, "status") == "error");
+        REQUIRE_FALSE(text(reply, "error").empty());
+    }
+    REQUIRE(number(parseJson(service.handle(R"({"id": 4, "spot": 100})")), "id") == 4);
+
+    // Modèles conservés bornés : ceux des requêtes précédentes sont libérés, un lot ne peut dépasser la limite
+    const std::string option = R"("spot": 100, "strike": 100, "rate": 0.05, "volatility": 0.2, "maturity": 1, "type": "put")";
+    for (std::size_t steps = 1; steps <= PricingService::MAX_CACHED_MODELS + 10; ++steps) {
+        reply = parseJson(service.handle("{\"model\": \"Binomial:steps=" + std::to_string(steps + 10) + "\", " + option + "}"));
+        REQUIRE(text(reply, "status") == "ok");
+    }
+    std::string batch = R"({"options": [)";
+    for (std::size_t steps = 1; steps <= PricingService::MAX_CACHED_MODELS + 1; ++steps) {
+        batch += (steps > 1 ? ",{" : "{") + std::string("\"model\": \"Binomial:steps=") + std::to_string(steps + 10) + "\", " + option + "}";
+    }
+    reply = parseJson(service.handle(batch + "]}"));
+    REQUIRE(number(reply, "failed") == 1);
+    REQUIRE(text(reply.find("results")->values.back(), "error").find("distinct models") != std::string::npos);
+
+    const ServiceStats stats = service.stats();
+    REQUIRE(stats.requests == 8 + PricingService::MAX_CACHED_MODELS + 11);
+    REQUIRE(stats.options == 4 + PricingService::MAX_CACHED_MODELS + 10 + PricingService::MAX_CACHED_MODELS + 1);
+    REQUIRE(stats.failed == 8);
+    REQUIRE_FALSE(service.shutdownRequested());
+    REQUIRE(text(parseJson(service.handle(R"({"command": "shutdown"})")), "status") == "ok");
+    REQUIRE(service.shutdownRequested());
+}
+
+TEST_CASE("Serveur de pricing : socket Unix, connexions simultanées et arrêt", "[PricingServer]") {
+    const std::string path = (std::filesystem::temp_directory_path() / "test_pricing_server.sock").string();
+    PricingService service;
+    ServerSettings settings;
+    settings.socketPath = path;
+    {
+        PricingServer server(settings, service);
+        REQUIRE_THROWS_AS(PricingServer(settings, service), std::runtime_error);  // Adresse déjà servie
+        std::thread loop([&server]() { server.run(); });
+
+        const std::string request =
+            R"({"id": 1, "spot": 100, "strike": 100, "rate": 0.05, "volatility": 0.2, "maturity": 1, "type": "call"})";
+        const double expected = BlackScholesModel().calculatePrice(OptionSpec{100.0, 100.0, 0.05, 0.2, 1.0, OptionType::Call});
+        PricingClient first(path);
+        PricingClient second(path);
+        for (int i = 0; i < 20; ++i) {
+            REQUIRE(number(parseJson((i % 2 ? first : second).request(request)), "price") == expected);
+        }
+        REQUIRE(text(parseJson(first.request("{")), "status") == "error");
+        REQUIRE_THROWS_AS(first.request("{\n}"), std::invalid_argument);
+
+        server.stop();
+        loop.join();
+        REQUIRE(service.stats().requests == 21);
+    }
+    REQUIRE_FALSE(std::filesystem::exists(path));
+    REQUIRE_THROWS_AS(PricingClient(path), std::runtime_error);
+}
+
+TEST_CASE("Serveur de pricing : une seule équipe OpenMP et connexions bornées", "[PricingServer]") {
+    const std::string path = (std::filesystem::temp_directory_path() / "test_pricing_server_pool.sock").string();
+    ServiceSettings serviceSettings;
+    serviceSettings.threads = 4;
+    REQUIRE_THROWS_AS(PricingService([] { ServiceSettings bad; bad.defaultModel = "Nope"; return bad; }()),
+                      std::invalid_argument);
+    PricingService service(serviceSettings);
+    ServerSettings settings;
+    settings.socketPath = path;
+    settings.maxConnections = 2;
+    PricingServer server(settings, service);
+    std::thread loop([&server]() { server.run(); });
+
+    // Monte Carlo et lot ouvrent des régions parallèles : une connexion ouverte
+    // ne coûte que son thread, l'équipe du thread de pricing est réutilisée
+    const std::string option = R"("spot": 100, "strike": 100, "rate": 0.05, "volatility": 0.2, "maturity": 1, "type": "put")";
+    const std::string batch = R"({"options": [{)" + option + "}, {" + option + "}]}";
+    auto exercise = [&](PricingClient& client) {
+        REQUIRE(text(parseJson(client.request(R"({"model": "MonteCarlo:paths=20000;seed=7", )" + option + "}")),
+                     "status") == "ok");
+        REQUIRE(number(parseJson(client.request(batch)), "failed") == 0);
+    };
+    {
+        PricingClient client(path);
+        exercise(client);
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    const std::size_t idle = processThreads();
+    for (int round = 0; round < 3; ++round) {
+        REQUIRE(waitForThreads(idle));
+        PricingClient client(path);
+        exercise(client);
+        REQUIRE(processThreads() == idle + 1);
+    }
+    REQUIRE(waitForThreads(idle));
+
+    // Deux connexions ouvertes : la troisième reçoit une erreur et est fermée
+    const std::string request = "{" + option + "}";
+    PricingClient first(path);
+    PricingClient second(path);
+    REQUIRE(text(parseJson(first.request(request)), "status") == "ok");
+    REQUIRE(text(parseJson(second.request(request)), "status") == "ok");
+    PricingClient third(path);
+    std::string refused;
+    try {
+        refused = text(parseJson(third.request(request)), "error");
+    } catch (const std::runtime_error&) {
+        refused = "too many connections";  // Fermée avant l'envoi de la requête
+    }
+    REQUIRE(refused.find("too many connections") == 0);
+    REQUIRE(processThreads() == idle + 2);
+    REQUIRE(text(parseJson(first.request(request)), "status") == "ok");
+
+    server.stop();
+    loop.join();
+}
+
+TEST_CASE("Serveur de pricing : un client qui ne lit plus ne bloque pas l'arrêt", "[PricingServer]") {
+    const std::string path = (std::filesystem::temp_directory_path() / "test_pricing_server_stall.sock").string();
+    PricingService service;
+    ServerSettings settings;
+    settings.socketPath = path;
+    settings.sendTimeoutMilliseconds = 200;
+    PricingServer server(settings, service);
+    std::thread loop([&server]() { server.run(); });
+
+    // Lot dont la réponse dépasse largement les tampons de la socket, jamais lue
+    std::string batch = R"({"options": [)";
+    for (int i = 0; i < 20000; ++i) {
+        batch += (i > 0 ? ",{" : "{") + std::string(R"("id": )") + std::to_string(i) +
+                 R"(, "spot": 100, "strike": 100, "rate": 0.05, "volatility": 0.2, "maturity": 1, "type": "put"})";
+    }
+    batch += "]}\n";
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+    REQUIRE(::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0);
+    REQUIRE(::send(fd, batch.data(), batch.size(), MSG_NOSIGNAL) == static_cast<ssize_t>(batch.size()));
+    while (service.stats().options < 20000) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // Pendant l'envoi bloqué, les autres clients sont servis ; l'arrêt aboutit
+    PricingClient other(path);
+    REQUIRE(text(parseJson(other.request(R"({"spot": 100, "strike": 100, "rate": 0.05, "volatility": 0.2, "maturity": 1, "type": "put"})")),
+                 "status") == "ok");
+    server.stop();
+    loop.join();
+    ::close(fd);
+}
@@ -0,0 +1,144 @@
+#include <catch2/catch_all.hpp>
+
+#include "../include/util/ScenarioGrid.hpp"
+#include "../include/util/GreeksCalculator.hpp"
+#include "../include/util/ColumnarFile.hpp"
+#include "../include/models/BlackScholesModel.hpp"
+#include "../include/models/FiniteDifferenceModel.hpp"
+
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Puits qui conserve tous les points, dans l'ordre reçu
+class CollectingSink : public ScenarioSink {
+public:
+    void write(const ScenarioPoint* points, std::size_t count) override {
+        this->points.insert(this->points.end(), points, points + count);
+        ++blocks;
+    }
+    std::vector<ScenarioPoint> points;
+    int blocks = 0;
+};
+
+// Modèle qui échoue au-delà d'un spot
+class FailingModel : public OptionPricingModel {
+public:
+    double calculatePrice(const OptionSpec& option) const override {
+        if (option.spot > 120.0) {
+            throw std::domain_error("spot trop élevé");
+        }
+        return option.spot;
+    }
+};
+
+} // namespace
+
+TEST_CASE("Grille de scénarios : axes, ordre et indépendance du nombre de threads", "[ScenarioGrid]") {
+    const std::vector<double> spots = ScenarioAxes::linspace(50.0, 150.0, 101);
+    REQUIRE(spots.size() == 101);
+    REQUIRE(spots.front() == 50.0);
+    REQUIRE(spots[50] == 100.0);
+    REQUIRE(spots.back() == 150.0);
+    REQUIRE(ScenarioAxes::linspace(0.2, 0.4, 1) == std::vector<double>{0.2});
+    REQUIRE_THROWS_AS(ScenarioAxes::linspace(0.2, 0.4, 0), std::invalid_argument);
+
+    const OptionSpec option{100.0, 100.0, 0.05, 0.2, 1.0, OptionType::Call};
+    ScenarioAxes axes;
+    axes.spots = ScenarioAxes::linspace(80.0, 120.0, 5);
+    axes.volatilities = {0.1, 0.3};
+    axes.maturities = {0.5, 1.0, 2.0};
+    // Taux absent : celui de l'option
+
+    const BlackScholesModel model;
+    ScenarioSettings settings;
+    settings.blockPoints = 7;  // Blocs de tranches entières : une tranche (5 spots) par bloc
+    CollectingSink sink;
+    const ScenarioReport report = ScenarioGridEngine(settings).run(model, option, axes, sink);
+    REQUIRE(report.points == 30);
+    REQUIRE(report.slices == 6);
+    REQUIRE(report.solves == 0);
+    REQUIRE(sink.blocks == 6);
+    REQUIRE(sink.points.size() == 30);
+
+    // Spot le plus rapide, puis volatilité, puis maturité
+    const ScenarioPoint& point = sink.points[1 * 10 + 1 * 5 + 3];
+    REQUIRE(point.option.spot == 110.0);
+    REQUIRE(point.option.volatility == 0.3);
+    REQUIRE(point.option.maturity == 1.0);
+    REQUIRE(point.option.rate == 0.05);
+    const Greeks expected = GreeksCalculator::greeks(model, point.option);
+    REQUIRE(point.greeks.price == expected.price);
+    REQUIRE(point.greeks.vega == expected.vega);
+    REQUIRE(point.greeks.charm == expected.charm);
+
+    std::string outputs[2];
+    for (int threads : {1, 4}) {
+        settings.threads = threads;
+        settings.blockPoints = 16384;
+        std::ostringstream csv;
+        CsvScenarioSink csvSink(csv);
+        ScenarioGridEngine(settings).run(model, option, axes, csvSink);
+        outputs[threads == 1 ? 0 : 1] = csv.str();
+    }
+    REQUIRE(outputs[0] == outputs[1]);
+    REQUIRE(outputs[0].rfind("Spot,Volatility,Maturity,Rate,Price", 0) == 0);
+    REQUIRE(outputs[0].find("\n80,0.1,0.5,0.05,") != std::string::npos);
+}
+
+TEST_CASE("Grille de scénarios : une résolution PDE par tranche", "[ScenarioGrid]") {
+    const FiniteDifferenceModel model(200, 200);
+    const OptionSpec option{100.0, 100.0, 0.03, 0.25, 1.0, OptionType::Put};
+    ScenarioAxes axes = ScenarioAxes::spotProfile(option, 21);
+    axes.volatilities = {0.2, 0.25};
+
+    CollectingSink sink;
+    const ScenarioReport report = ScenarioGridEngine().run(model, option, axes, sink);
+    REQUIRE(report.slices == 2);
+    REQUIRE(report.solves == 10);
+    REQUIRE(sink.points.size() == 42);
+
+    // Le spot de l'option est un noeud de la résolution : mêmes valeurs que GreeksCalculator
+    const ScenarioPoint& atTheMoney = sink.points[21 + 10];
+    REQUIRE(atTheMoney.option.spot == 100.0);
+    REQUIRE(atTheMoney.option.volatility == 0.25);
+    const Greeks expected = GreeksCalculator::greeks(model, option);
+    REQUIRE(atTheMoney.greeks.price == Catch::Approx(expected.price).epsilon(1e-12));
+    REQUIRE(atTheMoney.greeks.delta == Catch::Approx(expected.delta).epsilon(1e-10));
+    REQUIRE(atTheMoney.greeks.vega == Catch::Approx(expected.vega).epsilon(1e-6));
+    REQUIRE(atTheMoney.greeks.rho == Catch::Approx(expected.rho).epsilon(1e-6));
+
+    // Ailleurs sur la plage : proche d'une résolution centrée sur le point
+    const ScenarioPoint& inTheMoney = sink.points[21 + 4];
+    const double reference = model.calculatePrice(inTheMoney.option);
+    REQUIRE(inTheMoney.greeks.price == Catch::Approx(reference).epsilon(1e-3));
+}
+
+TEST_CASE("Grille de scénarios : fichier en colonnes et erreurs du modèle", "[ScenarioGrid]") {
+    const std::string path = (std::filesystem::temp_directory_path() / "test_scenario_grid.opcb").string();
+    const OptionSpec option{100.0, 100.0, 0.05, 0.2, 1.0, OptionType::Put};
+    ScenarioAxes axes = ScenarioAxes::spotProfile(option, 11);
+    axes.rates = {0.0, 0.05};
+    {
+        ColumnarScenarioSink sink(path);
+        ScenarioGridEngine().run(BlackScholesModel(), option, axes, sink);
+        sink.close();
+    }
+    const ColumnarReader reader(path);
+    REQUIRE(reader.rows() == 22);
+    REQUIRE(reader.schema().size() == ColumnarScenarioSink::schema().size());
+    const double* rates = reader.float64(0, reader.columnIndex("rate"));
+    const double* prices = reader.float64(0, reader.columnIndex("price"));
+    REQUIRE(rates[10] == 0.0);
+    REQUIRE(rates[11] == 0.05);
+    REQUIRE(prices[16] == GreeksCalculator::greeks(BlackScholesModel(), option).price);
+    std::filesystem::remove(path);
+
+    CollectingSink sink;
+    REQUIRE_THROWS_AS(ScenarioGridEngine().run(FailingModel(), option, axes, sink), std::domain_error);
+    REQUIRE(sink.points.empty());
+}
@@ -0,0 +1,75 @@
+#include "util/LatticeKernel.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+/**
+ * @brief Benchmark de la remontée d'arbres binomiaux profonds (put américain) :
+ *        niveau par niveau (tileLevels = 1) contre blocage temporel, en ns par
+ *        noeud traité, pour N = 1000 .. 50000.
+ *
+ * Usage : bench_binomial_depth [largeur de tuile] [niveaux par tuile]
+ */
+static double timeNsPerNode(int steps, int tileWidth, int tileLevels, double& price) {
+    const double S = 100.0, K = 100.0, r = 0.05, sigma = 0.2, T = 1.0;
+    const double dt = T / steps;
+    const double u = std::exp(sigma * std::sqrt(dt));
+    const double d = 1.0 / u;
+    const double growth = std::exp(r * dt);
+    const double q = (growth - d) / (u - d);
+
+    LatticeParameters p;
+    p.pu = q / growth;
+    p.pd = (1.0 - q) / growth;
+    p.inverseDown = 1.0 / d;
+    p.strike = K;
+    p.isCall = false;
+
+    std::vector<double> values(steps + 1), spots(steps + 1);
+    std::vector<unsigned char> exercisable(steps + 1, 1);
+    auto run = [&]() {
+        double spot = S * std::pow(d, steps);
+        for (int i = 0; i <= steps; ++i, spot *= u * u) {
+            spots[i] = spot;
+            values[i] = std::max(K - spot, 0.0);
+        }
+        rollbackLattice(steps, 0, p, exercisable.data(), values.data(), spots.data(), tileWidth, tileLevels);
+        price = values[0];
+    };
+
+    // Au moins ~0.2 s de mesure pour chaque profondeur
+    const double nodes = 0.5 * static_cast<double>(steps) * (steps + 1);
+    const int repeats = std::max(1, static_cast<int>(2e7 / nodes));
+    run(); // Échauffement
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int k = 0; k < repeats; ++k) {
+        run();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (nodes * repeats);
+}
+
+int main(int argc, char* argv[]) {
+    const int tileWidth = argc > 1 ? std::stoi(argv[1]) : 2048;
+    const int tileLevels = argc > 2 ? std::stoi(argv[2]) : 32;
+
+    std::cout << "Tuiles: " << tileWidth << " noeuds x " << tileLevels << " niveaux\n"
+              << std::setw(8) << "N" << std::setw(16) << "niveau/niveau" << std::setw(12) << "bloqué"
+              << std::setw(10) << "gain" << std::setw(14) << "prix\n";
+    for (int steps : {1000, 2000, 5000, 10000, 20000, 50000}) {
+        double plain = 0.0, blocked = 0.0;
+        const double nsPlain = timeNsPerNode(steps, tileWidth, 1, plain);
+        const double nsBlocked = timeNsPerNode(steps, tileWidth, tileLevels, blocked);
+        std::cout << std::setw(8) << steps << std::fixed << std::setprecision(3)
+                  << std::setw(13) << nsPlain << " ns" << std::setw(9) << nsBlocked << " ns"
+                  << std::setw(9) << std::setprecision(2) << nsPlain / nsBlocked << "x"
+                  << std::setw(12) << std::setprecision(6) << blocked
+                  << (plain == blocked ? "" : "  (écart !)") << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include "models/BlackScholesModel.hpp"
+#include "domain/OptionBatch.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+/**
+ * @brief Benchmark de débit : pricing option par option (Option + calculatePrice)
+ *        contre les noyaux par lot scalaire et vectorisé.
+ *
+ * Usage : bench_black_scholes_batch [nombre d'options] [répétitions]
+ */
+template<typename F>
+static double timeNsPerOption(F&& f, std::size_t n, int repeats) {
+    f(); // Échauffement
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int k = 0; k < repeats; ++k) {
+        f();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(n) * repeats);
+}
+
+int main(int argc, char* argv[]) {
+    const std::size_t n = argc > 1 ? std::stoul(argv[1]) : 50000;
+    const int repeats = argc > 2 ? std::stoi(argv[2]) : 20;
+
+    // Chaîne d'options aléatoire mais reproductible
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> strikeDist(50.0, 150.0);
+    std::uniform_real_distribution<double> volDist(0.05, 0.8);
+    std::uniform_real_distribution<double> maturityDist(0.02, 5.0);
+    std::uniform_real_distribution<double> rateDist(0.0, 0.08);
+
+    OptionBatch batch;
+    batch.reserve(n);
+    std::vector<Option> options;
+    options.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double K = strikeDist(rng);
+        const double vol = volDist(rng);
+        const double T = maturityDist(rng);
+        const double r = rateDist(rng);
+        const bool call = (i % 2) == 0;
+        batch.add(100.0, K, r, vol, T, call);
+        options.emplace_back(100.0, K, r, vol, T, call ? "call" : "put");
+    }
+
+    BlackScholesModel model;
+    std::vector<double> perOption(n), scalar, simd;
+
+    const double nsPerOption = timeNsPerOption([&]() {
+        for (std::size_t i = 0; i < n; ++i) {
+            perOption[i] = model.calculatePrice(options[i]);
+        }
+    }, n, repeats);
+    const double nsScalar = timeNsPerOption([&]() { model.calculatePricesScalar(batch, scalar); }, n, repeats);
+    const double nsSimd = timeNsPerOption([&]() { model.calculatePrices(batch, simd); }, n, repeats);
+
+    double maxError = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        maxError = std::max(maxError, std::fabs(simd[i] - perOption[i]));
+    }
+
+    std::cout << "Options: " << n << ", répétitions: " << repeats << "\n"
+              << std::fixed << std::setprecision(2)
+              << std::setw(22) << "Option par option:" << std::setw(10) << nsPerOption << " ns/option\n"
+              << std::setw(22) << "Lot scalaire:" << std::setw(10) << nsScalar << " ns/option\n"
+              << std::setw(22) << "Lot vectorisé:" << std::setw(10) << nsSimd << " ns/option"
+              << "  (x" << nsPerOption / nsSimd << ")\n"
+              << std::scientific << std::setprecision(3)
+              << "Écart max vectorisé / option par option: " << maxError << std::endl;
+    return 0;
+}
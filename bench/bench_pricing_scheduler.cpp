@@ -0,0 +1,92 @@
+#include "util/PricingScheduler.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "models/BinomialModel.hpp"
+#include "models/FiniteDifferenceModel.hpp"
+#include "models/MonteCarloModel.hpp"
+#include "models/AmericanOptionPricer.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <map>
+#include <string>
+#include <omp.h>
+
+/**
+ * @brief Benchmark de revalorisation d'un portefeuille hétérogène : boucle
+ *        "omp parallel for schedule(dynamic)" naïve contre PricingScheduler
+ *        (coûts estimés, paquets, vol de travail, Monte Carlo hors du pool).
+ *        Affiche la durée, l'efficacité et la durée moyenne par modèle.
+ *
+ * Usage : bench_pricing_scheduler [nombre d'options] [threads]
+ */
+int main(int argc, char* argv[]) {
+    const int count = argc > 1 ? std::stoi(argv[1]) : 20000;
+    const int threads = argc > 2 ? std::stoi(argv[2]) : omp_get_max_threads();
+
+    const BlackScholesModel bs;
+    const BinomialModel binomial(501, ExerciseStyle::American);
+    const FiniteDifferenceModel fd(200, 200);
+    const MonteCarloModel mc(1 << 16);
+    const AmericanOptionPricer american(200, 0.002);
+    const std::map<const OptionPricingModel*, std::string> names{
+        {&bs, "BlackScholes"}, {&binomial, "Binomial 501"}, {&fd, "FiniteDifference"},
+        {&mc, "MonteCarlo"}, {&american, "American PDE"}};
+
+    // 95 % de formules fermées, le reste réparti entre les modèles numériques
+    std::vector<PricingTask> tasks;
+    for (int i = 0; i < count; ++i) {
+        const OptionSpec option{80.0 + (i % 41), 100.0, 0.03, 0.1 + 0.01 * (i % 31), 0.25 + 0.05 * (i % 37),
+                                i % 2 ? OptionType::Call : OptionType::Put};
+        const OptionPricingModel* model = &bs;
+        if (i % 20 == 0) {
+            const int k = (i / 20) % 20;
+            model = k < 10 ? static_cast<const OptionPricingModel*>(&binomial)
+                  : k < 17 ? static_cast<const OptionPricingModel*>(&fd)
+                  : k < 19 ? static_cast<const OptionPricingModel*>(&american)
+                           : static_cast<const OptionPricingModel*>(&mc);
+        }
+        tasks.push_back({option, model});
+    }
+
+    // Deux passes dans chaque cas : la première remplit les caches des modèles (PDE américain)
+    std::vector<double> naive(tasks.size());
+    const long n = static_cast<long>(tasks.size());
+    double naiveSeconds = 0.0;
+    for (int pass = 0; pass < 2; ++pass) {
+        auto start = std::chrono::high_resolution_clock::now();
+        #pragma omp parallel for schedule(dynamic) num_threads(threads)
+        for (long i = 0; i < n; ++i) {
+            naive[i] = tasks[i].model->calculatePrice(tasks[i].option);
+        }
+        naiveSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    }
+
+    SchedulerSettings settings;
+    settings.threads = threads;
+    PricingScheduler scheduler(settings);
+    std::vector<PricingTaskResult> results;
+    scheduler.run(tasks, results); // Calibration des coûts et caches
+    const SchedulerReport report = scheduler.run(tasks, results);
+
+    std::cout << count << " options, " << threads << " threads\n" << std::fixed << std::setprecision(4)
+              << "  omp parallel for dynamic : " << naiveSeconds << " s\n"
+              << "  PricingScheduler         : " << report.seconds << " s (efficacité "
+              << std::setprecision(1) << 100.0 * report.efficiency() << " %, " << report.chunks << " paquets, "
+              << report.steals << " vols, Monte Carlo " << std::setprecision(4) << report.parallelSeconds << " s)\n";
+
+    std::map<std::string, std::pair<double, int>> perModel;
+    for (std::size_t i = 0; i < tasks.size(); ++i) {
+        auto& entry = perModel[names.at(tasks[i].model)];
+        entry.first += results[i].seconds;
+        entry.second += 1;
+    }
+    std::cout << "  Durée moyenne par tâche :\n";
+    for (const auto& [name, entry] : perModel) {
+        std::cout << "    " << std::setw(18) << std::left << name << std::right << std::setw(8) << entry.second
+                  << " tâches " << std::setw(12) << std::setprecision(2) << 1e6 * entry.first / entry.second
+                  << " us\n";
+    }
+    return 0;
+}
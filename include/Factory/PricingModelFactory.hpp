@@ -2,17 +2,29 @@
 #define PRICING_MODEL_FACTORY_HPP
 
 #include "models/OptionPricingModel.hpp"
+#include <map>
 #include <memory>
 #include <string>
 
+// Paramètres nommés d'un modèle (ex. {"paths", 4096}, {"seed", 42})
+using ModelParameters = std::map<std::string, double>;
+
 class PricingModelFactory {
 public:
     // Méthode statique pour créer un modèle de pricing en fonction du nom
     static std::unique_ptr<OptionPricingModel> createModel(const std::string& modelName);
 
+    // Idem avec des paramètres ; un paramètre inconnu du modèle, ou un paramètre entier
+    // (pas, chemins, graine) non entier ou hors bornes, lance std::invalid_argument
+    static std::unique_ptr<OptionPricingModel> createModel(const std::string& modelName,
+                                                           const ModelParameters& parameters);
+
+    // Modèle décrit par "Nom" ou "Nom:clé=valeur;clé=valeur" (ex. "Binomial:steps=501;american=1")
+    static std::unique_ptr<OptionPricingModel> createModelFromSpec(const std::string& spec);
+
 private:
     // Constructeur privé pour empêcher l'instanciation de la factory
     PricingModelFactory() = delete;
 };
 
-#endif // PRICING_MODEL_FACTORY_HPP
\ No newline at end of file
+#endif // PRICING_MODEL_FACTORY_HPP
@@ -0,0 +1,53 @@
+#ifndef LOCAL_VOLATILITY_SURFACE_HPP
+#define LOCAL_VOLATILITY_SURFACE_HPP
+
+#include "util/CubicSpline.hpp"
+#include <vector>
+
+// Interpolation de la surface entre ses noeuds
+enum class SurfaceInterpolation {
+    Bilinear,  // Linéaire en spot et en temps
+    Spline     // Spline cubique naturelle en spot, linéaire en temps
+};
+
+/**
+ * @class LocalVolatilitySurface
+ * @brief Surface de volatilité locale sigma(S, t) donnée sur une grille
+ *        (spots croissants) x (dates croissantes, en années depuis aujourd'hui).
+ *
+ * volatilities contient une ligne par date : volatilities[j * spots.size() + i]
+ * = sigma(spots[i], times[j]). En dehors de la grille, la surface est
+ * prolongée par sa valeur au bord. Les paramètres sont validés à la
+ * construction (std::invalid_argument).
+ */
+class LocalVolatilitySurface {
+public:
+    LocalVolatilitySurface(std::vector<double> spots, std::vector<double> times, std::vector<double> volatilities,
+                           SurfaceInterpolation interpolation = SurfaceInterpolation::Bilinear);
+
+    // Surface constante, utile comme référence
+    static LocalVolatilitySurface flat(double volatility);
+
+    double volatility(double spot, double time) const;
+
+    // sigma(spots[i], time) pour i = 0..count-1, spots croissants : une seule
+    // recherche de date et un parcours de la grille en spot
+    void sample(double time, const double* spots, int count, double* out) const;
+
+    double maxVolatility() const;
+    SurfaceInterpolation getInterpolation() const;
+    const std::vector<double>& getSpots() const;
+    const std::vector<double>& getTimes() const;
+
+private:
+    // Valeur de la ligne j au spot S (déjà ramené dans la grille), à partir de l'intervalle i
+    double rowValue(int j, int i, double S) const;
+
+    std::vector<double> spots_;
+    std::vector<double> times_;
+    std::vector<double> volatilities_;
+    SurfaceInterpolation interpolation_;
+    std::vector<CubicSpline> rows_;  // Une spline par date (interpolation Spline)
+};
+
+#endif // LOCAL_VOLATILITY_SURFACE_HPP
@@ -1,6 +1,7 @@
 #ifndef OPTION_HPP
 #define OPTION_HPP
 
+#include "domain/OptionSpec.hpp"
 #include <string>
 #include <stdexcept> // Pour std::invalid_argument
 
@@ -8,6 +9,7 @@ class Option {
 public:
     // Constructeur avec validation des paramètres
     Option(double spotPrice, double strikePrice, double riskFreeRate, double volatility, double timeToMaturity, const std::string& type);
+    Option(double spotPrice, double strikePrice, double riskFreeRate, double volatility, double timeToMaturity, OptionType type);
 
     // Destructeur virtuel par défaut
     virtual ~Option() = default;
@@ -19,6 +21,11 @@ public:
     double getVolatility() const;
     double getTimeToMaturity() const;
     std::string getType() const;
+    OptionType getOptionType() const;
+
+    // Représentation compacte utilisée par les modèles (conversion implicite)
+    OptionSpec spec() const;
+    operator OptionSpec() const { return spec(); }
 
 protected:
     // Attributs protégés pour permettre l'héritage
@@ -27,7 +34,7 @@ protected:
     double riskFreeRate_;      // Taux d'intérêt sans risque
     double volatility_;        // Volatilité de l'actif sous-jacent
     double timeToMaturity_;    // Temps restant jusqu'à l'échéance (en années)
-    std::string type_;         // Type d'option : "call" ou "put"
+    OptionType type_;          // Type d'option : call ou put
 };
 
-#endif // OPTION_HPP
\ No newline at end of file
+#endif // OPTION_HPP
@@ -0,0 +1,38 @@
+#ifndef OPTION_BATCH_HPP
+#define OPTION_BATCH_HPP
+
+#include "domain/OptionSpec.hpp"
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct OptionBatch
+ * @brief Lot d'options stocké en colonnes (structure-of-arrays).
+ *
+ * Chaque colonne est contiguë en mémoire afin que les noyaux de pricing
+ * puissent être vectorisés (une option par voie SIMD).
+ */
+struct OptionBatch {
+    std::vector<double> spot;              // Prix du sous-jacent
+    std::vector<double> strike;            // Prix d'exercice
+    std::vector<double> rate;              // Taux sans risque
+    std::vector<double> volatility;        // Volatilité
+    std::vector<double> maturity;          // Temps jusqu'à l'échéance (en années)
+    std::vector<unsigned char> isCall;     // 1 pour un call, 0 pour un put
+
+    // Réserve la mémoire pour n options
+    void reserve(std::size_t n);
+
+    // Ajoute une option au lot (les paramètres sont validés)
+    void add(double spotPrice, double strikePrice, double riskFreeRate,
+             double vol, double timeToMaturity, bool call);
+    void add(const OptionSpec& option);
+
+    // Option à l'indice i
+    OptionSpec spec(std::size_t i) const;
+
+    // Nombre d'options dans le lot
+    std::size_t size() const;
+};
+
+#endif // OPTION_BATCH_HPP
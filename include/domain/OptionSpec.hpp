@@ -0,0 +1,50 @@
+#ifndef OPTION_SPEC_HPP
+#define OPTION_SPEC_HPP
+
+#include <string>
+#include <type_traits>
+
+// Type d'option
+enum class OptionType : unsigned char { Call, Put };
+
+// Conversions texte <-> OptionType ("call" / "put")
+OptionType parseOptionType(const std::string& type); // Lance std::invalid_argument si inconnu
+const char* toString(OptionType type);
+
+/**
+ * @struct OptionSpec
+ * @brief Représentation compacte et trivialement copiable d'une option.
+ *
+ * Utilisée dans les boucles de pricing : pas d'allocation, pas d'appel
+ * virtuel, comparaison de type sur une énumération. Les méthodes with*()
+ * produisent une copie modifiée sans revalidation, pour les bumps des Greeks.
+ * La validation a lieu une seule fois, à la construction de l'Option.
+ */
+struct OptionSpec {
+    double spot;         // Prix actuel de l'actif sous-jacent
+    double strike;       // Prix d'exercice de l'option
+    double rate;         // Taux d'intérêt sans risque
+    double volatility;   // Volatilité de l'actif sous-jacent
+    double maturity;     // Temps restant jusqu'à l'échéance (en années)
+    OptionType type;     // Call ou put
+
+    // Accesseurs aux mêmes noms que ceux d'Option (utilisables dans les templates)
+    double getSpotPrice() const { return spot; }
+    double getStrikePrice() const { return strike; }
+    double getRiskFreeRate() const { return rate; }
+    double getVolatility() const { return volatility; }
+    double getTimeToMaturity() const { return maturity; }
+    OptionType getOptionType() const { return type; }
+    bool isCall() const { return type == OptionType::Call; }
+
+    // Copies modifiées, sans revalidation
+    OptionSpec withSpot(double value) const { OptionSpec s = *this; s.spot = value; return s; }
+    OptionSpec withStrike(double value) const { OptionSpec s = *this; s.strike = value; return s; }
+    OptionSpec withRate(double value) const { OptionSpec s = *this; s.rate = value; return s; }
+    OptionSpec withVol(double value) const { OptionSpec s = *this; s.volatility = value; return s; }
+    OptionSpec withMaturity(double value) const { OptionSpec s = *this; s.maturity = value; return s; }
+};
+
+static_assert(std::is_trivially_copyable<OptionSpec>::value, "OptionSpec doit rester trivialement copiable");
+
+#endif // OPTION_SPEC_HPP
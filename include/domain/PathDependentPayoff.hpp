@@ -0,0 +1,37 @@
+#ifndef PATH_DEPENDENT_PAYOFF_HPP
+#define PATH_DEPENDENT_PAYOFF_HPP
+
+// Produits dépendant de la trajectoire pris en charge par le moteur Monte Carlo
+enum class PathProduct {
+    AsianArithmetic,     // max(A - K, 0) / max(K - A, 0), A = moyenne des fixings
+    LookbackFloating,    // S_T - min / max - S_T
+    LookbackFixed,       // max(max - K, 0) / max(K - min, 0)
+    BarrierUpAndOut,     // Vanille désactivée si S franchit la barrière par le haut
+    BarrierUpAndIn,
+    BarrierDownAndOut,
+    BarrierDownAndIn
+};
+
+/**
+ * @struct PathDependentPayoff
+ * @brief Description d'un produit path-dependent ; le sous-jacent, le strike,
+ *        la maturité et le sens (call/put) viennent de l'OptionSpec.
+ *
+ * Les fixings sont équidistants : t_i = i T / monitoringDates, i = 1..n. Les
+ * extrema des lookbacks incluent S0. Pour une barrière surveillée en continu,
+ * la probabilité de franchissement entre deux dates est corrigée par le pont
+ * brownien ; sinon la barrière n'est observée qu'aux dates de fixing.
+ */
+struct PathDependentPayoff {
+    PathProduct product = PathProduct::AsianArithmetic;
+    int monitoringDates = 12;
+    double barrier = 0.0;
+    bool continuousMonitoring = true;
+
+    bool isBarrier() const {
+        return product == PathProduct::BarrierUpAndOut || product == PathProduct::BarrierUpAndIn ||
+               product == PathProduct::BarrierDownAndOut || product == PathProduct::BarrierDownAndIn;
+    }
+};
+
+#endif // PATH_DEPENDENT_PAYOFF_HPP
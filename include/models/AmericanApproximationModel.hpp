@@ -0,0 +1,55 @@
+#ifndef AMERICAN_APPROXIMATION_MODEL_HPP
+#define AMERICAN_APPROXIMATION_MODEL_HPP
+
+#include "models/OptionPricingModel.hpp"
+#include "models/AmericanOptionPricer.hpp"
+#include "domain/OptionBatch.hpp"
+#include <vector>
+
+// Zone où une approximation analytique est jugée assez précise ; en dehors,
+// le prix est demandé au pricer PDE (si fallbackToPde)
+struct TrustedRegion {
+    double maxMaturity = 2.0;          // Maturité maximale (années)
+    double maxTotalVolatility = 0.5;   // sigma * sqrt(T) maximal
+    double maxLogMoneyness = 1.0;      // |ln(S / K)| maximal
+    bool fallbackToPde = true;         // Sinon, l'approximation est utilisée partout
+    int pdeAssetSteps = 200;           // Configuration du pricer de repli
+    double pdeTimeStep = 0.001;
+};
+
+/**
+ * @class AmericanApproximationModel
+ * @brief Base des approximations analytiques d'options américaines : une
+ *        évaluation en quelques microsecondes dans la zone de confiance,
+ *        le pricer Crank-Nicolson (AmericanOptionPricer) en dehors.
+ *
+ * Sans dividende, le coût de portage b vaut r : le call américain vaut le
+ * call européen et seul le put a une prime d'exercice anticipé.
+ */
+class AmericanApproximationModel : public OptionPricingModel {
+public:
+    explicit AmericanApproximationModel(const TrustedRegion& region);
+
+    double calculatePrice(const OptionSpec& option) const override;
+
+    double costHint(const OptionSpec& option) const override;
+
+    // Lot traité en parallèle ; les options hors zone passent par le PDE
+    void calculatePrices(const OptionBatch& batch, std::vector<double>& prices) const override;
+
+    // Prix de l'approximation seule, sans contrôle de la zone de confiance
+    virtual double approximatePrice(const OptionSpec& option) const = 0;
+
+    bool isTrusted(const OptionSpec& option) const;
+    const TrustedRegion& getTrustedRegion() const;
+
+protected:
+    // Black-Scholes généralisé avec coût de portage b
+    static double europeanPrice(bool isCall, double S, double K, double T, double r, double b, double sigma);
+
+private:
+    TrustedRegion region_;
+    AmericanOptionPricer fallback_;
+};
+
+#endif // AMERICAN_APPROXIMATION_MODEL_HPP
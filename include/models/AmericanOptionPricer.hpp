@@ -2,31 +2,71 @@
 #define AMERICAN_OPTION_PRICER_HPP
 
 #include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include "OptionPricingModel.hpp"
 #include "domain/Option.hpp" // Inclure Option.hpp pour utiliser la classe Option
+#include "domain/OptionSpec.hpp"
+#include "util/CubicSpline.hpp"
 
-class AmericanOptionPricer {
+// Résolution du problème de complémentarité linéaire à chaque pas de temps
+enum class AmericanSolver {
+    BrennanSchwartz,  // Solveur tridiagonal direct, projection pendant la remontée : O(I) et exact
+    ProjectedSOR      // SOR projeté, facteur de relaxation ajusté d'un pas à l'autre
+};
+
+/**
+ * @class AmericanOptionPricer
+ * @brief Option américaine par Crank-Nicolson sur une grille sinh.
+ *
+ * Le constructeur ne fait que stocker la configuration (I, delta_t, solveur) :
+ * les résolutions sont faites à la demande, dans un espace de travail propre
+ * au thread. La grille ne dépend pas du spot : chaque résolution est mémorisée
+ * par contrat (strike, taux, volatilité, maturité, type) et sert à tous les spots.
+ */
+class AmericanOptionPricer : public OptionPricingModel {
 public:
-    AmericanOptionPricer(double S_now, double K, double T, double Vol, double r, int I, double delta_t, std::string optionType);
+    explicit AmericanOptionPricer(int I = 200, double delta_t = 0.001,
+                                  AmericanSolver solver = AmericanSolver::BrennanSchwartz);
+
+    // Pricer lié à une option : Value() la résout au premier appel
+    AmericanOptionPricer(double S_now, double K, double T, double Vol, double r, int I, double delta_t, const std::string& optionType,
+                         AmericanSolver solver = AmericanSolver::BrennanSchwartz);
+    AmericanOptionPricer(double S_now, double K, double T, double Vol, double r, int I, double delta_t, OptionType optionType,
+                         AmericanSolver solver = AmericanSolver::BrennanSchwartz);
 
-    // Méthode pour obtenir le prix de l'option
+    // Méthode pour obtenir le prix de l'option liée au pricer
     double Value() const;
 
     // Méthode pour calculer le prix de l'option (compatible avec les templates)
-    double calculatePrice(const Option& option) const;
+    double calculatePrice(const OptionSpec& option) const override;
 
-    // Destructeur
-    ~AmericanOptionPricer();
+    double costHint(const OptionSpec& option) const override;
+
+    int getAssetSteps() const;
+    double getTimeStep() const;
+    AmericanSolver getSolver() const;
 
 private:
-    // Méthode interne pour calculer le prix de l'option américaine
-    double calculatePriceImpl() const;
+    // Méthode interne : tranche finale de la résolution, interpolée en spot
+    std::shared_ptr<const CubicSpline> solveGrid(const OptionSpec& option) const;
+    static double maxSpot(const OptionSpec& option);
+
+    // Clé de mémorisation : (strike, taux, volatilité, maturité, type)
+    using CacheKey = std::tuple<double, double, double, double, OptionType>;
+    static constexpr std::size_t MAX_CACHED_SOLVES = 256;
 
     // Attributs
-    double S_now, K, T, Vol, r;
-    int I;
-    double delta_t;
-    std::string optionType;
-    double Price; // Ajout de l'attribut Price
+    int I_;
+    double delta_t_;
+    AmericanSolver solver_;
+    bool hasOption_;
+    OptionSpec option_; // Option liée (constructeurs historiques)
+
+    mutable std::mutex cacheMutex_;
+    mutable std::map<CacheKey, std::shared_ptr<const CubicSpline>> cache_;
 };
 
-#endif // AMERICAN_OPTION_PRICER_HPP
\ No newline at end of file
+#endif // AMERICAN_OPTION_PRICER_HPP
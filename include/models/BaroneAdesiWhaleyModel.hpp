@@ -0,0 +1,22 @@
+#ifndef BARONE_ADESI_WHALEY_MODEL_HPP
+#define BARONE_ADESI_WHALEY_MODEL_HPP
+
+#include "models/AmericanApproximationModel.hpp"
+
+/**
+ * @class BaroneAdesiWhaleyModel
+ * @brief Approximation quadratique de Barone-Adesi et Whaley (1987) : prix
+ *        européen plus une prime d'exercice anticipé A (S / S*)^q, le prix
+ *        critique S* étant obtenu par Newton.
+ */
+class BaroneAdesiWhaleyModel : public AmericanApproximationModel {
+public:
+    explicit BaroneAdesiWhaleyModel(const TrustedRegion& region = TrustedRegion());
+
+    double approximatePrice(const OptionSpec& option) const override;
+
+    // Prix critique : exercice immédiat au-dessus (call) ou en dessous (put)
+    double criticalPrice(const OptionSpec& option) const;
+};
+
+#endif // BARONE_ADESI_WHALEY_MODEL_HPP
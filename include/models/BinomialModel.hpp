@@ -3,11 +3,51 @@
 
 #include "models/OptionPricingModel.hpp"
 #include "domain/Option.hpp"
+#include "util/Greeks.hpp"
 
+// Droit d'exercice : à l'échéance, à chaque pas, ou à des dates équiréparties
+enum class ExerciseStyle { European, American, Bermudan };
+
+// Paramétrisation de l'arbre
+enum class LatticeType {
+    CoxRossRubinstein,  // u = e^{sigma sqrt(dt)}, dernier pas lissé par Black-Scholes
+    LeisenReimer        // Inversion de Peizer-Pratt, nombre de pas impair
+};
+
+/**
+ * @class BinomialModel
+ * @brief Arbre binomial recombinant, évalué en place dans un tableau par thread.
+ *
+ * L'actualisation est intégrée aux probabilités (pu = e^{-r dt} q) : la
+ * récurrence ne fait que deux multiplications par noeud. Delta, gamma et theta
+ * sont lus sur les deux premiers niveaux de l'arbre, sans arbre supplémentaire.
+ */
 class BinomialModel : public OptionPricingModel {
 public:
-    BinomialModel();
-    virtual double calculatePrice(const Option& option) const override;
+    explicit BinomialModel(int steps = 201, ExerciseStyle exercise = ExerciseStyle::European,
+                           LatticeType lattice = LatticeType::CoxRossRubinstein, int exerciseDates = 12);
+
+    virtual double calculatePrice(const OptionSpec& option) const override;
+
+    double costHint(const OptionSpec& option) const override;
+
+    // Prix, delta, gamma et theta sur le même arbre (vega et rho restent nuls)
+    Greeks calculateGreeks(const OptionSpec& option) const;
+
+    int getSteps() const;
+    ExerciseStyle getExerciseStyle() const;
+    LatticeType getLatticeType() const;
+    int getExerciseDates() const;
+
+private:
+    // Remonte l'arbre jusqu'à la racine ; si levels n'est pas nul, y écrit les
+    // valeurs et les spots des niveaux 1 et 2 (V10 V11 V20 V21 V22, S10 ... S22)
+    double rollback(const OptionSpec& option, double* levels) const;
+
+    int steps_;
+    ExerciseStyle exercise_;
+    LatticeType lattice_;
+    int exerciseDates_;   // Dates d'exercice bermudéennes (échéance comprise)
 };
 
 #endif // BINOMIAL_MODEL_HPP
@@ -0,0 +1,20 @@
+#ifndef BJERKSUND_STENSLAND_MODEL_HPP
+#define BJERKSUND_STENSLAND_MODEL_HPP
+
+#include "models/AmericanApproximationModel.hpp"
+
+/**
+ * @class BjerksundStenslandModel
+ * @brief Approximation de Bjerksund et Stensland (2002) : stratégie
+ *        d'exercice à deux frontières plates (avant et après t1), d'où une
+ *        borne inférieure fermée du prix américain. Le put est obtenu par la
+ *        transformation put-call P(S, K, r, b) = C(K, S, r - b, -b).
+ */
+class BjerksundStenslandModel : public AmericanApproximationModel {
+public:
+    explicit BjerksundStenslandModel(const TrustedRegion& region = TrustedRegion());
+
+    double approximatePrice(const OptionSpec& option) const override;
+};
+
+#endif // BJERKSUND_STENSLAND_MODEL_HPP
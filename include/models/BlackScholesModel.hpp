@@ -2,14 +2,37 @@
 #define BLACK_SCHOLES_MODEL_HPP
 
 #include "domain/Option.hpp"
+#include "domain/OptionBatch.hpp"
 #include "models/OptionPricingModel.hpp"
 #include "util/MathHelpers.hpp"
+#include "util/Greeks.hpp"
+#include <cstddef>
 #include <string>
+#include <vector>
 
 class BlackScholesModel : public OptionPricingModel {
 public:
     BlackScholesModel();
-    virtual double calculatePrice(const Option& option) const override;
+    virtual double calculatePrice(const OptionSpec& option) const override;
+
+    double costHint(const OptionSpec& option) const override;
+
+    // Prix et Greeks analytiques : d1, d2, N(d1), N(d2) et n(d1) calculés une seule fois
+    Greeks calculateGreeks(const OptionSpec& option) const;
+
+    // Pricing d'un lot avec le noyau vectorisé
+    virtual void calculatePrices(const OptionBatch& batch, std::vector<double>& prices) const override;
+
+    // Pricing d'un lot avec le noyau scalaire (log/exp de la libm), sert de référence
+    void calculatePricesScalar(const OptionBatch& batch, std::vector<double>& prices) const;
+
+    // Noyaux sur tableaux bruts (structure-of-arrays), out doit contenir n éléments
+    static void priceBatchSimd(std::size_t n, const double* spot, const double* strike,
+                               const double* rate, const double* volatility, const double* maturity,
+                               const unsigned char* isCall, double* out);
+    static void priceBatchScalar(std::size_t n, const double* spot, const double* strike,
+                                 const double* rate, const double* volatility, const double* maturity,
+                                 const unsigned char* isCall, double* out);
 };
 
 #endif // BLACK_SCHOLES_MODEL_HPP
@@ -0,0 +1,49 @@
+#ifndef CACHED_PRICING_MODEL_HPP
+#define CACHED_PRICING_MODEL_HPP
+
+#include "models/OptionPricingModel.hpp"
+#include "util/Greeks.hpp"
+#include "util/PricingCache.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/**
+ * @class CachedPricingModel
+ * @brief Modèle enveloppé dans un PricingCache : prix et Greeks sont lus dans
+ *        le fichier partagé s'ils y sont, calculés puis stockés sinon.
+ *
+ * 'description' identifie le modèle et toute sa configuration ; deux modèles
+ * configurés différemment doivent avoir des descriptions différentes (par
+ * exemple "Binomial:steps=501;american=1"). Sur un défaut, le modèle est
+ * appelé sur l'option ramenée sur la grille de quantification du cache (voir
+ * PricingCache) ; une option non quantifiable est pricée sans cache.
+ */
+class CachedPricingModel : public OptionPricingModel {
+public:
+    CachedPricingModel(std::shared_ptr<const OptionPricingModel> model, std::shared_ptr<PricingCache> cache,
+                       const std::string& description);
+
+    double calculatePrice(const OptionSpec& option) const override;
+
+    // GreeksCalculator::greeks du modèle enveloppé, mis en cache
+    Greeks greeks(const OptionSpec& option) const;
+
+    // Ceux du modèle enveloppé (coût d'un défaut de cache)
+    double costHint(const OptionSpec& option) const override;
+    bool isInternallyParallel() const override;
+
+    // Faux pour les formules fermées : les calculer coûte moins qu'une lecture du cache
+    static bool isWorthCaching(const OptionPricingModel& model);
+
+    const OptionPricingModel& getModel() const;
+    const std::string& getDescription() const;
+
+private:
+    std::shared_ptr<const OptionPricingModel> model_;
+    std::shared_ptr<PricingCache> cache_;
+    std::string description_;
+    std::uint64_t modelId_;
+};
+
+#endif // CACHED_PRICING_MODEL_HPP
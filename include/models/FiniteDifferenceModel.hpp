@@ -3,22 +3,81 @@
 
 #include "OptionPricingModel.hpp"
 #include "domain/Option.hpp"
+#include "models/FiniteDifferenceSolution.hpp"
+#include "util/SpotGrid.hpp"
+#include "domain/LocalVolatilitySurface.hpp"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
 
+// Politique de pas de temps : Crank-Nicolson sur timeSteps pas, dont les
+// premiers sont remplacés par des demi-pas implicites (Rannacher) pour amortir
+// le coude du payoff ; extrapolation de Richardson en temps en option
+struct TimeSteppingPolicy {
+    int rannacherSteps = 2;   // Pas CN remplacés chacun par deux demi-pas d'Euler implicite
+    bool richardson = false;  // (4 V(N) - V(N/2)) / 3, au prix d'une résolution et demie
+};
+
+// Surface échantillonnée sur une grille PDE (défini dans FiniteDifferenceModel.cpp)
+struct LocalVolatilityTable;
+
+/**
+ * @class FiniteDifferenceModel
+ * @brief Options européennes par Crank-Nicolson, à volatilité constante ou
+ *        locale.
+ *
+ * Avec une surface de volatilité locale, la volatilité de l'OptionSpec est
+ * ignorée. La grille est alors centrée sur le spot et ne dépend pas du strike.
+ * La surface y est échantillonnée une fois par tranche de temps. Les matrices
+ * de Crank-Nicolson qui en découlent (explicite, et implicite factorisée) sont
+ * rangées dans des tableaux contigus. Ces tables sont mémorisées par
+ * (spot, maturité, S_max, taux, pas de temps) et partagées par toutes les
+ * options d'une même échéance. Une résolution coûte alors autant qu'à
+ * volatilité constante.
+ */
 class FiniteDifferenceModel : public OptionPricingModel {
 public:
-    // Constructeur avec des valeurs par défaut pour les pas de temps et d'actif
-    FiniteDifferenceModel(int timeSteps = 100, int assetSteps = 100);
+    // Constructeur avec des valeurs par défaut pour les pas de temps et d'actif.
+    // Grille sinh par défaut : noeuds resserrés autour du strike, spot sur un noeud
+    FiniteDifferenceModel(int timeSteps = 100, int assetSteps = 100, GridType gridType = GridType::Sinh,
+                          TimeSteppingPolicy timeStepping = TimeSteppingPolicy(),
+                          std::shared_ptr<const LocalVolatilitySurface> localVolatility = nullptr);
 
     // Implémentation de la méthode calculatePrice pour les options européennes
-    virtual double calculatePrice(const Option& option) const override;
+    virtual double calculatePrice(const OptionSpec& option) const override;
+
+    double costHint(const OptionSpec& option) const override;
+
+    // Résolution complète : tranches finale et précédente sur toute la grille,
+    // d'où prix, delta, gamma et theta en n'importe quel spot
+    FiniteDifferenceSolution solve(const OptionSpec& option) const;
 
     // Getters pour les pas de temps et d'actif
     int getAssetSteps() const;
     int getTimeSteps() const;
+    GridType getGridType() const;
+    const TimeSteppingPolicy& getTimeStepping() const;
+    const std::shared_ptr<const LocalVolatilitySurface>& getLocalVolatility() const;
 
 private:
+    // Tables de volatilité locale des résolutions fine et grossière (Richardson), nulles sans surface
+    void localVolatilityTables(const OptionSpec& option, std::shared_ptr<const LocalVolatilityTable>& fine,
+                               std::shared_ptr<const LocalVolatilityTable>& coarse) const;
+    std::shared_ptr<const LocalVolatilityTable> localVolatilityTable(const OptionSpec& option, int timeSteps) const;
+
+    // Clé de mémorisation : (spot, maturité, S_max, taux, pas de temps)
+    using TableKey = std::tuple<double, double, double, double, int>;
+    static constexpr std::size_t MAX_CACHED_TABLES = 32;
+
     int timeSteps_;   // Nombre de pas de temps
     int assetSteps_;  // Nombre de pas pour le prix de l'actif
+    GridType gridType_;
+    TimeSteppingPolicy timeStepping_;
+    std::shared_ptr<const LocalVolatilitySurface> localVolatility_;
+
+    mutable std::mutex cacheMutex_;
+    mutable std::map<TableKey, std::shared_ptr<const LocalVolatilityTable>> tables_;
 };
 
 #endif // FINITE_DIFFERENCE_MODEL_HPP
\ No newline at end of file
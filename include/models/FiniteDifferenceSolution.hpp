@@ -0,0 +1,52 @@
+#ifndef FINITE_DIFFERENCE_SOLUTION_HPP
+#define FINITE_DIFFERENCE_SOLUTION_HPP
+
+#include "domain/OptionSpec.hpp"
+#include "util/CubicSpline.hpp"
+#include "util/Greeks.hpp"
+#include <vector>
+
+/**
+ * @class FiniteDifferenceSolution
+ * @brief Résultat complet d'une résolution PDE : les deux dernières tranches
+ *        de temps sur toute la grille en spot.
+ *
+ * Le prix, la delta et la gamma sont lus sur une spline cubique de la tranche
+ * finale, la theta sur la différence des deux tranches (convention dV/dT du
+ * dépôt). Une seule résolution sert donc tous les spots de la grille.
+ */
+class FiniteDifferenceSolution {
+public:
+    FiniteDifferenceSolution(const OptionSpec& option, std::vector<double> grid,
+                             std::vector<double> values, std::vector<double> previousValues,
+                             double timeStep);
+
+    // Lancent std::out_of_range si le spot sort de la grille
+    double price(double spot) const;
+    double delta(double spot) const;
+    double gamma(double spot) const;
+    double theta(double spot) const;
+
+    // Prix, delta, gamma et theta (vega et rho demandent une autre résolution et restent nuls)
+    Greeks greeks(double spot) const;
+    Greeks greeks() const; // Au spot de l'option résolue
+
+    const OptionSpec& option() const;
+    const std::vector<double>& grid() const;
+    const std::vector<double>& values() const;          // Tranche à maturité T
+    const std::vector<double>& previousValues() const;  // Tranche à T - timeStep
+    double timeStep() const;
+
+private:
+    void checkSpot(double spot) const;
+
+    OptionSpec option_;
+    std::vector<double> grid_;
+    std::vector<double> values_;
+    std::vector<double> previousValues_;
+    double timeStep_;
+    CubicSpline valueSpline_;
+    CubicSpline thetaSpline_;
+};
+
+#endif // FINITE_DIFFERENCE_SOLUTION_HPP
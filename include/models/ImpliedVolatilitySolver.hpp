@@ -0,0 +1,95 @@
+#ifndef IMPLIED_VOLATILITY_SOLVER_HPP
+#define IMPLIED_VOLATILITY_SOLVER_HPP
+
+#include "models/OptionPricingModel.hpp"
+#include "domain/OptionBatch.hpp"
+#include "domain/OptionSpec.hpp"
+#include <cstddef>
+#include <vector>
+
+// Issue de l'inversion d'une cotation
+enum class ImpliedVolStatus : unsigned char {
+    Converged,       // Tolérance atteinte
+    MaxIterations,   // Nombre maximal d'itérations atteint, dernier itéré renvoyé
+    BelowIntrinsic,  // Prix <= valeur intrinsèque : aucune valeur temps
+    AboveMaximum,    // Prix >= borne sans arbitrage (S pour un call, K e^{-rT} pour un put)
+    InvalidInput,    // Spot, strike ou maturité non positifs, prix non fini
+    NoBracket        // Américain : aucun encadrement trouvé dans [minVolatility, maxVolatility]
+};
+
+const char* toString(ImpliedVolStatus status);
+
+struct ImpliedVolResult {
+    double volatility;        // NaN si le statut n'est ni Converged ni MaxIterations
+    ImpliedVolStatus status;
+    int iterations;           // Itérations de Householder, ou évaluations du modèle (américain)
+};
+
+// Résultats d'un lot, en colonnes comme OptionBatch
+struct ImpliedVolBatch {
+    std::vector<double> volatility;
+    std::vector<ImpliedVolStatus> status;
+    std::vector<int> iterations;
+
+    void resize(std::size_t n);
+    std::size_t size() const;
+    std::size_t convergedCount() const;
+    ImpliedVolResult result(std::size_t i) const;
+};
+
+struct ImpliedVolSettings {
+    double tolerance = 1e-12;           // Sur sigma sqrt(T), solveur européen
+    int maxIterations = 10;
+    double americanTolerance = 1e-7;    // Sur sigma, solveur américain
+    int maxAmericanIterations = 60;     // Évaluations du modèle américain
+    double minVolatility = 1e-4;        // Domaine de recherche du solveur américain
+    double maxVolatility = 5.0;
+};
+
+/**
+ * @class ImpliedVolatilitySolver
+ * @brief Inversion de cotations en volatilité implicite, à l'unité ou par lot.
+ *
+ * Européen : la formule de Black-Scholes est réécrite en prix normalisé
+ * b(x, s) avec x = ln(F / K) et s = sigma sqrt(T), ramené à un call hors de la
+ * monnaie par parité. Comme dans "Let's Be Rational" (Jäckel), le point
+ * d'inflexion s_c = sqrt(2 |x|) sépare deux branches ; chacune a une estimation
+ * initiale explicite et un objectif transformé presque linéaire (ln b en bas,
+ * -ln(b_max - b) en haut), résolu par Householder d'ordre 3 avec la vega
+ * analytique et ses deux dérivées. Deux ou trois itérations suffisent en
+ * général. Les prix sont évalués avec erfc et non avec normcdf(), dont
+ * l'erreur (1e-7) limiterait la précision des ailes.
+ *
+ * Américain : le modèle fourni (AmericanOptionPricer, Barone-Adesi-Whaley...)
+ * est inversé par la méthode d'Illinois dans un encadrement. La borne haute
+ * est la volatilité européenne du même prix, puisqu'à volatilité égale
+ * l'américaine vaut au moins l'européenne.
+ *
+ * Les lots sont traités en parallèle (OpenMP). Dans un OptionBatch, la colonne
+ * volatility n'est pas lue.
+ */
+class ImpliedVolatilitySolver {
+public:
+    explicit ImpliedVolatilitySolver(const ImpliedVolSettings& settings = ImpliedVolSettings());
+
+    // Européen : la volatilité de l'OptionSpec est ignorée
+    ImpliedVolResult solve(const OptionSpec& option, double price) const;
+    void solve(const OptionBatch& quotes, const std::vector<double>& prices, ImpliedVolBatch& results) const;
+
+    // Noyau sur tableaux bruts (structure-of-arrays), les sorties contiennent n éléments
+    void solveBatch(std::size_t n, const double* spot, const double* strike, const double* rate,
+                    const double* maturity, const unsigned char* isCall, const double* price,
+                    double* volatility, ImpliedVolStatus* status, int* iterations) const;
+
+    // Américain, par inversion du modèle (qui doit pouvoir être appelé depuis plusieurs threads)
+    ImpliedVolResult solveAmerican(const OptionPricingModel& model, const OptionSpec& option, double price) const;
+    void solveAmerican(const OptionPricingModel& model, const OptionBatch& quotes,
+                       const std::vector<double>& prices, ImpliedVolBatch& results) const;
+
+    const ImpliedVolSettings& getSettings() const;
+
+private:
+    ImpliedVolSettings settings_;
+};
+
+#endif // IMPLIED_VOLATILITY_SOLVER_HPP
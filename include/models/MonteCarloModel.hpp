@@ -3,14 +3,106 @@
 
 #include "models/OptionPricingModel.hpp"
 #include "domain/Option.hpp"
+#include "domain/PathDependentPayoff.hpp"
+#include "util/Greeks.hpp"
+#include <cstdint>
+
+// Tirages pseudo-aléatoires (Philox) ou quasi-aléatoires (Sobol à décalage numérique)
+enum class SamplingMethod { PseudoRandom, Sobol };
+
+// Résultat d'une simulation : prix et erreur standard de l'estimateur
+struct MonteCarloResult {
+    double price = 0.0;
+    double standardError = 0.0;
+    long pathsUsed = 0;
+    // Variance du Monte Carlo brut sur le même nombre de trajectoires / variance obtenue
+    double varianceReductionRatio = 1.0;
+};
+
+// Réglages du mode adaptatif : arrêt dès que l'erreur standard cible ou le
+// budget de temps est atteint
+struct AdaptiveSettings {
+    double targetStandardError = 1e-3;
+    double maxSeconds = 1.0;        // Budget en temps réel
+    long batchPaths = 16384;        // Trajectoires par lot
+    long maxPaths = 100000000;
+    bool antithetic = true;         // Paires (Z, -Z)
+    bool controlVariate = true;     // Sous-jacent actualisé, d'espérance S0
+};
+
+// Prix et Greeks estimés sur les mêmes trajectoires, avec leurs erreurs standard
+// (vanna, volga et charm ne sont pas estimés et restent nuls)
+struct MonteCarloGreeks {
+    Greeks value;
+    Greeks standardError;
+    long pathsUsed = 0;
+};
 
 class MonteCarloModel : public OptionPricingModel {
 public:
-    MonteCarloModel(int numSimulations = 10000);
-    virtual double calculatePrice(const Option& option) const override;
+    static constexpr std::uint64_t DEFAULT_SEED = 0x5EEDCAFEULL;
+    static constexpr int DEFAULT_RANDOMIZATIONS = 16;
+
+    MonteCarloModel(int numSimulations = 10000, std::uint64_t seed = DEFAULT_SEED);
+
+    // Mode quasi Monte Carlo : numSimulations points répartis sur 'randomizations'
+    // décalages numériques indépendants de la suite de Sobol
+    MonteCarloModel(int numSimulations, SamplingMethod sampling,
+                    int randomizations = DEFAULT_RANDOMIZATIONS, std::uint64_t seed = DEFAULT_SEED);
+
+    virtual double calculatePrice(const OptionSpec& option) const override;
+
+    double costHint(const OptionSpec& option) const override;
+
+    // Les trajectoires sont réparties entre les threads OpenMP
+    bool isInternallyParallel() const override;
+
+    // Prix avec une graine explicite : résultat identique au bit près
+    // quel que soit le nombre de threads OpenMP
+    double calculatePrice(const OptionSpec& option, std::uint64_t seed) const;
+
+    // Prix et erreur standard
+    MonteCarloResult simulate(const OptionSpec& option) const;
+    MonteCarloResult simulate(const OptionSpec& option, std::uint64_t seed) const;
+
+    // Simulation par lots jusqu'à l'erreur standard cible (tirages pseudo-aléatoires)
+    MonteCarloResult simulateAdaptive(const OptionSpec& option, const AdaptiveSettings& settings) const;
+
+    // Delta, vega, rho et theta trajectoriels (pathwise), gamma par estimateur
+    // mixte pathwise / rapport de vraisemblance, sur les tirages Philox du prix
+    MonteCarloGreeks simulateGreeks(const OptionSpec& option) const;
+    MonteCarloGreeks simulateGreeks(const OptionSpec& option, std::uint64_t seed) const;
+
+    // Produits path-dependent : trajectoires à monitoringDates dates, simulées
+    // par blocs en mémoire constante (Philox, ou Sobol et pont brownien)
+    MonteCarloResult simulatePathDependent(const OptionSpec& option, const PathDependentPayoff& payoff) const;
+    MonteCarloResult simulatePathDependent(const OptionSpec& option, const PathDependentPayoff& payoff,
+                                           std::uint64_t seed) const;
+
+    int getNumSimulations() const;
+    std::uint64_t getSeed() const;
+    SamplingMethod getSamplingMethod() const;
+    int getRandomizations() const;
 
 private:
+    MonteCarloResult simulatePseudoRandom(const OptionSpec& option, std::uint64_t seed) const;
+    MonteCarloResult simulateSobol(const OptionSpec& option, std::uint64_t seed) const;
+    MonteCarloResult simulatePathsPseudoRandom(const OptionSpec& option, const PathDependentPayoff& payoff,
+                                               std::uint64_t seed) const;
+    MonteCarloResult simulatePathsSobol(const OptionSpec& option, const PathDependentPayoff& payoff,
+                                        std::uint64_t seed) const;
+
+    // Taille des blocs de trajectoires : unité de travail des threads et de la réduction
+    static constexpr int PATH_BLOCK = 1024;
+
+    // Nombre de normales d'un bloc Sobol (dates x trajectoires) : la matrice
+    // des tirages du pont brownien reste dans le cache L2
+    static constexpr int SOBOL_BLOCK_VALUES = 16384;
+
     int numSimulations_; // Number of simulated asset paths
+    std::uint64_t seed_; // Graine du générateur à compteur
+    SamplingMethod sampling_;
+    int randomizations_; // Nombre de décalages de la suite de Sobol
 };
 
 #endif // MONTE_CARLO_MODEL_HPP
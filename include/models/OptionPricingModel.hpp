@@ -2,11 +2,28 @@
 #define OPTION_PRICING_MODEL_HPP
 
 #include "domain/Option.hpp"
+#include "domain/OptionSpec.hpp"
+#include "domain/OptionBatch.hpp"
+#include <vector>
 
 class OptionPricingModel {
 public:
     virtual ~OptionPricingModel() = default;
-    virtual double calculatePrice(const Option& option) const = 0;
+    // Une Option se convertit implicitement en OptionSpec
+    virtual double calculatePrice(const OptionSpec& option) const = 0;
+
+    // Prix d'un lot d'options (par défaut : une option à la fois). Les versions
+    // parallèles ne lancent l'équipe OpenMP qu'au-delà d'un seuil de taille propre
+    // au modèle : en dessous, le coût de création de l'équipe domine
+    virtual void calculatePrices(const OptionBatch& batch, std::vector<double>& prices) const;
+
+    // Coût relatif d'un appel à calculatePrice, en opérations élémentaires
+    // (noeuds mis à jour, trajectoires simulées...) ; sert à ordonner et à
+    // regrouper les tâches d'un portefeuille (PricingScheduler)
+    virtual double costHint(const OptionSpec& option) const;
+
+    // Vrai si calculatePrice ouvre lui-même une région parallèle OpenMP
+    virtual bool isInternallyParallel() const;
 };
 
 #endif // OPTION_PRICING_MODEL_HPP
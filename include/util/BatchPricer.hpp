@@ -0,0 +1,99 @@
+#ifndef BATCH_PRICER_HPP
+#define BATCH_PRICER_HPP
+
+#include "models/OptionPricingModel.hpp"
+#include "util/ColumnarFile.hpp"
+#include "util/PricingCache.hpp"
+#include "util/PricingScheduler.hpp"
+#include <cstddef>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Sensibilités écrites en sortie, dans l'ordre demandé
+enum class GreekColumn { Delta, Gamma, Vega, Theta, Rho };
+
+// "delta", "gamma", "vega", "theta", "rho" ; lance std::invalid_argument sinon
+GreekColumn parseGreekColumn(const std::string& name);
+const char* toString(GreekColumn column);
+
+// Statut d'une ligne dans une sortie binaire (colonne UInt8 "status")
+enum class BatchStatus : unsigned char {
+    Ok = 0,
+    InvalidInput = 1,   // Paramètres non positifs ou non finis, type inconnu
+    PricingError = 2    // Le modèle a lancé une exception
+};
+
+struct BatchSettings {
+    std::size_t chunkRows = 4096;               // Lignes lues, pricées puis écrites ensemble
+    std::vector<GreekColumn> greeks;            // Aucune : prix seul
+    std::string defaultModel = "BlackScholes";  // Sans colonne model, ou cellule vide
+    std::shared_ptr<PricingCache> cache;        // Résultats des modèles coûteux partagés entre exécutions ; nul : aucun
+};
+
+struct BatchSummary {
+    std::size_t rows = 0;     // Lignes de données lues
+    std::size_t failed = 0;   // Lignes en erreur (statut différent de "ok")
+    std::size_t chunks = 0;
+    double seconds = 0.0;
+};
+
+/**
+ * @class BatchPricer
+ * @brief Pricing d'un portefeuille CSV en flux : les lignes sont lues par
+ *        paquets de chunkRows, pricées en parallèle (PricingScheduler) puis écrites dans
+ *        l'ordre d'entrée avant de lire le paquet suivant. La mémoire reste
+ *        bornée quelle que soit la taille du portefeuille.
+ *
+ * Entrée : une ligne d'en-tête, puis une option par ligne. Colonnes requises
+ * (dans n'importe quel ordre) : spot, strike, rate, volatility, maturity, type ;
+ * optionnelles : id (recopié, numéro de ligne sinon) et model. Les autres
+ * colonnes sont ignorées ; les champs ne sont pas entre guillemets.
+ *
+ * model : nom de PricingModelFactory, éventuellement suivi de paramètres,
+ * par exemple "Binomial:steps=501;american=1". Chaque modèle distinct est créé
+ * une seule fois et partagé par tous les threads. Avec un PricingCache, les
+ * modèles plus coûteux qu'une lecture du cache (arbres, PDE, Monte Carlo) y
+ * sont enveloppés, la description du modèle servant d'identifiant.
+ *
+ * Sortie : id,model,price[,greeks...],status. Les nombres sont écrits avec le
+ * moins de chiffres possible qui relisent exactement le même double. Une ligne
+ * invalide reçoit son message d'erreur dans status sans interrompre le flux ;
+ * un en-tête invalide lance std::invalid_argument.
+ *
+ * Les portefeuilles binaires (ColumnarFile) sont lus sans copie : chaque
+ * paquet est pricé directement sur les colonnes projetées en mémoire (noyau
+ * vectorisé de Black-Scholes quand seul le prix est demandé et que tout le
+ * paquet est en Black-Scholes) et les résultats
+ * sont ajoutés au fichier de sortie en colonnes.
+ */
+class BatchPricer {
+public:
+    explicit BatchPricer(const BatchSettings& settings = BatchSettings());
+
+    BatchSummary run(std::istream& input, std::ostream& output);
+
+    // Entrée binaire : colonnes Float64 spot, strike, rate, volatility, maturity,
+    // UInt8 type (1 call, 0 put), Int64 id et Text model facultatives ; sans
+    // colonne model ou pour une cellule vide, defaultModel. Un modèle invalide
+    // donne le statut InvalidInput. 'output' doit avoir le schéma resultSchema().
+    BatchSummary run(const ColumnarReader& input, ColumnarWriter& output);
+
+    // Int64 id, Float64 price, une colonne Float64 par Greek, UInt8 status (BatchStatus)
+    ColumnSchema resultSchema() const;
+
+    const BatchSettings& getSettings() const;
+
+private:
+    // Modèle décrit par 'spec', créé au premier usage ; nul et 'error' renseigné si invalide
+    const OptionPricingModel* model(const std::string& spec, std::string& error);
+
+    BatchSettings settings_;
+    std::map<std::string, std::unique_ptr<OptionPricingModel>> models_;
+    std::map<std::string, std::string> modelErrors_;
+    PricingScheduler scheduler_;  // Sa calibration des coûts s'affine de paquet en paquet
+};
+
+#endif // BATCH_PRICER_HPP
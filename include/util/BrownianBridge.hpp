@@ -0,0 +1,47 @@
+#ifndef BROWNIAN_BRIDGE_HPP
+#define BROWNIAN_BRIDGE_HPP
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class BrownianBridge
+ * @brief Construction d'un mouvement brownien par pont (Jäckel).
+ *
+ * La première normale fixe W(T), la suivante le point milieu, etc. : avec
+ * une suite de Sobol, les premières dimensions (les meilleures) portent
+ * l'essentiel de la variance de la trajectoire.
+ */
+class BrownianBridge {
+public:
+    // Pas de temps uniformes t_i = i T / numSteps, i = 1..numSteps
+    BrownianBridge(int numSteps, double maturity);
+
+    // Dates t_1 < ... < t_n strictement positives et croissantes
+    explicit BrownianBridge(const std::vector<double>& times);
+
+    int numSteps() const;
+
+    // z : numSteps normales indépendantes, w : W(t_1) .. W(t_n)
+    void buildPath(const double* z, double* w) const;
+
+    // z : numSteps normales indépendantes, dw : W(t_i) - W(t_{i-1})
+    void buildIncrements(const double* z, double* dw) const;
+
+    // Version par bloc, vectorisée sur les trajectoires : z et dw sont rangés
+    // par date (z[i * count + p] = normale i de la trajectoire p)
+    void buildIncrements(const double* z, double* dw, std::size_t count) const;
+
+private:
+    void initialize();
+
+    std::vector<double> times_;
+    std::vector<int> bridgeIndex_;
+    std::vector<int> leftIndex_;
+    std::vector<int> rightIndex_;
+    std::vector<double> leftWeight_;
+    std::vector<double> rightWeight_;
+    std::vector<double> stdDev_;
+};
+
+#endif // BROWNIAN_BRIDGE_HPP
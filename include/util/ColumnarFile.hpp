@@ -0,0 +1,155 @@
+#ifndef COLUMNAR_FILE_HPP
+#define COLUMNAR_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Type d'une colonne, toujours de largeur fixe
+enum class ColumnType : std::uint8_t {
+    Float64 = 1,  // double
+    Int64 = 2,    // Identifiants
+    UInt8 = 3,    // Énumérations : type d'option (1 call, 0 put), statut
+    Text = 4      // Chaînes (spécification de modèle) : code uint32 dans la table du bloc
+};
+
+std::size_t columnWidth(ColumnType type);
+
+struct ColumnDescriptor {
+    std::string name;   // 31 octets au plus
+    ColumnType type;
+};
+
+using ColumnSchema = std::vector<ColumnDescriptor>;
+
+/**
+ * Format binaire en colonnes (".opcb"), little-endian. Version 2 : colonnes
+ * Text ; un fichier sans colonne Text est écrit en version 1, que les lecteurs
+ * antérieurs ouvrent encore. Les deux versions sont lues.
+ *
+ *   [en-tête, 64 octets][schéma, 32 octets par colonne][bloc][bloc]...
+ *
+ * L'en-tête contient la signature, la version, le nombre de colonnes, le
+ * nombre de lignes et de blocs validés et la fin des données validées. Un bloc
+ * est un en-tête de 64 octets (nombre de lignes) suivi de chaque colonne,
+ * contiguë ; toutes les sections sont alignées sur 64 octets, si bien qu'une
+ * colonne projetée en mémoire se passe telle quelle aux noyaux vectorisés.
+ * Les colonnes Text contiennent des codes ; les chaînes distinctes du bloc
+ * suivent ses colonnes (longueur sur 4 octets puis octets), chaque bloc
+ * restant ainsi lisible seul.
+ *
+ * L'en-tête n'est mis à jour qu'après l'écriture complète d'un bloc : un
+ * fichier interrompu reste lisible jusqu'à son dernier bloc validé.
+ */
+
+/**
+ * @class ColumnarReader
+ * @brief Lecture sans copie : le fichier est projeté en mémoire (mmap) et les
+ *        colonnes sont lues directement dans la projection. Les pointeurs
+ *        restent valides pendant toute la durée de vie du lecteur.
+ *
+ * Un fichier tronqué, d'une autre version ou incohérent lance std::runtime_error.
+ */
+class ColumnarReader {
+public:
+    explicit ColumnarReader(const std::string& path);
+    ~ColumnarReader();
+
+    ColumnarReader(const ColumnarReader&) = delete;
+    ColumnarReader& operator=(const ColumnarReader&) = delete;
+
+    // Vrai si le fichier commence par la signature du format
+    static bool isColumnarFile(const std::string& path);
+
+    const ColumnSchema& schema() const;
+    int columnIndex(const std::string& name) const;  // -1 si absente
+
+    std::size_t rows() const;
+    std::size_t blockCount() const;
+    std::size_t blockRows(std::size_t block) const;
+
+    // Colonne 'column' du bloc 'block' ; un type différent lance std::logic_error
+    const double* float64(std::size_t block, int column) const;
+    const std::int64_t* int64(std::size_t block, int column) const;
+    const unsigned char* uint8(std::size_t block, int column) const;
+    // Codes d'une colonne Text, tous inférieurs à blockStrings(block).size()
+    const std::uint32_t* text(std::size_t block, int column) const;
+    // Chaînes du bloc, lues dans la projection
+    const std::vector<std::string_view>& blockStrings(std::size_t block) const;
+
+private:
+    const unsigned char* column(std::size_t block, int column, ColumnType expected) const;
+
+    const unsigned char* data_ = nullptr;
+    std::size_t size_ = 0;
+    ColumnSchema schema_;
+    std::size_t rows_ = 0;
+    std::vector<std::size_t> blockOffsets_;
+    std::vector<std::size_t> blockRows_;
+    std::vector<std::vector<std::string_view>> blockStrings_;
+};
+
+enum class WriteMode {
+    Truncate,  // Crée ou remplace le fichier
+    Append     // Ajoute à un fichier existant (même schéma) ou le crée
+};
+
+/**
+ * @class ColumnarWriter
+ * @brief Écriture par ajout : les lignes sont accumulées jusqu'à blockRows
+ *        puis écrites en un bloc. Un ajout d'au moins blockRows lignes sans
+ *        données en attente est écrit directement depuis les colonnes de
+ *        l'appelant, sans copie intermédiaire (sauf schéma avec colonne Text).
+ */
+class ColumnarWriter {
+public:
+    ColumnarWriter(const std::string& path, ColumnSchema schema, WriteMode mode = WriteMode::Truncate,
+                   std::size_t blockRows = 65536);
+    ~ColumnarWriter();
+
+    ColumnarWriter(const ColumnarWriter&) = delete;
+    ColumnarWriter& operator=(const ColumnarWriter&) = delete;
+
+    // 'rows' lignes, un pointeur par colonne du schéma (double*, int64_t*,
+    // unsigned char* ou std::string* pour une colonne Text)
+    void append(std::size_t rows, const void* const* columns);
+
+    // Écrit le bloc en attente et met à jour l'en-tête
+    void flush();
+    void close();
+
+    const ColumnSchema& schema() const;
+    std::size_t rows() const;  // Lignes en attente comprises
+
+private:
+    void writeBlock(std::size_t rows, const void* const* columns);
+    void writeHeader();
+    std::uint32_t textCode(const std::string& value);
+
+    std::fstream file_;
+    ColumnSchema schema_;
+    std::size_t blockRows_;
+    std::vector<std::vector<unsigned char>> pending_;
+    std::size_t pendingRows_ = 0;
+    bool hasText_ = false;
+    std::vector<std::string> pendingStrings_;                       // Table de chaînes du bloc en attente
+    std::unordered_map<std::string, std::uint32_t> pendingCodes_;
+    std::uint64_t rows_ = 0;
+    std::uint64_t blocks_ = 0;
+    std::uint64_t dataEnd_ = 0;
+};
+
+// CSV (ligne d'en-tête obligatoire) vers binaire : la colonne type devient
+// UInt8 ("call" / "put"), id devient Int64, model devient Text, les autres
+// Float64. Renvoie le nombre de lignes.
+std::size_t convertCsvToColumnar(std::istream& csv, const std::string& path, std::size_t blockRows = 65536);
+
+// Binaire vers CSV, nombres écrits au plus court pour une relecture exacte
+std::size_t convertColumnarToCsv(const std::string& path, std::ostream& csv);
+
+#endif // COLUMNAR_FILE_HPP
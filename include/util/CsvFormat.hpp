@@ -0,0 +1,20 @@
+#ifndef CSV_FORMAT_HPP
+#define CSV_FORMAT_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Champ sans espaces, tabulations ni '\r' aux extrémités
+std::string_view trimCsvField(std::string_view text);
+
+// Découpe une ligne sur ',' (champs sans guillemets) ; 'fields' est réutilisé
+void splitCsvLine(std::string_view line, std::vector<std::string_view>& fields);
+
+// Nombre occupant tout le champ, sinon std::invalid_argument mentionnant 'what'
+double parseCsvNumber(std::string_view text, const char* what);
+
+// Ajoute la plus courte écriture de 'value' qui relit exactement le même double
+void appendShortest(std::string& out, double value);
+
+#endif // CSV_FORMAT_HPP
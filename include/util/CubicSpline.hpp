@@ -0,0 +1,47 @@
+#ifndef CUBIC_SPLINE_HPP
+#define CUBIC_SPLINE_HPP
+
+#include "util/TridiagonalSolver.hpp"
+#include <vector>
+
+/**
+ * @class CubicSpline
+ * @brief Spline cubique naturelle (dérivée seconde nulle aux extrémités) sur
+ *        une grille croissante, éventuellement non uniforme.
+ *
+ * La valeur, la dérivée et la dérivée seconde sont continues : les Greeks lus
+ * sur une grille PDE ne présentent pas de sauts d'un intervalle à l'autre.
+ * fit() réutilise les tableaux déjà alloués.
+ */
+class CubicSpline {
+public:
+    CubicSpline() = default;
+    CubicSpline(const std::vector<double>& x, const std::vector<double>& y);
+
+    // n >= 2 noeuds strictement croissants ; lance std::invalid_argument sinon
+    void fit(const double* x, const double* y, int n);
+
+    double value(double x) const;
+    double derivative(double x) const;
+    double secondDerivative(double x) const;
+
+    // Les trois à la fois, une seule recherche d'intervalle
+    void evaluate(double x, double& value, double& first, double& second) const;
+
+    double minX() const;
+    double maxX() const;
+
+private:
+    // Intervalle [x_i, x_{i+1}] contenant x (les extrémités prolongent la spline)
+    int interval(double x) const;
+
+    std::vector<double> x_;
+    std::vector<double> y_;
+    std::vector<double> m_;            // Dérivées secondes aux noeuds
+    std::vector<double> lower_;
+    std::vector<double> diagonal_;
+    std::vector<double> upper_;
+    TridiagonalSolver solver_;
+};
+
+#endif // CUBIC_SPLINE_HPP
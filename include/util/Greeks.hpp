@@ -0,0 +1,25 @@
+#ifndef GREEKS_HPP
+#define GREEKS_HPP
+
+/**
+ * @struct Greeks
+ * @brief Prix et sensibilités d'une option calculés en une seule passe.
+ *
+ * Conventions (identiques à GreeksCalculator) : vega et rho par unité de
+ * volatilité / de taux, theta = dV/dT (dérivée par rapport à la maturité).
+ * Les sensibilités du second ordre valent 0 si le modèle ne les fournit pas.
+ */
+struct Greeks {
+    double price = 0.0;
+    double delta = 0.0;
+    double gamma = 0.0;
+    double vega  = 0.0;
+    double theta = 0.0;
+    double rho   = 0.0;
+
+    double vanna = 0.0;   // d(Delta)/d(sigma)
+    double volga = 0.0;   // d(Vega)/d(sigma)
+    double charm = 0.0;   // d(Delta)/dT
+};
+
+#endif // GREEKS_HPP
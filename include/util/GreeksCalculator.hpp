@@ -2,54 +2,80 @@
 #define GREEKS_CALCULATOR_HPP
 
 #include "domain/Option.hpp"
+#include "domain/OptionSpec.hpp"
+#include "util/Greeks.hpp"
 #include "models/BlackScholesModel.hpp"
 #include "models/FiniteDifferenceModel.hpp"
+#include "models/MonteCarloModel.hpp"
+#include "models/BinomialModel.hpp"
 #include "models/AmericanOptionPricer.hpp" // Inclure AmericanOptionPricer
 
 /**
  * @class GreeksCalculator
  * @brief Classe statique qui propose des méthodes pour calculer 
  *        Delta, Gamma, Vega, Theta, Rho par différences finies.
+ *
+ * Les méthodes acceptent une OptionSpec (une Option s'y convertit
+ * implicitement) : les options bumpées sont des copies sans allocation.
  */
 class GreeksCalculator {
 public:
     // Méthodes templates internes (calculateXXX)
     template<typename Model>
-    static double calculateDelta(const Model& model, const Option& option, double deltaS);
+    static double calculateDelta(const Model& model, const OptionSpec& option, double deltaS);
 
     template<typename Model>
-    static double calculateGamma(const Model& model, const Option& option, double deltaS);
+    static double calculateGamma(const Model& model, const OptionSpec& option, double deltaS);
 
     template<typename Model>
-    static double calculateVega(const Model& model, const Option& option, double deltaSigma);
+    static double calculateVega(const Model& model, const OptionSpec& option, double deltaSigma);
 
     template<typename Model>
-    static double calculateTheta(const Model& model, const Option& option, double deltaT);
+    static double calculateTheta(const Model& model, const OptionSpec& option, double deltaT);
 
     template<typename Model>
-    static double calculateRho(const Model& model, const Option& option, double deltaR);
+    static double calculateRho(const Model& model, const OptionSpec& option, double deltaR);
 
 public:
-    // Méthodes publiques pour Black-Scholes
-    static double delta(const BlackScholesModel& model, const Option& option);
-    static double gamma(const BlackScholesModel& model, const Option& option);
-    static double vega(const BlackScholesModel& model, const Option& option);
-    static double theta(const BlackScholesModel& model, const Option& option);
-    static double rho(const BlackScholesModel& model, const Option& option);
+    // Prix et Greeks Black-Scholes analytiques en une seule passe
+    static Greeks greeks(const BlackScholesModel& model, const OptionSpec& option);
+
+    // Prix et Greeks Monte Carlo sur une seule simulation (estimateurs trajectoriels)
+    static Greeks greeks(const MonteCarloModel& model, const OptionSpec& option);
+
+    // Méthodes publiques pour Black-Scholes (formules fermées)
+    static double delta(const BlackScholesModel& model, const OptionSpec& option);
+    static double gamma(const BlackScholesModel& model, const OptionSpec& option);
+    static double vega(const BlackScholesModel& model, const OptionSpec& option);
+    static double theta(const BlackScholesModel& model, const OptionSpec& option);
+    static double rho(const BlackScholesModel& model, const OptionSpec& option);
+
+    // Prix, delta, gamma et theta lus sur une seule résolution PDE ; vega et rho
+    // par résolutions bumpées (quatre de plus)
+    static Greeks greeks(const FiniteDifferenceModel& model, const OptionSpec& option);
 
     // Méthodes publiques pour FiniteDifferenceModel
-    static double delta(const FiniteDifferenceModel& model, const Option& option);
-    static double gamma(const FiniteDifferenceModel& model, const Option& option);
-    static double vega(const FiniteDifferenceModel& model, const Option& option);
-    static double theta(const FiniteDifferenceModel& model, const Option& option);
-    static double rho(const FiniteDifferenceModel& model, const Option& option);
+    static double delta(const FiniteDifferenceModel& model, const OptionSpec& option);
+    static double gamma(const FiniteDifferenceModel& model, const OptionSpec& option);
+    static double vega(const FiniteDifferenceModel& model, const OptionSpec& option);
+    static double theta(const FiniteDifferenceModel& model, const OptionSpec& option);
+    static double rho(const FiniteDifferenceModel& model, const OptionSpec& option);
+
+    // Prix, delta, gamma et theta lus sur les premiers niveaux de l'arbre ;
+    // vega et rho par arbres bumpés (quatre de plus)
+    static Greeks greeks(const BinomialModel& model, const OptionSpec& option);
+
+    // N'importe quel modèle : méthode dédiée si le type est connu (formules
+    // fermées, lecture sur la grille ou l'arbre, estimateurs trajectoriels,
+    // PricingCache), bump-and-reprice sur calculatePrice sinon
+    static Greeks greeks(const OptionPricingModel& model, const OptionSpec& option);
 
     // Méthodes publiques pour AmericanOptionPricer
-    static double delta(const AmericanOptionPricer& pricer, const Option& option);
-    static double gamma(const AmericanOptionPricer& pricer, const Option& option);
-    static double vega(const AmericanOptionPricer& pricer, const Option& option);
-    static double theta(const AmericanOptionPricer& pricer, const Option& option);
-    static double rho(const AmericanOptionPricer& pricer, const Option& option);
+    static double delta(const AmericanOptionPricer& pricer, const OptionSpec& option);
+    static double gamma(const AmericanOptionPricer& pricer, const OptionSpec& option);
+    static double vega(const AmericanOptionPricer& pricer, const OptionSpec& option);
+    static double theta(const AmericanOptionPricer& pricer, const OptionSpec& option);
+    static double rho(const AmericanOptionPricer& pricer, const OptionSpec& option);
 };
 
 #endif // GREEKS_CALCULATOR_HPP
\ No newline at end of file
@@ -0,0 +1,48 @@
+#ifndef JSON_HPP
+#define JSON_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @struct JsonValue
+ * @brief Valeur JSON lue par parseJson : juste ce qu'il faut pour les requêtes
+ *        du serveur de pricing (objets, tableaux, nombres, chaînes, booléens).
+ *
+ * Les membres d'un objet sont gardés dans l'ordre du texte (keys[i] -> values[i]) ;
+ * un tableau n'utilise que values.
+ */
+struct JsonValue {
+    enum class Type { Null, Bool, Number, String, Array, Object };
+
+    Type type = Type::Null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<std::string> keys;
+    std::vector<JsonValue> values;
+
+    // Membre 'key' d'un objet, nul s'il est absent (ou si la valeur n'est pas un objet)
+    const JsonValue* find(const std::string& key) const;
+
+    bool isNull() const { return type == Type::Null; }
+    bool isNumber() const { return type == Type::Number; }
+    bool isString() const { return type == Type::String; }
+    bool isObject() const { return type == Type::Object; }
+    bool isArray() const { return type == Type::Array; }
+};
+
+// Document complet ; une erreur de syntaxe lance std::invalid_argument (avec la position)
+JsonValue parseJson(std::string_view text);
+
+// Ajoute la valeur écrite sur une seule ligne (nombres au plus court, voir appendShortest)
+void appendJson(std::string& out, const JsonValue& value);
+
+// Ajoute 'text' entre guillemets, caractères de contrôle échappés
+void appendJsonString(std::string& out, std::string_view text);
+
+// Ajoute un nombre ; NaN et infinis, qui n'existent pas en JSON, deviennent null
+void appendJsonNumber(std::string& out, double value);
+
+#endif // JSON_HPP
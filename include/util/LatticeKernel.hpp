@@ -0,0 +1,98 @@
+#ifndef LATTICE_KERNEL_HPP
+#define LATTICE_KERNEL_HPP
+
+/**
+ * Noyaux de remontée d'un arbre binomial recombinant, en place :
+ *   V_s[i] = max(pd V_{s+1}[i] + pu V_{s+1}[i+1], exercice(S_s[i]))
+ * avec S_s[i] = S_{s+1}[i] / d. values et spots contiennent la rangée du
+ * niveau 'top' (top + 1 noeuds) et, au retour, celle du niveau stopLevel.
+ *
+ * exercisable[s] != 0 si l'exercice anticipé est permis au niveau s (nul pour
+ * une option européenne : les spots ne sont alors pas mis à jour).
+ */
+struct LatticeParameters {
+    double pu;          // e^{-r dt} q
+    double pd;          // e^{-r dt} (1 - q)
+    double inverseDown; // 1 / d
+    double strike;
+    bool isCall;
+};
+
+namespace lattice {
+
+// Un niveau sur les noeuds [first, last) : boucle vectorisée, sans branchement
+template<bool Exercise, bool Call>
+inline void stepRange(double* values, double* spots, int first, int last, const LatticeParameters& p) {
+    const double pu = p.pu;
+    const double pd = p.pd;
+    const double inverseDown = p.inverseDown;
+    const double K = p.strike;
+    #pragma omp simd
+    for (int i = first; i < last; ++i) {
+        const double continuation = pd * values[i] + pu * values[i + 1];
+        if (Exercise) {
+            const double S = spots[i] * inverseDown;
+            spots[i] = S;
+            const double exercise = Call ? S - K : K - S;
+            values[i] = continuation > exercise ? continuation : exercise;
+        } else {
+            values[i] = continuation;
+        }
+    }
+}
+
+// Spots seuls : niveau sans exercice d'une option qui en a d'autres
+inline void shiftSpots(double* spots, int first, int last, double inverseDown) {
+    #pragma omp simd
+    for (int i = first; i < last; ++i) {
+        spots[i] *= inverseDown;
+    }
+}
+
+inline void stepLevel(double* values, double* spots, int first, int last, bool exercise, bool trackSpots,
+                      const LatticeParameters& p) {
+    if (exercise) {
+        if (p.isCall) {
+            stepRange<true, true>(values, spots, first, last, p);
+        } else {
+            stepRange<true, false>(values, spots, first, last, p);
+        }
+    } else {
+        stepRange<false, false>(values, spots, first, last, p);
+        if (trackSpots) {
+            shiftSpots(spots, first, last, p.inverseDown);
+        }
+    }
+}
+
+} // namespace lattice
+
+/**
+ * @brief Remontée à profondeur fixe connue à la compilation : bornes de
+ *        boucle constantes, rangée entière en cache (Steps <= quelques milliers).
+ */
+template<int Steps>
+void rollbackFixedDepth(const LatticeParameters& p, const unsigned char* exercisable, int stopLevel,
+                        double* values, double* spots) {
+    static_assert(Steps > 0, "Steps doit être positif");
+    bool trackSpots = false;
+    for (int s = 0; s < Steps; ++s) {
+        trackSpots = trackSpots || exercisable[s] != 0;
+    }
+    for (int s = Steps - 1; s >= stopLevel; --s) {
+        lattice::stepLevel(values, spots, 0, s + 1, exercisable[s] != 0, trackSpots, p);
+    }
+}
+
+/**
+ * @brief Remontée de top à stopLevel avec blocage temporel : la rangée est
+ *        découpée en tuiles de tileWidth noeuds, et chaque tuile avance de
+ *        tileLevels niveaux pendant qu'elle est en cache. Les tuiles sont
+ *        inclinées (la tuile [lo, lo + w) couvre [lo - k, lo + w - k) au k-ième
+ *        niveau) pour que la mise à jour en place reste exacte.
+ *        tileLevels = 1 donne la remontée niveau par niveau.
+ */
+void rollbackLattice(int top, int stopLevel, const LatticeParameters& p, const unsigned char* exercisable,
+                     double* values, double* spots, int tileWidth = 2048, int tileLevels = 32);
+
+#endif // LATTICE_KERNEL_HPP
@@ -3,4 +3,11 @@
 
 double normcdf(double x); 
 
+// Densité de la loi normale centrée réduite
+double normpdf(double x);
+
+// P(X < a, Y < b) pour un couple gaussien centré réduit de corrélation rho
+// (algorithme de Drezner-Wesolowsky révisé par Genz ; précision limitée par normcdf)
+double bivariateNormcdf(double a, double b, double rho);
+
 #endif // MATH_HELPERS_HPP
@@ -3,24 +3,40 @@
 #include "models/FiniteDifferenceModel.hpp"
 #include "models/BlackScholesModel.hpp"  // Assurez-vous d'inclure ce fichier d'en-tête
 #include "domain/Option.hpp"
+#include "domain/OptionSpec.hpp"
 #include "util/GreeksCalculator.hpp"
+#include "models/CachedPricingModel.hpp"
+#include "util/ScenarioGrid.hpp"
 #include <string>
 #include <fstream>
+// Profils en spot (101 points de 0.5 K à 1.5 K) calculés par ScenarioGridEngine
 class OptionDataExporter {
 public:
     // Exporte les données de l'option vers un fichier CSV
     static void exportToCSV(const FiniteDifferenceModel& model, 
-                          const Option& option,
+                          const OptionSpec& option,
                           const std::string& filename);
     static void exportToCSV(const AmericanOptionPricer& pricer, 
-                          const Option& option,
+                          const OptionSpec& option,
                           const std::string& filename);
     // Ajoutez cette déclaration
     static void exportToCSV(const BlackScholesModel& model,
-                          const Option& option,
+                          const OptionSpec& option,
                           const std::string& filename);
+    // Chaque point est lu dans le cache, ou calculé puis stocké ; à réserver aux
+    // modèles dont les points sont indépendants (pricer américain)
+    static void exportToCSV(const CachedPricingModel& model,
+                          const OptionSpec& option,
+                          const std::string& filename);
+    // Grille complète spot x volatilité x maturité x taux, pour n'importe quel
+    // modèle : fichier en colonnes si le nom finit par ".opcb", CSV sinon
+    static ScenarioReport exportScenarioGrid(const OptionPricingModel& model,
+                                             const OptionSpec& option,
+                                             const ScenarioAxes& axes,
+                                             const std::string& filename,
+                                             const ScenarioSettings& settings = ScenarioSettings());
     // Exports benchmark data with Black-Scholes
-    static void exportBenchmarkToCSV(const Option& option,
+    static void exportBenchmarkToCSV(const OptionSpec& option,
                                    const std::string& filename);
     // Génère le script VBA pour créer les graphiques
     static void writeVBAScript(const std::string& filename);
@@ -28,5 +44,8 @@ private:
     // Helper method for creating chart scripts
     static void writePriceChartScript(std::ofstream& file);
     static void writeDeltaChartScript(std::ofstream& file);
+    static void exportSpotProfile(const OptionPricingModel& model,
+                                  const OptionSpec& option,
+                                  const std::string& filename);
 };
 #endif // OPTION_DATA_EXPORTER_HPP
\ No newline at end of file
@@ -0,0 +1,135 @@
+#ifndef PHILOX_HPP
+#define PHILOX_HPP
+
+#include "util/VectorMath.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class Philox4x32
+ * @brief Générateur à compteur Philox4x32-10 (Salmon et al., Random123).
+ *
+ * Le tirage est une fonction pure de (graine, compteur 128 bits) : la
+ * trajectoire i tire toujours les mêmes nombres, quels que soient le nombre
+ * de threads ou le découpage du travail. Chaque appel produit 4 mots de
+ * 32 bits, soit deux uniformes 64 bits donc deux normales.
+ *
+ * Convention utilisée par les modèles Monte Carlo : compteur = (trajectoire,
+ * indice de paire), la normale numéro d d'une trajectoire est le mot d % 2
+ * de la paire d / 2.
+ */
+class Philox4x32 {
+public:
+    explicit Philox4x32(std::uint64_t seed)
+        : key0_(static_cast<std::uint32_t>(seed)), key1_(static_cast<std::uint32_t>(seed >> 32)) {}
+
+    std::uint64_t seed() const {
+        return (static_cast<std::uint64_t>(key1_) << 32) | key0_;
+    }
+
+    // Bloc brut de 4 x 32 bits pour le compteur (c0, c1, c2, c3)
+    void generate(std::uint32_t c0, std::uint32_t c1, std::uint32_t c2, std::uint32_t c3,
+                  std::uint32_t out[4]) const {
+        rounds(c0, c1, c2, c3, key0_, key1_);
+        out[0] = c0;
+        out[1] = c1;
+        out[2] = c2;
+        out[3] = c3;
+    }
+
+    // Deux normales (tirages 2 * pair et 2 * pair + 1) de la trajectoire 'path'
+    void normalPair(std::uint64_t path, std::uint64_t pair, double& z0, double& z1) const {
+        std::uint32_t c0 = static_cast<std::uint32_t>(path);
+        std::uint32_t c1 = static_cast<std::uint32_t>(path >> 32);
+        std::uint32_t c2 = static_cast<std::uint32_t>(pair);
+        std::uint32_t c3 = static_cast<std::uint32_t>(pair >> 32);
+        rounds(c0, c1, c2, c3, key0_, key1_);
+        z0 = vecmath::normInv(vecmath::uniformFromBits((static_cast<std::uint64_t>(c1) << 32) | c0));
+        z1 = vecmath::normInv(vecmath::uniformFromBits((static_cast<std::uint64_t>(c3) << 32) | c2));
+    }
+
+    // Normale numéro 'draw' de la trajectoire 'path'
+    double normal(std::uint64_t path, std::uint64_t draw) const {
+        double z0, z1;
+        normalPair(path, draw >> 1, z0, z1);
+        return (draw & 1) ? z1 : z0;
+    }
+
+    /**
+     * @brief Génération par bloc, vectorisée sur les trajectoires : pour les
+     *        trajectoires firstPath .. firstPath + count - 1, écrit les tirages
+     *        2 * pair dans z0 et 2 * pair + 1 dans z1 (z1 peut être nul).
+     */
+    void normalPairs(std::uint64_t firstPath, std::size_t count, std::uint64_t pair,
+                     double* z0, double* z1) const {
+        const std::uint32_t k0 = key0_;
+        const std::uint32_t k1 = key1_;
+        const std::uint32_t p0 = static_cast<std::uint32_t>(pair);
+        const std::uint32_t p1 = static_cast<std::uint32_t>(pair >> 32);
+        const long n = static_cast<long>(count);
+
+        if (z1) {
+            #pragma omp simd
+            for (long i = 0; i < n; ++i) {
+                const std::uint64_t path = firstPath + static_cast<std::uint64_t>(i);
+                std::uint32_t c0 = static_cast<std::uint32_t>(path);
+                std::uint32_t c1 = static_cast<std::uint32_t>(path >> 32);
+                std::uint32_t c2 = p0;
+                std::uint32_t c3 = p1;
+                rounds(c0, c1, c2, c3, k0, k1);
+                z0[i] = vecmath::normInv(vecmath::uniformFromBits((static_cast<std::uint64_t>(c1) << 32) | c0));
+                z1[i] = vecmath::normInv(vecmath::uniformFromBits((static_cast<std::uint64_t>(c3) << 32) | c2));
+            }
+        } else {
+            #pragma omp simd
+            for (long i = 0; i < n; ++i) {
+                const std::uint64_t path = firstPath + static_cast<std::uint64_t>(i);
+                std::uint32_t c0 = static_cast<std::uint32_t>(path);
+                std::uint32_t c1 = static_cast<std::uint32_t>(path >> 32);
+                std::uint32_t c2 = p0;
+                std::uint32_t c3 = p1;
+                rounds(c0, c1, c2, c3, k0, k1);
+                z0[i] = vecmath::normInv(vecmath::uniformFromBits((static_cast<std::uint64_t>(c1) << 32) | c0));
+            }
+        }
+    }
+
+private:
+    // Constantes de Philox4x32
+    static constexpr std::uint32_t M0 = 0xD2511F53u;
+    static constexpr std::uint32_t M1 = 0xCD9E8D57u;
+    static constexpr std::uint32_t W0 = 0x9E3779B9u;
+    static constexpr std::uint32_t W1 = 0xBB67AE85u;
+
+    // Un tour : deux multiplications 32x32 -> 64 bits (vectorisables) et des XOR
+    static inline void round(std::uint32_t& c0, std::uint32_t& c1, std::uint32_t& c2, std::uint32_t& c3,
+                             std::uint32_t k0, std::uint32_t k1) {
+        const std::uint64_t p0 = static_cast<std::uint64_t>(M0) * c0;
+        const std::uint64_t p1 = static_cast<std::uint64_t>(M1) * c2;
+        const std::uint32_t hi0 = static_cast<std::uint32_t>(p0 >> 32);
+        const std::uint32_t lo0 = static_cast<std::uint32_t>(p0);
+        const std::uint32_t hi1 = static_cast<std::uint32_t>(p1 >> 32);
+        const std::uint32_t lo1 = static_cast<std::uint32_t>(p1);
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+    }
+
+    // Les 10 tours, la clé étant incrémentée entre chaque tour
+    static inline void rounds(std::uint32_t& c0, std::uint32_t& c1, std::uint32_t& c2, std::uint32_t& c3,
+                              std::uint32_t k0, std::uint32_t k1) {
+        for (int r = 0; r < 10; ++r) {
+            if (r > 0) {
+                k0 += W0;
+                k1 += W1;
+            }
+            round(c0, c1, c2, c3, k0, k1);
+        }
+    }
+
+    std::uint32_t key0_;
+    std::uint32_t key1_;
+};
+
+#endif // PHILOX_HPP
@@ -0,0 +1,121 @@
+#ifndef PRICING_CACHE_HPP
+#define PRICING_CACHE_HPP
+
+#include "domain/OptionSpec.hpp"
+#include "util/Greeks.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+struct CacheSettings {
+    std::size_t capacity = 1 << 16;   // Entrées, arrondi à une puissance de 2 ; celle d'un fichier existant prime
+    double relativeTolerance = 1e-9;  // Pas de quantification relatif du spot, du strike, de la volatilité et de la maturité
+    double rateTolerance = 1e-10;     // Pas absolu du taux
+};
+
+// Compteurs partagés par tous les processus qui utilisent le fichier
+struct CacheStats {
+    std::uint64_t capacity = 0;
+    std::uint64_t entries = 0;
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t inserts = 0;
+    std::uint64_t evictions = 0;
+
+    // hits / (hits + misses), 0 sans requête
+    double hitRate() const;
+};
+
+// Clé d'une entrée : modèle et paramètres quantifiés
+struct CacheKey {
+    std::uint64_t words[7];  // Modèle, S, K, r, sigma, T, type
+    std::uint64_t hash;
+    OptionSpec option;       // Option ramenée sur la grille : c'est elle qui est pricée et stockée
+};
+
+/**
+ * @class PricingCache
+ * @brief Cache de résultats (prix, ou prix et Greeks) persistant, partagé par
+ *        tous les processus price_opt qui ouvrent le même fichier.
+ *
+ * Le fichier est projeté en mémoire (MAP_SHARED) : un en-tête de compteurs
+ * atomiques puis une table à adressage ouvert d'entrées de 192 octets. Une
+ * clé regroupe l'identifiant du modèle (nom et configuration) et les
+ * paramètres de l'option quantifiés : S, K, sigma et T sur une grille
+ * logarithmique de pas relatif relativeTolerance, r sur une grille de pas
+ * rateTolerance. Les requêtes presque identiques (100 et 100.0000000001)
+ * tombent sur la même entrée ; comme le modèle est appelé sur l'option
+ * ramenée sur la grille, la valeur stockée ne dépend pas du processus qui
+ * l'a calculée.
+ *
+ * Aucun verrou : chaque entrée est protégée par un compteur de version
+ * (seqlock). Un écrivain la réserve par compare-and-swap (version impaire),
+ * l'écrit puis la libère ; un lecteur recommence si la version a changé
+ * pendant sa lecture. Une entrée restée impaire plus d'une génération
+ * d'accès (capacité), parce que son écrivain est mort, est reprise par
+ * compare-and-swap par l'écrivain suivant ; une somme de contrôle par entrée
+ * écarte les données mêlées si l'ancien écrivain n'était que suspendu.
+ * Une clé est cherchée dans une fenêtre de 8 entrées
+ * consécutives ; quand la fenêtre est pleine, l'entrée la moins récemment
+ * utilisée (horloge logique partagée) est remplacée. La taille du fichier est
+ * donc bornée par la capacité. Le cache est un accélérateur : une entrée en
+ * cours d'écriture par un autre processus est simplement ignorée.
+ *
+ * Seul le dimensionnement du fichier (création, ou version incompatible) se
+ * fait sous verrou exclusif (flock). Un cache d'une autre version n'est jamais
+ * tronqué : un nouveau fichier le remplace par rename(), les processus qui
+ * projettent encore l'ancien continuent de l'utiliser.
+ */
+class PricingCache {
+public:
+    // Crée le fichier s'il est absent ou vide, remplace un cache d'une autre
+    // version ; un fichier non vide qui n'est pas un cache lance
+    // std::runtime_error et n'est pas modifié
+    explicit PricingCache(const std::string& path, const CacheSettings& settings = CacheSettings());
+    ~PricingCache();
+
+    PricingCache(const PricingCache&) = delete;
+    PricingCache& operator=(const PricingCache&) = delete;
+
+    // Identifiant d'un modèle et de toute sa configuration, par exemple
+    // "Binomial:steps=501;american=1" ; les tolérances y sont incluses
+    std::uint64_t modelId(const std::string& description) const;
+
+    // Faux si l'option ne peut pas être quantifiée (paramètre non fini, ou
+    // spot, strike, volatilité ou maturité non positifs)
+    bool makeKey(std::uint64_t model, const OptionSpec& option, CacheKey& key) const;
+
+    // Une entrée de Greeks sert aussi les demandes de prix
+    bool findPrice(const CacheKey& key, double& price);
+    bool findGreeks(const CacheKey& key, Greeks& greeks);
+    void storePrice(const CacheKey& key, double price);
+    void storeGreeks(const CacheKey& key, const Greeks& greeks);
+
+    CacheStats stats() const;
+    // Vide la table et remet les compteurs à zéro (autres processus compris)
+    void clear();
+
+    const std::string& path() const;
+
+private:
+    struct Header;
+    struct Slot;
+
+    bool find(const CacheKey& key, std::uint64_t kind, double* values);
+    void store(const CacheKey& key, std::uint64_t kind, const double* values);
+
+    // Réservation d'une entrée lue à la version 'observed' (paire, ou impaire et abandonnée)
+    bool reserve(Slot& slot, std::uint64_t observed, std::uint64_t& reserved);
+    bool release(Slot& slot, std::uint64_t reserved);
+    bool abandoned(const Slot& slot, std::uint64_t version) const;
+
+    std::string path_;
+    CacheSettings settings_;
+    void* mapping_ = nullptr;
+    std::size_t size_ = 0;
+    Header* header_ = nullptr;
+    Slot* slots_ = nullptr;
+    std::uint64_t mask_ = 0;
+};
+
+#endif // PRICING_CACHE_HPP
@@ -0,0 +1,91 @@
+#ifndef PRICING_SCHEDULER_HPP
+#define PRICING_SCHEDULER_HPP
+
+#include "models/OptionPricingModel.hpp"
+#include "domain/OptionSpec.hpp"
+#include "util/Greeks.hpp"
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+// Une option et le modèle qui la price (le modèle doit pouvoir être appelé depuis plusieurs threads)
+struct PricingTask {
+    OptionSpec option;
+    const OptionPricingModel* model;
+};
+
+struct PricingTaskResult {
+    Greeks greeks;         // Seul greeks.price est renseigné si computeGreeks est faux
+    double seconds = 0.0;  // Durée mesurée de la tâche
+    int thread = -1;       // Thread qui l'a exécutée, -1 pour un modèle parallèle (équipe entière)
+    std::string error;     // Vide si la tâche a réussi
+};
+
+struct SchedulerSettings {
+    int threads = 0;                 // 0 : omp_get_max_threads()
+    bool computeGreeks = false;      // GreeksCalculator::greeks plutôt que calculatePrice
+    int chunksPerThread = 16;        // Granularité visée : assez de paquets pour rééquilibrer
+    double minChunkSeconds = 20e-6;  // Paquet minimal, pour amortir le vol de travail
+};
+
+struct SchedulerReport {
+    double seconds = 0.0;             // Durée totale
+    double taskSeconds = 0.0;         // Somme des durées des tâches
+    double parallelSeconds = 0.0;     // Dont tâches à parallélisme interne
+    std::size_t chunks = 0;
+    std::size_t steals = 0;
+    std::size_t failed = 0;
+    int threads = 0;
+    std::vector<double> threadSeconds;  // Temps de calcul de chaque thread (hors modèles parallèles)
+
+    // Part du temps des threads passée à pricer, de 0 à 1
+    double efficiency() const;
+};
+
+/**
+ * @class PricingScheduler
+ * @brief Revalorisation d'un portefeuille hétérogène (formules fermées, arbres,
+ *        PDE, Monte Carlo) sur tous les coeurs.
+ *
+ * Chaque tâche reçoit un coût estimé : costHint() du modèle multiplié par une
+ * calibration (secondes par unité) apprise, par instance de modèle, sur les
+ * durées mesurées des revalorisations précédentes : deux arbres de tailles
+ * différentes, ou deux modèles enveloppés dans le cache, ont chacun la leur.
+ * Une adresse réutilisée par un nouveau modèle hérite de la calibration de
+ * l'ancien, corrigée dès la revalorisation suivante. Les tâches sont triées par coût
+ * décroissant puis regroupées en paquets d'environ
+ * total / (threads * chunksPerThread) : une tâche lourde forme son propre
+ * paquet, les formules fermées sont groupées par centaines. Les paquets sont
+ * répartis à l'avance sur une file par thread (le plus lourd d'abord vers la
+ * file la moins chargée). Chaque thread vide sa file dans l'ordre, puis vole
+ * les paquets restants en queue des autres files, ce qui corrige les erreurs
+ * d'estimation.
+ *
+ * Les modèles à parallélisme interne (Monte Carlo) ne sont pas exécutés par
+ * les threads du pool : une région OpenMP imbriquée y serait sérialisée ou
+ * surchargerait les coeurs. Ils sont pricés ensuite, un par un, par le thread
+ * appelant, et disposent chacun de toute l'équipe OpenMP.
+ */
+class PricingScheduler {
+public:
+    explicit PricingScheduler(const SchedulerSettings& settings = SchedulerSettings());
+
+    // results est redimensionné à tasks.size() ; une exception d'un modèle est
+    // consignée dans results[i].error sans interrompre les autres tâches
+    SchedulerReport run(const std::vector<PricingTask>& tasks, std::vector<PricingTaskResult>& results);
+
+    // Secondes par unité de costHint() pour ce modèle (valeur par défaut avant toute mesure)
+    double calibration(const OptionPricingModel& model) const;
+
+    // Oublie toutes les calibrations, à appeler quand les modèles mesurés sont détruits
+    void clearCalibration();
+
+    const SchedulerSettings& getSettings() const;
+
+private:
+    SchedulerSettings settings_;
+    std::map<const OptionPricingModel*, double> secondsPerCost_;
+};
+
+#endif // PRICING_SCHEDULER_HPP
@@ -0,0 +1,89 @@
+#ifndef PRICING_SERVER_HPP
+#define PRICING_SERVER_HPP
+
+#include "util/PricingService.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <set>
+#include <string>
+
+struct ServerSettings {
+    std::string socketPath;                    // Socket Unix (108 octets au plus)
+    std::size_t maxRequestBytes = 64u << 20;   // Ligne plus longue : réponse d'erreur, connexion fermée
+    std::size_t maxConnections = 64;           // Au-delà : réponse d'erreur, connexion fermée
+    int sendTimeoutMilliseconds = 10000;       // Réponse non lue pendant ce délai : connexion fermée (0 : sans limite)
+};
+
+/**
+ * @class PricingServer
+ * @brief Mode résident de price_opt : un PricingService derrière une socket
+ *        Unix locale. Une requête JSON par ligne, la réponse sur la même
+ *        connexion, dans l'ordre des requêtes.
+ *
+ * Le processus, les modèles, leurs caches de résolutions et l'équipe OpenMP
+ * restent chauds d'une requête à l'autre : plus de lancement de processus ni
+ * de fichiers CSV à relire. Chaque connexion a son thread, limité aux
+ * entrées-sorties et à l'analyse des lignes : le pricing passe par le thread
+ * unique du PricingService. Une connexion peut enchaîner autant de requêtes
+ * que voulu (y compris plusieurs lignes envoyées d'un coup) ; au-delà de
+ * maxConnections connexions ouvertes, une nouvelle reçoit une erreur et est fermée.
+ *
+ * Une socket laissée par un serveur arrêté brutalement est remplacée ; si un
+ * serveur répond encore à cette adresse, le constructeur lance std::runtime_error.
+ */
+class PricingServer {
+public:
+    // Crée la socket et commence à écouter
+    PricingServer(const ServerSettings& settings, PricingService& service);
+    // Ferme la socket et supprime son fichier
+    ~PricingServer();
+
+    PricingServer(const PricingServer&) = delete;
+    PricingServer& operator=(const PricingServer&) = delete;
+
+    // Accepte les connexions jusqu'à stop() ou une commande "shutdown", puis
+    // attend la fin des requêtes en cours
+    void run();
+
+    // Utilisable depuis un autre thread ou un gestionnaire de signal
+    void stop();
+
+    const std::string& socketPath() const;
+
+private:
+    void serve(int fd);
+
+    ServerSettings settings_;
+    PricingService& service_;
+    int listenFd_ = -1;
+    std::atomic<bool> stopping_{false};
+
+    std::mutex connectionsMutex_;
+    std::condition_variable connectionsDone_;
+    std::set<int> connections_;
+};
+
+/**
+ * @class PricingClient
+ * @brief Client minimal du serveur : une connexion, une requête à la fois.
+ */
+class PricingClient {
+public:
+    // Lance std::runtime_error si aucun serveur n'écoute à cette adresse
+    explicit PricingClient(const std::string& socketPath);
+    ~PricingClient();
+
+    PricingClient(const PricingClient&) = delete;
+    PricingClient& operator=(const PricingClient&) = delete;
+
+    // Envoie une requête (une ligne JSON, sans '\n') et renvoie la réponse
+    std::string request(const std::string& line);
+
+private:
+    int fd_ = -1;
+    std::string buffer_;  // Octets reçus après la dernière réponse
+};
+
+#endif // PRICING_SERVER_HPP
@@ -0,0 +1,127 @@
+#ifndef PRICING_SERVICE_HPP
+#define PRICING_SERVICE_HPP
+
+#include "models/OptionPricingModel.hpp"
+#include "util/Json.hpp"
+#include "util/PricingCache.hpp"
+#include "util/PricingScheduler.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+struct ServiceSettings {
+    std::string defaultModel = "BlackScholes";  // Requête sans "model"
+    int threads = 0;                            // Équipe OpenMP des lots, 0 : omp_get_max_threads()
+    std::shared_ptr<PricingCache> cache;        // Facultatif, voir BatchSettings::cache
+};
+
+struct ServiceStats {
+    std::uint64_t requests = 0;  // Lignes traitées
+    std::uint64_t options = 0;   // Options pricées (une par requête simple, n par lot)
+    std::uint64_t failed = 0;    // Options ou requêtes en erreur
+};
+
+/**
+ * @class PricingService
+ * @brief Protocole JSON du serveur de pricing : une requête par ligne, une
+ *        réponse par ligne, indépendamment du transport.
+ *
+ * Requête simple :
+ *   {"id": 7, "spot": 100, "strike": 100, "rate": 0.05, "volatility": 0.2,
+ *    "maturity": 1, "type": "put", "model": "Binomial:steps=501;american=1", "greeks": true}
+ *   -> {"id":7,"price":...,"delta":...,"gamma":...,"vega":...,"theta":...,"rho":...,"status":"ok"}
+ * "id" (nombre ou chaîne) est recopié ; "model" (voir createModelFromSpec) et
+ * "greeks" sont facultatifs.
+ *
+ * Lot : {"id": "b1", "options": [{...}, {...}], "model": ..., "greeks": ...}
+ *   -> {"id":"b1","results":[{...}, {...}],"failed":0,"seconds":...}
+ * "model" du lot sert de valeur par défaut à ses options, "greeks" vaut pour
+ * toutes ; elles sont pricées ensemble par un PricingScheduler (vol de travail sur toute
+ * l'équipe OpenMP).
+ *
+ * Commandes : {"command": "stats"} (compteurs et cache), {"command": "shutdown"}.
+ *
+ * Une erreur donne {"id":...,"status":"error","error":"..."} : handle() ne
+ * lance jamais d'exception. Les modèles sont créés une fois par description et
+ * partagés par toutes les connexions. Au plus MAX_CACHED_MODELS sont
+ * conservés : une fois la limite atteinte, un nouveau modèle libère ceux que
+ * la requête en cours n'utilise pas ; une requête qui en décrit davantage à
+ * elle seule reçoit une erreur pour les options en trop.
+ *
+ * handle() peut être appelé depuis plusieurs threads : l'analyse de la requête
+ * et les commandes restent sur le thread appelant, mais tout pricing (requêtes
+ * simples comme lots) est confié à un unique thread de pricing, créé avec le
+ * service. libgomp associe une équipe OpenMP à chaque thread maître : ce
+ * thread est le seul à ouvrir des régions parallèles, si bien que l'équipe est
+ * créée une fois, reste chaude d'une requête à l'autre, et que deux requêtes
+ * (ou un lot et un Monte Carlo) ne se disputent jamais les coeurs.
+ */
+class PricingService {
+public:
+    explicit PricingService(const ServiceSettings& settings = ServiceSettings());
+    ~PricingService();
+
+    PricingService(const PricingService&) = delete;
+    PricingService& operator=(const PricingService&) = delete;
+
+    // Une ligne de requête, sans '\n' ; la réponse n'en contient pas non plus
+    std::string handle(const std::string& request);
+
+    // Vrai après une commande "shutdown"
+    bool shutdownRequested() const;
+
+    ServiceStats stats() const;
+    const ServiceSettings& getSettings() const;
+
+    // Modèles conservés d'une requête à l'autre (un client ne peut faire croître la mémoire sans limite)
+    static constexpr std::size_t MAX_CACHED_MODELS = 256;
+
+private:
+    // Modèle décrit par 'spec', créé au premier usage ; lance std::invalid_argument si invalide
+    const OptionPricingModel* model(const std::string& spec);
+    // Début d'une requête de pricing : les modèles non utilisés depuis deviennent libérables
+    void beginRequest();
+
+    // Champs de la réponse, ajoutés à 'out' ; une erreur de la requête lance une exception
+    void priceOne(const JsonValue& request, std::string& out);
+    void priceBatch(const JsonValue& request, std::string& out);
+    void command(const std::string& name, std::string& out);
+
+    // Exécute 'task' sur le thread de pricing et attend sa fin ; ses exceptions sont relancées ici
+    void runOnPricingThread(const std::function<void()>& task);
+    void pricingLoop();
+    void stopPricingThread();
+
+    ServiceSettings settings_;
+
+    // Utilisés uniquement par le thread de pricing
+    struct CachedModel {
+        std::unique_ptr<OptionPricingModel> model;
+        std::uint64_t request = 0;  // Dernière requête qui l'a utilisé (et en détient le pointeur)
+    };
+    std::map<std::string, CachedModel> models_;
+    std::uint64_t request_ = 0;
+    PricingScheduler priceScheduler_;
+    PricingScheduler greeksScheduler_;
+
+    std::mutex queueMutex_;
+    std::condition_variable queueReady_;
+    std::deque<std::function<void()>> queue_;
+    bool stopping_ = false;
+    std::thread pricingThread_;
+
+    std::atomic<std::uint64_t> requests_{0};
+    std::atomic<std::uint64_t> options_{0};
+    std::atomic<std::uint64_t> failed_{0};
+    std::atomic<bool> shutdown_{false};
+};
+
+#endif // PRICING_SERVICE_HPP
@@ -0,0 +1,79 @@
+#ifndef RUNNING_STATISTICS_HPP
+#define RUNNING_STATISTICS_HPP
+
+/**
+ * Accumulateurs de Welford : moyenne et variance en une passe, numériquement
+ * stables, fusionnables (formule de Chan) pour combiner des blocs calculés
+ * en parallèle. La fusion se fait dans un ordre fixe pour rester déterministe.
+ */
+struct RunningStatistics {
+    double count = 0.0;
+    double mean = 0.0;
+    double m2 = 0.0;   // Somme des carrés des écarts à la moyenne
+
+    void add(double x) {
+        count += 1.0;
+        const double delta = x - mean;
+        mean += delta / count;
+        m2 += delta * (x - mean);
+    }
+
+    void merge(const RunningStatistics& other) {
+        if (other.count == 0.0) {
+            return;
+        }
+        const double total = count + other.count;
+        const double delta = other.mean - mean;
+        mean += delta * other.count / total;
+        m2 += other.m2 + delta * delta * count * other.count / total;
+        count = total;
+    }
+
+    // Variance empirique (non biaisée)
+    double variance() const {
+        return count > 1.0 ? m2 / (count - 1.0) : 0.0;
+    }
+};
+
+// Version bivariée : variances de x et y et covariance
+struct RunningCovariance {
+    double count = 0.0;
+    double meanX = 0.0;
+    double meanY = 0.0;
+    double m2X = 0.0;
+    double m2Y = 0.0;
+    double cXY = 0.0;  // Somme des produits des écarts
+
+    void add(double x, double y) {
+        count += 1.0;
+        const double dx = x - meanX;
+        meanX += dx / count;
+        const double dy = y - meanY;
+        meanY += dy / count;
+        m2X += dx * (x - meanX);
+        m2Y += dy * (y - meanY);
+        cXY += dx * (y - meanY);
+    }
+
+    void merge(const RunningCovariance& other) {
+        if (other.count == 0.0) {
+            return;
+        }
+        const double total = count + other.count;
+        const double dx = other.meanX - meanX;
+        const double dy = other.meanY - meanY;
+        const double weight = count * other.count / total;
+        meanX += dx * other.count / total;
+        meanY += dy * other.count / total;
+        m2X += other.m2X + dx * dx * weight;
+        m2Y += other.m2Y + dy * dy * weight;
+        cXY += other.cXY + dx * dy * weight;
+        count = total;
+    }
+
+    double varianceX() const { return count > 1.0 ? m2X / (count - 1.0) : 0.0; }
+    double varianceY() const { return count > 1.0 ? m2Y / (count - 1.0) : 0.0; }
+    double covariance() const { return count > 1.0 ? cXY / (count - 1.0) : 0.0; }
+};
+
+#endif // RUNNING_STATISTICS_HPP
@@ -0,0 +1,109 @@
+#ifndef SCENARIO_GRID_HPP
+#define SCENARIO_GRID_HPP
+
+#include "models/OptionPricingModel.hpp"
+#include "domain/OptionSpec.hpp"
+#include "util/ColumnarFile.hpp"
+#include "util/Greeks.hpp"
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Valeurs de chaque axe, dans l'ordre de sortie ; un axe vide reprend la valeur de l'option
+struct ScenarioAxes {
+    std::vector<double> spots;
+    std::vector<double> volatilities;
+    std::vector<double> maturities;
+    std::vector<double> rates;
+
+    // 'points' valeurs first + i * (last - first) / (points - 1) : indice entier, sans cumul d'arrondis
+    static std::vector<double> linspace(double first, double last, int points);
+
+    // Profil historique des exports : 101 spots de 0.5 K à 1.5 K, autres paramètres ceux de l'option
+    static ScenarioAxes spotProfile(const OptionSpec& option, int points = 101);
+};
+
+// Un point de la grille : l'option évaluée et ses résultats
+struct ScenarioPoint {
+    OptionSpec option;
+    Greeks greeks;
+};
+
+// Destination des résultats, appelée par blocs consécutifs dans l'ordre de la grille
+class ScenarioSink {
+public:
+    virtual ~ScenarioSink() = default;
+    virtual void write(const ScenarioPoint* points, std::size_t count) = 0;
+};
+
+// CSV ; spotOnly donne l'ancien format des exports (Spot,Price,Delta,Gamma,Theta,Rho,Vega à 6 décimales)
+class CsvScenarioSink : public ScenarioSink {
+public:
+    explicit CsvScenarioSink(std::ostream& out, bool spotOnly = false);
+    void write(const ScenarioPoint* points, std::size_t count) override;
+
+private:
+    std::ostream& out_;
+    bool spotOnly_;
+};
+
+// Fichier binaire en colonnes (ColumnarFile) : axes puis les neuf Greeks, en Float64
+class ColumnarScenarioSink : public ScenarioSink {
+public:
+    explicit ColumnarScenarioSink(const std::string& path);
+    void write(const ScenarioPoint* points, std::size_t count) override;
+    void close();
+
+    static ColumnSchema schema();
+
+private:
+    ColumnarWriter writer_;
+    std::vector<std::vector<double>> columns_;
+};
+
+struct ScenarioSettings {
+    int threads = 0;                  // 0 : omp_get_max_threads()
+    std::size_t blockPoints = 16384;  // Points calculés avant chaque écriture (mémoire bornée)
+};
+
+struct ScenarioReport {
+    std::size_t points = 0;
+    std::size_t slices = 0;   // Tranches (taux, maturité, volatilité)
+    std::size_t solves = 0;   // Résolutions PDE, pour le modèle de différences finies
+    double seconds = 0.0;
+};
+
+/**
+ * @class ScenarioGridEngine
+ * @brief Évaluation d'une option sur une grille spot x volatilité x maturité x
+ *        taux, avec prix et Greeks en chaque point.
+ *
+ * Le spot varie le plus vite, puis la volatilité, la maturité et le taux : une
+ * tranche (taux, maturité, volatilité) regroupe tous les spots. Le calcul
+ * réutilise ce que le modèle permet de partager :
+ *  - différences finies : une résolution par tranche (plus quatre décalées
+ *    pour vega et rho) donne tous les spots, lus sur la même grille ;
+ *  - Black-Scholes : Greeks analytiques en une passe par point ;
+ *  - autres modèles (cache partagé compris) : GreeksCalculator::greeks par point.
+ *
+ * Les points sont calculés par blocs en parallèle (OpenMP, par tranche pour
+ * les différences finies, par point sinon) dans un tampon indexé, puis remis
+ * au puits dans l'ordre : la sortie ne dépend pas du nombre de threads.
+ */
+class ScenarioGridEngine {
+public:
+    explicit ScenarioGridEngine(const ScenarioSettings& settings = ScenarioSettings());
+
+    // La première exception d'un modèle interrompt le calcul et est relancée
+    ScenarioReport run(const OptionPricingModel& model, const OptionSpec& option, const ScenarioAxes& axes,
+                       ScenarioSink& sink) const;
+
+    const ScenarioSettings& getSettings() const;
+
+private:
+    ScenarioSettings settings_;
+};
+
+#endif // SCENARIO_GRID_HPP
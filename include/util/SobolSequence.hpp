@@ -0,0 +1,44 @@
+#ifndef SOBOL_SEQUENCE_HPP
+#define SOBOL_SEQUENCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class SobolSequence
+ * @brief Suite de Sobol en base 2 sur 32 bits, générée en ordre de Gray.
+ *
+ * Les nombres directeurs des 21 premières dimensions sont ceux de Joe et Kuo
+ * (new-joe-kuo-6.21201). Au-delà, les polynômes primitifs suivants sont
+ * énumérés et les valeurs initiales m_i tirées de façon déterministe (impaires,
+ * m_i < 2^i) : la suite reste valide mais ces dimensions sont de moindre
+ * qualité, ce qui est acceptable derrière un pont brownien qui y place peu
+ * de variance.
+ */
+class SobolSequence {
+public:
+    static constexpr int BITS = 32;
+    static constexpr int JOE_KUO_DIMENSIONS = 21;
+
+    explicit SobolSequence(int dimensions);
+
+    int dimensions() const;
+
+    // Coordonnées entières (sur 32 bits) du point d'indice 'index'
+    void point(std::uint64_t index, std::uint32_t* out) const;
+
+    // Coordonnée 'dimension' des points first .. first + count - 1
+    void generate(std::uint64_t first, std::size_t count, int dimension, std::uint32_t* out) const;
+
+    // Uniforme dans (0, 1) après décalage numérique (XOR) : ((x ^ shift) + 0.5) / 2^32
+    static double toUniform(std::uint32_t x, std::uint32_t shift) {
+        return (static_cast<double>(x ^ shift) + 0.5) * 2.3283064365386963e-10;
+    }
+
+private:
+    int dimensions_;
+    std::vector<std::uint32_t> directions_; // dimensions_ x BITS nombres directeurs
+};
+
+#endif // SOBOL_SEQUENCE_HPP
@@ -0,0 +1,32 @@
+#ifndef SPOT_GRID_HPP
+#define SPOT_GRID_HPP
+
+#include <vector>
+
+// Répartition des noeuds en spot des pricers PDE
+enum class GridType { Uniform, Sinh };
+
+/**
+ * @brief Construit les noeuds S_0 = 0 < S_1 < ... < S_M = sMax dans 'nodes'.
+ *
+ * Uniform : S_i = i sMax / M. Sinh : S(u) = center + alpha sinh(c1 + (c2 - c1) u)
+ * avec alpha = concentration * center, ce qui resserre les noeuds autour de
+ * 'center' (le strike) et les espace là où le payoff est linéaire. Le pas en u
+ * est ajusté de part et d'autre du spot pour que 'spot' soit exactement un
+ * noeud. Renvoie l'indice du noeud le plus proche du spot par valeur inférieure.
+ * 'nodes' est réutilisé sans réallocation si sa capacité suffit.
+ */
+int buildSpotGrid(GridType type, double sMax, int intervals, double center, double spot,
+                  std::vector<double>& nodes, double concentration = 0.1);
+
+/**
+ * @brief Coefficients de l'opérateur de Black-Scholes
+ *        L V = 1/2 sigma^2 S^2 V'' + r S V' - r V
+ *        aux noeuds intérieurs 1..M-1 (différences centrées non uniformes
+ *        sur trois points) : (L V)_i = lower[k] V_{i-1} + diagonal[k] V_i + upper[k] V_{i+1},
+ *        avec k = i - 1.
+ */
+void blackScholesOperator(const std::vector<double>& nodes, double sigma, double rate,
+                          double* lower, double* diagonal, double* upper);
+
+#endif // SPOT_GRID_HPP
@@ -0,0 +1,43 @@
+#ifndef TRIDIAGONAL_SOLVER_HPP
+#define TRIDIAGONAL_SOLVER_HPP
+
+#include <vector>
+
+/**
+ * @class TridiagonalSolver
+ * @brief Factorisation LU (algorithme de Thomas) d'une matrice tridiagonale,
+ *        calculée une fois puis réutilisée pour chaque second membre.
+ *
+ * Système : a_i x_{i-1} + b_i x_i + c_i x_{i+1} = d_i, i = 0..n-1 (a_0 et
+ * c_{n-1} sont ignorés). La résolution se fait en place en O(n), sans
+ * allocation ; les tableaux internes ne sont réalloués que si n augmente.
+ */
+class TridiagonalSolver {
+public:
+    // Lance std::runtime_error si un pivot est nul
+    void factorize(const double* lower, const double* diagonal, const double* upper, int n);
+
+    // x contient d en entrée et la solution en sortie
+    void solve(double* x) const;
+
+    /**
+     * @brief Brennan-Schwartz : résolution du problème de complémentarité
+     *        linéaire x >= obstacle, la projection étant faite pendant la
+     *        remontée. Exact lorsque la zone où x = obstacle est un bloc
+     *        contigu en fin de système (indices élevés).
+     */
+    void solveProjected(double* x, const double* obstacle) const;
+
+    int size() const;
+
+private:
+    int size_ = 0;
+    std::vector<double> lower_;          // a_i / pivot_i
+    std::vector<double> upper_;          // c_i / pivot_i
+    std::vector<double> inversePivot_;   // 1 / (b_i - a_i c'_{i-1})
+};
+
+// y = A x en place pour A tridiagonale (lignes 0..n-1, mêmes conventions)
+void multiplyTridiagonal(const double* lower, const double* diagonal, const double* upper, double* x, int n);
+
+#endif // TRIDIAGONAL_SOLVER_HPP
@@ -0,0 +1,183 @@
+#ifndef VECTOR_MATH_HPP
+#define VECTOR_MATH_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * Fonctions mathématiques sans branchement, destinées aux boucles
+ * "#pragma omp simd". Elles n'utilisent que des opérations que le compilateur
+ * sait vectoriser (AVX2 / AVX-512 selon -march) : polynômes, sélections et
+ * manipulations de bits sur des entiers 64 bits. Aucune conversion
+ * double <-> int64 n'est utilisée car elle n'existe pas en AVX2.
+ */
+namespace vecmath {
+
+// Décalage 1.5 * 2^52 : ajouté à un double, il place l'entier arrondi
+// dans les bits de poids faible de la mantisse.
+constexpr double ROUND_SHIFTER = 6755399441055744.0;
+
+inline double bitsToDouble(std::uint64_t bits) {
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline std::uint64_t doubleToBits(double value) {
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+/**
+ * @brief exp(x) par réduction x = n ln2 + r, |r| <= ln2/2, puis polynôme de
+ *        Taylor de degré 12 sur r. Erreur relative < 1e-15.
+ */
+#pragma omp declare simd notinbranch
+inline double exp(double x) {
+    const double LOG2E = 1.4426950408889634;
+    const double LN2_HI = 6.93147180369123816490e-01;
+    const double LN2_LO = 1.90821492927058770002e-10;
+
+    x = x < -708.0 ? -708.0 : (x > 709.0 ? 709.0 : x);
+
+    // n = round(x / ln2), récupéré directement dans les bits de 'shifted'
+    const double shifted = x * LOG2E + ROUND_SHIFTER;
+    const double n = shifted - ROUND_SHIFTER;
+    const double r = (x - n * LN2_HI) - n * LN2_LO;
+
+    double p = 1.0 / 479001600.0;
+    p = p * r + 1.0 / 39916800.0;
+    p = p * r + 1.0 / 3628800.0;
+    p = p * r + 1.0 / 362880.0;
+    p = p * r + 1.0 / 40320.0;
+    p = p * r + 1.0 / 5040.0;
+    p = p * r + 1.0 / 720.0;
+    p = p * r + 1.0 / 120.0;
+    p = p * r + 1.0 / 24.0;
+    p = p * r + 1.0 / 6.0;
+    p = p * r + 0.5;
+    p = p * r + 1.0;
+    p = p * r + 1.0;
+
+    // 2^n : seuls les 12 bits de poids faible de (bits + 1023) survivent au décalage
+    const std::uint64_t scaleBits = (doubleToBits(shifted) + 1023) << 52;
+    return p * bitsToDouble(scaleBits);
+}
+
+/**
+ * @brief log(x) pour x > 0 normalisé : x = m 2^e avec m dans [sqrt(1/2), sqrt(2)),
+ *        puis log(m) = 2 atanh((m-1)/(m+1)) développé en série.
+ */
+#pragma omp declare simd notinbranch
+inline double log(double x) {
+    const double LN2 = 0.6931471805599453;
+    const double SQRT2 = 1.4142135623730951;
+
+    const std::uint64_t bits = doubleToBits(x);
+    // Exposant converti en double sans conversion entière : 2^52 + e - 2^52
+    const std::uint64_t exponentBits = (bits >> 52) & 0x7ff;
+    double e = bitsToDouble(0x4330000000000000ULL | exponentBits) - 4503599627370496.0 - 1023.0;
+    double m = bitsToDouble((bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL);
+
+    const bool high = m > SQRT2;
+    m = high ? 0.5 * m : m;
+    e = high ? e + 1.0 : e;
+
+    const double f = (m - 1.0) / (m + 1.0);
+    const double f2 = f * f;
+    double s = 1.0 / 21.0;
+    s = s * f2 + 1.0 / 19.0;
+    s = s * f2 + 1.0 / 17.0;
+    s = s * f2 + 1.0 / 15.0;
+    s = s * f2 + 1.0 / 13.0;
+    s = s * f2 + 1.0 / 11.0;
+    s = s * f2 + 1.0 / 9.0;
+    s = s * f2 + 1.0 / 7.0;
+    s = s * f2 + 1.0 / 5.0;
+    s = s * f2 + 1.0 / 3.0;
+    s = s * f2 + 1.0;
+
+    return e * LN2 + 2.0 * f * s;
+}
+
+/**
+ * @brief Fonction de répartition de la loi normale (A&S 7.1.26), identique
+ *        à normcdf() de MathHelpers mais sans branchement.
+ */
+#pragma omp declare simd notinbranch
+inline double normcdf(double x) {
+    const double a1 =  0.254829592;
+    const double a2 = -0.284496736;
+    const double a3 =  1.421413741;
+    const double a4 = -1.453152027;
+    const double a5 =  1.061405429;
+    const double p  =  0.3275911;
+
+    const double z = std::fabs(x) * 0.7071067811865476;
+    const double t = 1.0 / (1.0 + p * z);
+    const double y = 1.0 - (((((a5 * t + a4) * t) + a3) * t + a2) * t + a1) * t * vecmath::exp(-z * z);
+
+    return 0.5 * (1.0 + (x < 0 ? -y : y));
+}
+
+/**
+ * @brief Inverse de la fonction de répartition normale (Wichura, AS241),
+ *        précision ~1e-16 sur (0, 1). Les trois régions (centre, intermédiaire,
+ *        queue) sont évaluées puis sélectionnées, sans branchement.
+ */
+#pragma omp declare simd notinbranch
+inline double normInv(double u) {
+    const double q = u - 0.5;
+
+    // Région centrale : |q| <= 0.425
+    const double rc = 0.180625 - q * q;
+    const double central = q *
+        (((((((rc * 2509.0809287301226727 + 33430.575583588128105) * rc + 67265.770927008700853) * rc
+            + 45921.953931549871457) * rc + 13731.693765509461125) * rc + 1971.5909503065514427) * rc
+            + 133.14166789178437745) * rc + 3.387132872796366608) /
+        (((((((rc * 5226.495278852545925 + 28729.085735721942674) * rc + 39307.89580009271061) * rc
+            + 21213.794301586595867) * rc + 5394.1960214247511077) * rc + 687.1870074920579083) * rc
+            + 42.313330701600911252) * rc + 1.0);
+
+    // Queues : r = sqrt(-log(min(u, 1-u)))
+    const double tail = q < 0 ? u : 1.0 - u;
+    const double r = std::sqrt(-vecmath::log(tail > 1e-300 ? tail : 1e-300));
+
+    const double ri = r - 1.6;
+    const double intermediate =
+        (((((((ri * 7.7454501427834140764e-4 + 0.0227238449892691845833) * ri + 0.24178072517745061177) * ri
+            + 1.27045825245236838258) * ri + 3.64784832476320460504) * ri + 5.7694972214606914055) * ri
+            + 4.6303378461565452959) * ri + 1.42343711074968357734) /
+        (((((((ri * 1.05075007164441684324e-9 + 5.475938084995344946e-4) * ri + 0.0151986665636164571966) * ri
+            + 0.14810397642748007459) * ri + 0.68976733498510000455) * ri + 1.6763848301838038494) * ri
+            + 2.05319162663775882187) * ri + 1.0);
+
+    const double rt = r - 5.0;
+    const double farTail =
+        (((((((rt * 2.01033439929228813265e-7 + 2.71155556874348757815e-5) * rt + 0.0012426609473880784386) * rt
+            + 0.026532189526576123093) * rt + 0.29656057182850489123) * rt + 1.7848265399172913358) * rt
+            + 5.4637849111641143699) * rt + 6.6579046435011037772) /
+        (((((((rt * 2.04426310338993978564e-15 + 1.4215117583164458887e-7) * rt + 1.8463183175100546818e-5) * rt
+            + 7.868691311456132591e-4) * rt + 0.0148753612908506148525) * rt + 0.13692988092273580531) * rt
+            + 0.59983220655588793769) * rt + 1.0);
+
+    const double tailValue = r <= 5.0 ? intermediate : farTail;
+    const double signedTail = q < 0 ? -tailValue : tailValue;
+    return std::fabs(q) <= 0.425 ? central : signedTail;
+}
+
+/**
+ * @brief Uniforme dans (0, 1) à partir de 64 bits aléatoires : les 52 bits de
+ *        poids fort forment la mantisse de [1, 2), décalée d'une demi-unité.
+ */
+#pragma omp declare simd notinbranch
+inline double uniformFromBits(std::uint64_t bits) {
+    const double oneToTwo = bitsToDouble(0x3ff0000000000000ULL | (bits >> 12));
+    return (oneToTwo - 1.0) + 1.1102230246251565e-16; // + 2^-53
+}
+
+} // namespace vecmath
+
+#endif // VECTOR_MATH_HPP
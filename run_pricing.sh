@@ -39,6 +39,9 @@ echo ""
 # Créer le dossier output s'il n'existe pas
 mkdir -p output
 
+# Cache de résultats partagé entre les appels (PRICE_OPT_CACHE= pour le désactiver)
+export PRICE_OPT_CACHE="${PRICE_OPT_CACHE-output/pricing_cache.bin}"
+
 # Exécuter le programme C++
 echo "Exécution du programme..."
 "$EXECUTABLE" "$SPOT_PRICE" "$STRIKE_PRICE" "$RISK_FREE_RATE" "$VOLATILITY" "$TIME_TO_MATURITY" "$OPTION_TYPE"
@@ -3,26 +3,187 @@
 #include "models/BinomialModel.hpp"
 #include "models/MonteCarloModel.hpp"
 #include "models/FiniteDifferenceModel.hpp"
+#include "models/AmericanOptionPricer.hpp"
+#include "models/BaroneAdesiWhaleyModel.hpp"
+#include "models/BjerksundStenslandModel.hpp"
+#include "util/CsvFormat.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <map>
 #include <stdexcept>
 #include <functional>
+#include <cstdint>
+#include <string_view>
 #include <unordered_map> // Pour une gestion plus efficace des modèles
+#include <vector>
 
-// Méthode pour créer un modèle de pricing en fonction du nom
-std::unique_ptr<OptionPricingModel> PricingModelFactory::createModel(const std::string& modelName) {
+namespace {
+
+// Valeur d'un paramètre ; le texte d'origine est conservé quand elle vient
+// d'une spécification "Nom:clé=valeur", pour lire les entiers sans passer par un double
+struct ParameterValue {
+    double number;
+    std::string text;
+};
+
+using ParameterTable = std::map<std::string, ParameterValue>;
+
+// Valeur d'un paramètre, ou valeur par défaut s'il est absent
+double parameter(const ParameterTable& parameters, const std::string& key, double defaultValue) {
+    auto it = parameters.find(key);
+    return it != parameters.end() ? it->second.number : defaultValue;
+}
+
+// Paramètre entier (pas, chemins, graine) : nombre entier représentable dans T,
+// sinon std::invalid_argument
+template <typename T>
+T integerParameter(const ParameterTable& parameters, const std::string& key, T defaultValue) {
+    auto it = parameters.find(key);
+    if (it == parameters.end()) {
+        return defaultValue;
+    }
+    const ParameterValue& value = it->second;
+    T result{};
+    if (!value.text.empty()) {
+        const char* end = value.text.data() + value.text.size();
+        const auto parsed = std::from_chars(value.text.data(), end, result);
+        if (parsed.ec == std::errc() && parsed.ptr == end) {
+            return result;
+        }
+    } else if (std::isfinite(value.number) && value.number == std::trunc(value.number) &&
+               value.number >= static_cast<double>(std::numeric_limits<T>::min()) &&
+               value.number < 2.0 * static_cast<double>(std::numeric_limits<T>::max() / 2 + 1)) {
+        return static_cast<T>(value.number);
+    }
+    throw std::invalid_argument("parameter '" + key + "' must be an integer in [" +
+                                std::to_string(std::numeric_limits<T>::min()) + ", " +
+                                std::to_string(std::numeric_limits<T>::max()) + "]");
+}
+
+// Zone de confiance des approximations américaines, depuis les paramètres
+TrustedRegion trustedRegion(const ParameterTable& p) {
+    TrustedRegion region;
+    region.maxMaturity = parameter(p, "maxMaturity", region.maxMaturity);
+    region.maxTotalVolatility = parameter(p, "maxTotalVolatility", region.maxTotalVolatility);
+    region.maxLogMoneyness = parameter(p, "maxLogMoneyness", region.maxLogMoneyness);
+    region.fallbackToPde = parameter(p, "fallbackToPde", 1.0) != 0.0;
+    return region;
+}
+
+// Constructeur d'un modèle et liste des paramètres qu'il accepte
+struct ModelEntry {
+    std::vector<std::string> keys;
+    std::function<std::unique_ptr<OptionPricingModel>(const ParameterTable&)> create;
+};
+
+std::unique_ptr<OptionPricingModel> createFromTable(const std::string& modelName,
+                                                    const ParameterTable& parameters) {
     // Utilisation d'une map pour associer les noms de modèles à leurs constructeurs
-    static const std::unordered_map<std::string, std::function<std::unique_ptr<OptionPricingModel>()>> modelMap = {
-        {"BlackScholes", []() { return std::make_unique<BlackScholesModel>(); }},
-        {"Binomial", []() { return std::make_unique<BinomialModel>(); }},
-        {"MonteCarlo", []() { return std::make_unique<MonteCarloModel>(); }},
-        {"FiniteDifference", []() { return std::make_unique<FiniteDifferenceModel>(); }}
+    static const std::unordered_map<std::string, ModelEntry> modelMap = {
+        {"BlackScholes", {{}, [](const ParameterTable&) { return std::make_unique<BlackScholesModel>(); }}},
+        {"Binomial", {{"steps", "american", "exerciseDates", "leisenReimer"}, [](const ParameterTable& p) {
+            // exerciseDates > 0 : option bermudéenne
+            const int exerciseDates = integerParameter<int>(p, "exerciseDates", 0);
+            const ExerciseStyle exercise = exerciseDates > 0 ? ExerciseStyle::Bermudan
+                : (parameter(p, "american", 0.0) != 0.0 ? ExerciseStyle::American : ExerciseStyle::European);
+            return std::make_unique<BinomialModel>(
+                integerParameter<int>(p, "steps", 201), exercise,
+                parameter(p, "leisenReimer", 0.0) != 0.0 ? LatticeType::LeisenReimer : LatticeType::CoxRossRubinstein,
+                exerciseDates > 0 ? exerciseDates : 12);
+        }}},
+        {"MonteCarlo", {{"paths", "seed"}, [](const ParameterTable& p) {
+            return std::make_unique<MonteCarloModel>(
+                integerParameter<int>(p, "paths", 10000),
+                integerParameter<std::uint64_t>(p, "seed", MonteCarloModel::DEFAULT_SEED));
+        }}},
+        {"QuasiMonteCarlo", {{"paths", "randomizations", "seed"}, [](const ParameterTable& p) {
+            return std::make_unique<MonteCarloModel>(
+                integerParameter<int>(p, "paths", 4096), SamplingMethod::Sobol,
+                integerParameter<int>(p, "randomizations", MonteCarloModel::DEFAULT_RANDOMIZATIONS),
+                integerParameter<std::uint64_t>(p, "seed", MonteCarloModel::DEFAULT_SEED));
+        }}},
+        {"FiniteDifference", {{"timeSteps", "assetSteps", "rannacherSteps", "richardson"}, [](const ParameterTable& p) {
+            TimeSteppingPolicy timeStepping;
+            timeStepping.rannacherSteps = integerParameter<int>(p, "rannacherSteps", timeStepping.rannacherSteps);
+            timeStepping.richardson = parameter(p, "richardson", 0.0) != 0.0;
+            return std::make_unique<FiniteDifferenceModel>(
+                integerParameter<int>(p, "timeSteps", 100),
+                integerParameter<int>(p, "assetSteps", 100), GridType::Sinh, timeStepping);
+        }}},
+        {"American", {{"assetSteps", "timeStep", "psor"}, [](const ParameterTable& p) {
+            return std::make_unique<AmericanOptionPricer>(
+                integerParameter<int>(p, "assetSteps", 200), parameter(p, "timeStep", 0.001),
+                parameter(p, "psor", 0.0) != 0.0 ? AmericanSolver::ProjectedSOR : AmericanSolver::BrennanSchwartz);
+        }}},
+        {"BaroneAdesiWhaley", {{"maxMaturity", "maxTotalVolatility", "maxLogMoneyness", "fallbackToPde"},
+            [](const ParameterTable& p) { return std::make_unique<BaroneAdesiWhaleyModel>(trustedRegion(p)); }}},
+        {"BjerksundStensland", {{"maxMaturity", "maxTotalVolatility", "maxLogMoneyness", "fallbackToPde"},
+            [](const ParameterTable& p) { return std::make_unique<BjerksundStenslandModel>(trustedRegion(p)); }}}
     };
 
     // Recherche du modèle dans la map
     auto it = modelMap.find(modelName);
-    if (it != modelMap.end()) {
-        return it->second(); // Retourne une instance du modèle
+    if (it == modelMap.end()) {
+        // Si le modèle n'est pas trouvé, lance une exception
+        throw std::runtime_error("Unknown model name: " + modelName);
     }
 
-    // Si le modèle n'est pas trouvé, lance une exception
-    throw std::runtime_error("Unknown model name: " + modelName);
-}
\ No newline at end of file
+    // Vérification des paramètres fournis
+    for (const auto& entry : parameters) {
+        bool known = false;
+        for (const auto& key : it->second.keys) {
+            known = known || key == entry.first;
+        }
+        if (!known) {
+            throw std::invalid_argument("Unknown parameter '" + entry.first + "' for model " + modelName);
+        }
+    }
+
+    return it->second.create(parameters); // Retourne une instance du modèle
+}
+
+} // namespace
+
+// Méthode pour créer un modèle de pricing en fonction du nom
+std::unique_ptr<OptionPricingModel> PricingModelFactory::createModel(const std::string& modelName) {
+    return createModel(modelName, ModelParameters());
+}
+
+std::unique_ptr<OptionPricingModel> PricingModelFactory::createModel(const std::string& modelName,
+                                                                     const ModelParameters& parameters) {
+    ParameterTable table;
+    for (const auto& entry : parameters) {
+        table[entry.first] = ParameterValue{entry.second, std::string()};
+    }
+    return createFromTable(modelName, table);
+}
+
+// "Nom" ou "Nom:clé=valeur;clé=valeur"
+std::unique_ptr<OptionPricingModel> PricingModelFactory::createModelFromSpec(const std::string& spec) {
+    const std::size_t colon = spec.find(':');
+    if (colon == std::string::npos) {
+        return createModel(spec);
+    }
+
+    ParameterTable parameters;
+    std::string_view list(spec);
+    list.remove_prefix(colon + 1);
+    std::size_t start = 0;
+    while (start <= list.size()) {
+        const std::size_t end = std::min(list.find(';', start), list.size());
+        const std::string_view item = trimCsvField(list.substr(start, end - start));
+        if (!item.empty()) {
+            const std::size_t equals = item.find('=');
+            if (equals == std::string_view::npos) {
+                throw std::invalid_argument("invalid model parameter '" + std::string(item) + "'");
+            }
+            const std::string_view value = trimCsvField(item.substr(equals + 1));
+            parameters[std::string(trimCsvField(item.substr(0, equals)))] =
+                ParameterValue{parseCsvNumber(value, "model parameter"), std::string(value)};
+        }
+        start = end + 1;
+    }
+    return createFromTable(spec.substr(0, colon), parameters);
+}
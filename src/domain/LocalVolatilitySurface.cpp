@@ -0,0 +1,108 @@
+#include "domain/LocalVolatilitySurface.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+bool strictlyIncreasing(const std::vector<double>& values) {
+    return std::adjacent_find(values.begin(), values.end(),
+                              [](double a, double b) { return !(a < b); }) == values.end();
+}
+
+// Intervalle [v_i, v_{i+1}] contenant x, avec v_0 <= x <= v_last
+int bracket(const std::vector<double>& values, double x) {
+    const int last = static_cast<int>(values.size()) - 1;
+    if (last == 0) {
+        return 0;
+    }
+    const int i = static_cast<int>(std::upper_bound(values.begin(), values.end(), x) - values.begin()) - 1;
+    return std::clamp(i, 0, last - 1);
+}
+
+} // namespace
+
+LocalVolatilitySurface::LocalVolatilitySurface(std::vector<double> spots, std::vector<double> times,
+                                               std::vector<double> volatilities, SurfaceInterpolation interpolation)
+    : spots_(std::move(spots)), times_(std::move(times)), volatilities_(std::move(volatilities)),
+      interpolation_(interpolation) {
+    if (spots_.empty() || times_.empty() || volatilities_.size() != spots_.size() * times_.size()) {
+        throw std::invalid_argument("LocalVolatilitySurface: volatilities must hold one value per (spot, time) node");
+    }
+    if (!strictlyIncreasing(spots_) || !strictlyIncreasing(times_) || spots_.front() < 0 || times_.front() < 0) {
+        throw std::invalid_argument("LocalVolatilitySurface: spots and times must be non-negative and strictly increasing");
+    }
+    for (double sigma : volatilities_) {
+        if (!(sigma > 0) || !std::isfinite(sigma)) {
+            throw std::invalid_argument("LocalVolatilitySurface: volatilities must be positive");
+        }
+    }
+
+    if (interpolation_ == SurfaceInterpolation::Spline && spots_.size() >= 2) {
+        const int n = static_cast<int>(spots_.size());
+        rows_.resize(times_.size());
+        for (std::size_t j = 0; j < times_.size(); ++j) {
+            rows_[j].fit(spots_.data(), volatilities_.data() + j * spots_.size(), n);
+        }
+    }
+}
+
+LocalVolatilitySurface LocalVolatilitySurface::flat(double volatility) {
+    return LocalVolatilitySurface({1.0}, {0.0}, {volatility});
+}
+
+double LocalVolatilitySurface::rowValue(int j, int i, double S) const {
+    const std::size_t n = spots_.size();
+    const double* row = volatilities_.data() + j * n;
+    if (n == 1) {
+        return row[0];
+    }
+    if (!rows_.empty()) {
+        return rows_[j].value(S);
+    }
+    const double w = (S - spots_[i]) / (spots_[i + 1] - spots_[i]);
+    return row[i] + w * (row[i + 1] - row[i]);
+}
+
+double LocalVolatilitySurface::volatility(double spot, double time) const {
+    double sigma;
+    sample(time, &spot, 1, &sigma);
+    return sigma;
+}
+
+void LocalVolatilitySurface::sample(double time, const double* spots, int count, double* out) const {
+    // Date : interpolation linéaire entre les lignes j et j + 1, prolongement plat
+    const double t = std::clamp(time, times_.front(), times_.back());
+    const int j = bracket(times_, t);
+    const int next = std::min(j + 1, static_cast<int>(times_.size()) - 1);
+    const double w = next == j ? 0.0 : (t - times_[j]) / (times_[next] - times_[j]);
+
+    const int lastInterval = std::max(static_cast<int>(spots_.size()) - 2, 0);
+    int i = 0;
+    for (int k = 0; k < count; ++k) {
+        const double S = std::clamp(spots[k], spots_.front(), spots_.back());
+        // Les spots demandés sont croissants : l'intervalle ne fait qu'avancer
+        while (i < lastInterval && S >= spots_[i + 1]) {
+            ++i;
+        }
+        const double low = rowValue(j, i, S);
+        out[k] = w == 0.0 ? low : low + w * (rowValue(next, i, S) - low);
+    }
+}
+
+double LocalVolatilitySurface::maxVolatility() const {
+    return *std::max_element(volatilities_.begin(), volatilities_.end());
+}
+
+SurfaceInterpolation LocalVolatilitySurface::getInterpolation() const {
+    return interpolation_;
+}
+
+const std::vector<double>& LocalVolatilitySurface::getSpots() const {
+    return spots_;
+}
+
+const std::vector<double>& LocalVolatilitySurface::getTimes() const {
+    return times_;
+}
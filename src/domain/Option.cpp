@@ -3,14 +3,15 @@
 
 // Constructeur avec validation des paramètres
 Option::Option(double spotPrice, double strikePrice, double riskFreeRate, double volatility, double timeToMaturity, const std::string& type)
+    : Option(spotPrice, strikePrice, riskFreeRate, volatility, timeToMaturity, parseOptionType(type)) {
+}
+
+Option::Option(double spotPrice, double strikePrice, double riskFreeRate, double volatility, double timeToMaturity, OptionType type)
     : spotPrice_(spotPrice), strikePrice_(strikePrice), riskFreeRate_(riskFreeRate), volatility_(volatility), timeToMaturity_(timeToMaturity), type_(type) {
     // Validation des paramètres
     if (spotPrice <= 0 || strikePrice <= 0 || volatility <= 0 || timeToMaturity <= 0) {
         throw std::invalid_argument("Invalid option parameters: spotPrice, strikePrice, volatility, and timeToMaturity must be positive");
     }
-    if (type != "call" && type != "put") {
-        throw std::invalid_argument("Invalid option type: must be 'call' or 'put'");
-    }
 }
 
 // Getter pour le prix actuel de l'actif sous-jacent
@@ -40,5 +41,15 @@ double Option::getTimeToMaturity() const {
 
 // Getter pour le type d'option
 std::string Option::getType() const {
+    return toString(type_);
+}
+
+// Getter pour le type d'option (énumération)
+OptionType Option::getOptionType() const {
     return type_;
-}
\ No newline at end of file
+}
+
+// Représentation compacte de l'option
+OptionSpec Option::spec() const {
+    return OptionSpec{spotPrice_, strikePrice_, riskFreeRate_, volatility_, timeToMaturity_, type_};
+}
@@ -0,0 +1,38 @@
+#include "domain/OptionBatch.hpp"
+#include <stdexcept> // Pour std::invalid_argument
+
+void OptionBatch::reserve(std::size_t n) {
+    spot.reserve(n);
+    strike.reserve(n);
+    rate.reserve(n);
+    volatility.reserve(n);
+    maturity.reserve(n);
+    isCall.reserve(n);
+}
+
+void OptionBatch::add(double spotPrice, double strikePrice, double riskFreeRate,
+                      double vol, double timeToMaturity, bool call) {
+    // Même validation que le constructeur d'Option
+    if (spotPrice <= 0 || strikePrice <= 0 || vol <= 0 || timeToMaturity <= 0) {
+        throw std::invalid_argument("Invalid option parameters: spotPrice, strikePrice, volatility, and timeToMaturity must be positive");
+    }
+    spot.push_back(spotPrice);
+    strike.push_back(strikePrice);
+    rate.push_back(riskFreeRate);
+    volatility.push_back(vol);
+    maturity.push_back(timeToMaturity);
+    isCall.push_back(call ? 1 : 0);
+}
+
+void OptionBatch::add(const OptionSpec& option) {
+    add(option.spot, option.strike, option.rate, option.volatility, option.maturity, option.isCall());
+}
+
+OptionSpec OptionBatch::spec(std::size_t i) const {
+    return OptionSpec{spot[i], strike[i], rate[i], volatility[i], maturity[i],
+                      isCall[i] ? OptionType::Call : OptionType::Put};
+}
+
+std::size_t OptionBatch::size() const {
+    return spot.size();
+}
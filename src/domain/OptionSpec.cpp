@@ -0,0 +1,16 @@
+#include "domain/OptionSpec.hpp"
+#include <stdexcept> // Pour std::invalid_argument
+
+OptionType parseOptionType(const std::string& type) {
+    if (type == "call") {
+        return OptionType::Call;
+    }
+    if (type == "put") {
+        return OptionType::Put;
+    }
+    throw std::invalid_argument("Invalid option type: must be 'call' or 'put'");
+}
+
+const char* toString(OptionType type) {
+    return type == OptionType::Call ? "call" : "put";
+}
@@ -5,6 +5,12 @@
 #include "util/GreeksCalculator.hpp"
 #include "util/OptionDataExporter.hpp"
 #include "models/AmericanOptionPricer.hpp"
+#include "util/BatchPricer.hpp"
+#include "util/ColumnarFile.hpp"
+#include "util/PricingCache.hpp"
+#include "models/CachedPricingModel.hpp"
+#include "util/PricingServer.hpp"
+#include "util/ScenarioGrid.hpp"
 
 #include <iostream>
 #include <memory>
@@ -13,7 +19,11 @@
 #include <chrono>
 #include <iomanip>
 #include <cmath>
-#include <cstdlib> // Pour system("mkdir -p ...") sous Linux/Mac
+#include <fstream>
+#include <sstream>
+#include <cstdlib> // Pour std::getenv
+#include <csignal>
+#include <filesystem>
 
 /**
  * @brief Vérifie que l'optionType est "call" ou "put".
@@ -22,10 +32,431 @@ bool isOptionTypeValid(const std::string& optionType) {
     return optionType == "call" || optionType == "put";
 }
 
+/**
+ * @brief Vrai si le chemin désigne un fichier binaire en colonnes (extension .opcb).
+ */
+bool hasColumnarExtension(const std::string& path) {
+    const std::string extension = ".opcb";
+    return path.size() > extension.size() && path.compare(path.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+/**
+ * @brief Cache partagé désigné par la variable d'environnement PRICE_OPT_CACHE,
+ *        nul si elle est absente ou vide, ou si le fichier ne peut pas être ouvert.
+ */
+std::shared_ptr<PricingCache> openSharedCache() {
+    const char* path = std::getenv("PRICE_OPT_CACHE");
+    if (!path || !*path) {
+        return nullptr;
+    }
+    try {
+        return std::make_shared<PricingCache>(path);
+    } catch (const std::exception& e) {
+        std::cerr << "Cache désactivé : " << e.what() << std::endl;
+        return nullptr;
+    }
+}
+
+/**
+ * @brief Enveloppe le modèle dans le cache partagé, s'il y en a un et si le
+ *        modèle coûte plus qu'une lecture du cache.
+ */
+std::shared_ptr<const OptionPricingModel> withCache(const std::shared_ptr<PricingCache>& cache,
+                                                    std::shared_ptr<const OptionPricingModel> model,
+                                                    const std::string& description) {
+    if (!cache || !CachedPricingModel::isWorthCaching(*model)) {
+        return model;
+    }
+    return std::make_shared<CachedPricingModel>(std::move(model), cache, description);
+}
+
+/**
+ * @brief Affiche les compteurs du cache (partagés par tous les processus).
+ */
+void printCacheStats(std::ostream& out, const PricingCache& cache) {
+    const CacheStats stats = cache.stats();
+    out << "Cache " << cache.path() << " : " << stats.hits << " succès, " << stats.misses << " défauts ("
+        << std::fixed << std::setprecision(1) << 100.0 * stats.hitRate() << " %), " << stats.entries << "/"
+        << stats.capacity << " entrées, " << stats.evictions << " remplacements" << std::defaultfloat << std::endl;
+}
+
+/**
+ * @brief Statistiques du cache : price_opt --cache-stats <fichier> [--clear]
+ */
+int runCacheStats(int argc, char* argv[]) {
+    if (argc < 3 || argc > 4 || (argc == 4 && std::string(argv[3]) != "--clear")) {
+        std::cerr << "Usage : " << argv[0] << " --cache-stats <cache file> [--clear]" << std::endl;
+        return 1;
+    }
+    try {
+        PricingCache cache(argv[2]);
+        printCacheStats(std::cout, cache);
+        if (argc == 4) {
+            cache.clear();
+            std::cout << "Cache vidé" << std::endl;
+        }
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur de cache : " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+/**
+ * @brief Conversion : price_opt --convert <entrée> <sortie>
+ *        Un fichier binaire est converti en CSV, un CSV (ou '-') en binaire.
+ */
+int runConvert(int argc, char* argv[]) {
+    if (argc != 4) {
+        std::cerr << "Usage : " << argv[0] << " --convert <input.csv|input.opcb|-> <output.opcb|output.csv|->" << std::endl;
+        return 1;
+    }
+    const std::string inputPath = argv[2];
+    const std::string outputPath = argv[3];
+    try {
+        std::ios::sync_with_stdio(false);
+        std::size_t rows;
+        if (inputPath != "-" && ColumnarReader::isColumnarFile(inputPath)) {
+            std::ofstream outputFile;
+            if (outputPath != "-") {
+                outputFile.open(outputPath);
+                if (!outputFile.is_open()) {
+                    throw std::runtime_error("Could not open file: " + outputPath);
+                }
+            }
+            rows = convertColumnarToCsv(inputPath, outputPath == "-" ? std::cout : outputFile);
+        } else {
+            if (outputPath == "-") {
+                throw std::invalid_argument("a binary file cannot be written to the standard output");
+            }
+            std::ifstream inputFile;
+            if (inputPath != "-") {
+                inputFile.open(inputPath);
+                if (!inputFile.is_open()) {
+                    throw std::runtime_error("Could not open file: " + inputPath);
+                }
+            }
+            rows = convertCsvToColumnar(inputPath == "-" ? std::cin : inputFile, outputPath);
+        }
+        std::cerr << rows << " lignes converties" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur de conversion : " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+/**
+ * @brief Mode portefeuille :
+ *        price_opt --batch <entrée.csv|entrée.opcb|-> [--output <sortie.csv|sortie.opcb|->]
+ *                  [--greeks delta,gamma,vega,theta,rho] [--chunk N] [--model Nom] [--cache <fichier>]
+ *        Les résultats sont écrits au fil de l'eau, le résumé sur la sortie d'erreur.
+ *        Entrée et sortie sont toutes deux en CSV ou toutes deux au format binaire.
+ */
+int runBatch(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage : " << argv[0] << " --batch <input.csv|input.opcb|-> [--output <file|->]"
+                  << " [--greeks delta,gamma,vega,theta,rho] [--chunk N] [--model Name] [--cache <file>]" << std::endl;
+        return 1;
+    }
+
+    const std::string inputPath = argv[2];
+    std::string outputPath = "-";
+    BatchSettings settings;
+    try {
+        for (int i = 3; i < argc; ++i) {
+            const std::string flag = argv[i];
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("missing value for " + flag);
+            }
+            const std::string value = argv[++i];
+            if (flag == "--output") {
+                outputPath = value;
+            } else if (flag == "--greeks") {
+                std::istringstream names(value);
+                std::string name;
+                while (std::getline(names, name, ',')) {
+                    settings.greeks.push_back(parseGreekColumn(name));
+                }
+            } else if (flag == "--chunk") {
+                settings.chunkRows = std::stoul(value);
+            } else if (flag == "--model") {
+                settings.defaultModel = value;
+            } else if (flag == "--cache") {
+                settings.cache = std::make_shared<PricingCache>(value);
+            } else {
+                throw std::invalid_argument("unknown option " + flag);
+            }
+        }
+
+        std::ios::sync_with_stdio(false);
+        BatchPricer pricer(settings);
+        BatchSummary summary;
+
+        // Portefeuille binaire (.opcb) : lecture projetée en mémoire, résultats en colonnes
+        const bool binaryInput = inputPath != "-" && ColumnarReader::isColumnarFile(inputPath);
+        const bool binaryOutput = hasColumnarExtension(outputPath);
+        if (binaryInput != binaryOutput) {
+            throw std::invalid_argument("input and output must both be CSV or both .opcb (see --convert)");
+        }
+        if (binaryInput) {
+            const ColumnarReader input(inputPath);
+            ColumnarWriter output(outputPath, pricer.resultSchema());
+            summary = pricer.run(input, output);
+            output.close();
+        } else {
+            std::ifstream inputFile;
+            std::ofstream outputFile;
+            if (inputPath != "-") {
+                inputFile.open(inputPath);
+                if (!inputFile.is_open()) {
+                    throw std::runtime_error("Could not open file: " + inputPath);
+                }
+            }
+            if (outputPath != "-") {
+                outputFile.open(outputPath);
+                if (!outputFile.is_open()) {
+                    throw std::runtime_error("Could not open file: " + outputPath);
+                }
+            }
+            summary = pricer.run(inputPath == "-" ? std::cin : inputFile,
+                                 outputPath == "-" ? std::cout : outputFile);
+        }
+
+        std::cerr << summary.rows << " options pricées (" << summary.failed << " en erreur) en "
+                  << summary.seconds << " s";
+        if (summary.seconds > 0) {
+            std::cerr << ", " << static_cast<long>(summary.rows / summary.seconds) << " options/s";
+        }
+        std::cerr << std::endl;
+        if (settings.cache) {
+            printCacheStats(std::cerr, *settings.cache);
+        }
+        return summary.failed == 0 ? 0 : 2;
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur en mode portefeuille : " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+/**
+ * @brief Serveur en cours d'exécution, arrêté par SIGINT / SIGTERM.
+ */
+PricingServer* activeServer = nullptr;
+
+void stopServer(int) {
+    if (activeServer) {
+        activeServer->stop();
+    }
+}
+
+/**
+ * @brief Mode résident : price_opt --serve <socket> [--model Nom] [--threads N] [--cache <fichier>]
+ *        Requêtes JSON ligne à ligne (voir PricingService), jusqu'à SIGINT, SIGTERM
+ *        ou la commande {"command": "shutdown"}.
+ */
+int runServe(int argc, char* argv[]) {
+    if (argc < 3 || argc % 2 == 0) {
+        std::cerr << "Usage : " << argv[0] << " --serve <socket> [--model Name] [--threads N] [--cache <file>]"
+                  << std::endl;
+        return 1;
+    }
+    try {
+        ServerSettings settings;
+        settings.socketPath = argv[2];
+        ServiceSettings serviceSettings;
+        for (int i = 3; i + 1 < argc; i += 2) {
+            const std::string flag = argv[i];
+            const std::string value = argv[i + 1];
+            if (flag == "--model") {
+                serviceSettings.defaultModel = value;
+            } else if (flag == "--threads") {
+                serviceSettings.threads = std::stoi(value);
+            } else if (flag == "--cache") {
+                serviceSettings.cache = std::make_shared<PricingCache>(value);
+            } else {
+                throw std::invalid_argument("unknown option " + flag);
+            }
+        }
+
+        PricingService service(serviceSettings);
+        PricingServer server(settings, service);
+        activeServer = &server;
+        std::signal(SIGINT, stopServer);
+        std::signal(SIGTERM, stopServer);
+        std::cerr << "Serveur de pricing à l'écoute sur " << server.socketPath() << std::endl;
+        server.run();
+        activeServer = nullptr;
+
+        const ServiceStats stats = service.stats();
+        std::cerr << "Serveur arrêté : " << stats.requests << " requêtes, " << stats.options << " options, "
+                  << stats.failed << " en erreur" << std::endl;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur du serveur : " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+/**
+ * @brief Client : price_opt --client <socket> [requête JSON]
+ *        Sans requête, chaque ligne de l'entrée standard est envoyée et sa
+ *        réponse écrite sur la sortie standard.
+ */
+int runClient(int argc, char* argv[]) {
+    if (argc < 3 || argc > 4) {
+        std::cerr << "Usage : " << argv[0] << " --client <socket> [JSON request]" << std::endl;
+        return 1;
+    }
+    try {
+        PricingClient client(argv[2]);
+        if (argc == 4) {
+            std::cout << client.request(argv[3]) << std::endl;
+            return 0;
+        }
+        std::string line;
+        while (std::getline(std::cin, line)) {
+            if (line.find_first_not_of(" \t\r") != std::string::npos) {
+                std::cout << client.request(line) << '\n';
+            }
+        }
+        std::cout << std::flush;
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur du client : " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+/**
+ * @brief Axe de scénarios : "first:last:points" ou une valeur seule.
+ */
+std::vector<double> parseScenarioAxis(const std::string& text) {
+    std::vector<std::string> parts;
+    std::istringstream fields(text);
+    std::string field;
+    while (std::getline(fields, field, ':')) {
+        parts.push_back(field);
+    }
+    if (parts.size() == 1) {
+        return {std::stod(parts[0])};
+    }
+    if (parts.size() != 3) {
+        throw std::invalid_argument("axis must be first:last:points or a single value: " + text);
+    }
+    return ScenarioAxes::linspace(std::stod(parts[0]), std::stod(parts[1]), std::stoi(parts[2]));
+}
+
+/**
+ * @brief Grille de scénarios : price_opt --scenarios <sortie.csv|sortie.opcb>
+ *        [--option S,K,r,sigma,T,type] [--model Spec] [--spots a:b:n] [--vols a:b:n]
+ *        [--maturities a:b:n] [--rates a:b:n] [--threads N] [--cache <fichier>]
+ */
+int runScenarios(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage : " << argv[0] << " --scenarios <output.csv|output.opcb> [--option S,K,r,sigma,T,type]"
+                  << " [--model Spec] [--spots a:b:n] [--vols a:b:n] [--maturities a:b:n] [--rates a:b:n]"
+                  << " [--threads N] [--cache <file>]" << std::endl;
+        return 1;
+    }
+
+    const std::string outputPath = argv[2];
+    OptionSpec option{100.0, 100.0, 0.05, 0.2, 1.0, OptionType::Put};
+    std::string modelSpec = "BlackScholes";
+    std::shared_ptr<PricingCache> cache;
+    ScenarioAxes axes;
+    ScenarioSettings settings;
+    try {
+        bool spotsGiven = false;
+        for (int i = 3; i < argc; ++i) {
+            const std::string flag = argv[i];
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("missing value for " + flag);
+            }
+            const std::string value = argv[++i];
+            if (flag == "--option") {
+                std::vector<std::string> fields;
+                std::istringstream parts(value);
+                std::string field;
+                while (std::getline(parts, field, ',')) {
+                    fields.push_back(field);
+                }
+                if (fields.size() != 6) {
+                    throw std::invalid_argument("--option expects S,K,r,sigma,T,type");
+                }
+                option = OptionSpec{std::stod(fields[0]), std::stod(fields[1]), std::stod(fields[2]),
+                                    std::stod(fields[3]), std::stod(fields[4]), parseOptionType(fields[5])};
+            } else if (flag == "--model") {
+                modelSpec = value;
+            } else if (flag == "--spots") {
+                axes.spots = parseScenarioAxis(value);
+                spotsGiven = true;
+            } else if (flag == "--vols") {
+                axes.volatilities = parseScenarioAxis(value);
+            } else if (flag == "--maturities") {
+                axes.maturities = parseScenarioAxis(value);
+            } else if (flag == "--rates") {
+                axes.rates = parseScenarioAxis(value);
+            } else if (flag == "--threads") {
+                settings.threads = std::stoi(value);
+            } else if (flag == "--cache") {
+                cache = std::make_shared<PricingCache>(value);
+            } else {
+                throw std::invalid_argument("unknown option " + flag);
+            }
+        }
+        if (!spotsGiven) {
+            axes.spots = ScenarioAxes::spotProfile(option).spots;
+        }
+
+        std::shared_ptr<const OptionPricingModel> model = PricingModelFactory::createModelFromSpec(modelSpec);
+        if (!model) {
+            throw std::invalid_argument("unknown model '" + modelSpec + "'");
+        }
+        // Les différences finies partagent déjà une résolution par tranche : pas de cache par point
+        if (!dynamic_cast<const FiniteDifferenceModel*>(model.get())) {
+            model = withCache(cache, std::move(model), modelSpec);
+        }
+        const ScenarioReport report = OptionDataExporter::exportScenarioGrid(*model, option, axes, outputPath, settings);
+
+        std::cerr << report.points << " scénarios (" << report.slices << " tranches";
+        if (report.solves > 0) {
+            std::cerr << ", " << report.solves << " résolutions PDE";
+        }
+        std::cerr << ") en " << report.seconds << " s" << std::endl;
+        if (cache) {
+            printCacheStats(std::cerr, *cache);
+        }
+        return 0;
+    } catch (const std::exception& e) {
+        std::cerr << "Erreur en mode scénarios : " << e.what() << std::endl;
+        return 1;
+    }
+}
+
 /**
  * @brief Fonction principale pour calculer le prix des options et les Greeks.
  */
 int main(int argc, char* argv[]) {
+    if (argc > 1 && std::string(argv[1]) == "--batch") {
+        return runBatch(argc, argv);
+    }
+    if (argc > 1 && std::string(argv[1]) == "--convert") {
+        return runConvert(argc, argv);
+    }
+    if (argc > 1 && std::string(argv[1]) == "--cache-stats") {
+        return runCacheStats(argc, argv);
+    }
+    if (argc > 1 && std::string(argv[1]) == "--serve") {
+        return runServe(argc, argv);
+    }
+    if (argc > 1 && std::string(argv[1]) == "--client") {
+        return runClient(argc, argv);
+    }
+    if (argc > 1 && std::string(argv[1]) == "--scenarios") {
+        return runScenarios(argc, argv);
+    }
+
     // Paramètres par défaut
     double spotPrice = 100.0;
     double strikePrice = 100.0;
@@ -63,79 +494,73 @@ int main(int argc, char* argv[]) {
     // Création de l'Option
     Option option(spotPrice, strikePrice, riskFreeRate, volatility, timeToMaturity, optionType);
 
-    // Crée un répertoire pour l'export éventuel des résultats
-    system("mkdir -p output");
+    // Crée un répertoire pour l'export éventuel des résultats (sans lancer de shell)
+    std::error_code directoryError;
+    std::filesystem::create_directories("output", directoryError);
+
+    // Cache de résultats partagé entre les appels successifs (facultatif)
+    const std::shared_ptr<PricingCache> cache = openSharedCache();
 
     // ====================================================================
-    // Calcul du prix d'une option américaine avec Crank-Nicolson
+    // Calcul du prix et des Greeks d'une option américaine avec Crank-Nicolson
     // ====================================================================
+    // Un seul pricer : la configuration est stockée, les résolutions sont faites
+    // à la demande et mémorisées (le prix central est réutilisé par les Greeks)
     std::cout << "Prix de l'option américaine (Crank-Nicolson):" << std::endl;
     try {
         // Paramètres spécifiques au modèle
         int stockSteps = 120;       // Nombre de divisions sur l'axe du prix du sous-jacent
         double deltaT = 0.005;      // Taille du pas de temps
 
-        // Instanciation du pricer américain
-        AmericanOptionPricer americanPricer(spotPrice, strikePrice, timeToMaturity, volatility, riskFreeRate, stockSteps, deltaT, optionType);
+        auto americanPricer = std::make_shared<const AmericanOptionPricer>(stockSteps, deltaT);
+        // Avec PRICE_OPT_CACHE, prix et Greeks déjà calculés par un autre appel sont relus
+        const auto american = withCache(cache, americanPricer, "American:assetSteps=" + std::to_string(stockSteps) +
+                                                                   ";timeStep=" + std::to_string(deltaT));
 
         // Calcul du prix
-        double americanPrice = americanPricer.Value();
+        double americanPrice = american->calculatePrice(option);
         std::cout << "  Prix (Crank-Nicolson): " << americanPrice << "\n" << std::endl;
 
+        // Calcul des Greeks
+        std::cout << "Greeks pour l'option américaine (Crank-Nicolson):" << std::endl;
+        const Greeks americanGreeks = GreeksCalculator::greeks(*american, option);
+
+        std::cout << "  Delta: " << americanGreeks.delta
+                << "\n  Gamma: " << americanGreeks.gamma
+                << "\n  Theta: " << americanGreeks.theta
+                << "\n  Rho:   " << americanGreeks.rho
+                << "\n  Vega:  " << americanGreeks.vega
+                << "\n-----------------------------------------\n" << std::endl;
+
         // Export des données de l'option américaine
         std::string americanCsvFilename = "output/american_option_data.csv";
-        OptionDataExporter::exportToCSV(americanPricer, option, americanCsvFilename);
+        if (auto* cached = dynamic_cast<const CachedPricingModel*>(american.get())) {
+            OptionDataExporter::exportToCSV(*cached, option, americanCsvFilename);
+        } else {
+            OptionDataExporter::exportToCSV(*americanPricer, option, americanCsvFilename);
+        }
         std::cout << "Données de l'option américaine exportées vers : " << americanCsvFilename << "\n" << std::endl;
     } catch (const std::exception& e) {
         std::cerr << "Erreur lors du calcul de l'option américaine : " << e.what() << std::endl;
     }
 
-    // ====================================================================
-    // Calcul des Greeks pour l'option américaine
-    // ====================================================================
-    std::cout << "Greeks pour l'option américaine (Crank-Nicolson):" << std::endl;
-    try {
-        // Paramètres spécifiques au modèle
-        int stockSteps = 120;       // Nombre de divisions sur l'axe du prix du sous-jacent
-        double deltaT = 0.005;      // Taille du pas de temps
-
-        // Instanciation du pricer américain
-        AmericanOptionPricer americanPricer(spotPrice, strikePrice, timeToMaturity, volatility, riskFreeRate, stockSteps, deltaT, optionType);
-
-        // Calcul des Greeks
-        auto delta_am = GreeksCalculator::delta(americanPricer, option);
-        auto gamma_am = GreeksCalculator::gamma(americanPricer, option);
-        auto theta_am = GreeksCalculator::theta(americanPricer, option);
-        auto rho_am   = GreeksCalculator::rho(americanPricer, option);
-        auto vega_am  = GreeksCalculator::vega(americanPricer, option);
-
-        std::cout << "  Delta: " << delta_am
-                << "\n  Gamma: " << gamma_am
-                << "\n  Theta: " << theta_am
-                << "\n  Rho:   " << rho_am
-                << "\n  Vega:  " << vega_am
-                << "\n-----------------------------------------\n" << std::endl;
-    } catch (const std::exception& e) {
-        std::cerr << "Erreur lors du calcul des Greeks pour l'option américaine : " << e.what() << std::endl;
-    }
-
     // ====================================================================
     // Calcul et affichage des Greeks via le modèle Black-Scholes
     // ====================================================================
     try {
         BlackScholesModel bsModel;
         std::cout << "Black-Scholes Greeks:" << std::endl;
-        auto delta_bs = GreeksCalculator::delta(bsModel, option);
-        auto gamma_bs = GreeksCalculator::gamma(bsModel, option);
-        auto theta_bs = GreeksCalculator::theta(bsModel, option);
-        auto rho_bs = GreeksCalculator::rho(bsModel, option);
-        auto vega_bs = GreeksCalculator::vega(bsModel, option);
-
-        std::cout << "  Delta: " << delta_bs
-                  << "\n  Gamma: " << gamma_bs
-                  << "\n  Theta: " << theta_bs
-                  << "\n  Rho:   " << rho_bs
-                  << "\n  Vega:  " << vega_bs
+        // Prix et Greeks analytiques en une seule passe
+        const Greeks bsGreeks = GreeksCalculator::greeks(bsModel, option);
+
+        std::cout << "  Delta: " << bsGreeks.delta
+                  << "\n  Gamma: " << bsGreeks.gamma
+                  << "\n  Theta: " << bsGreeks.theta
+                  << "\n  Rho:   " << bsGreeks.rho
+                  << "\n  Vega:  " << bsGreeks.vega
+                  << "\n  Vanna: " << bsGreeks.vanna
+                  << "\n  Volga: " << bsGreeks.volga
+                  << "\n  Charm: " << bsGreeks.charm
                   << "\n-----------------------------------------\n" << std::endl;
 
         // Export des données de Black-Scholes
@@ -147,35 +572,32 @@ int main(int argc, char* argv[]) {
     }
 
     // ====================================================================
-    // Boucle sur différents modèles : BlackScholes, MonteCarlo, FiniteDifference
+    // Boucle sur différents modèles : BlackScholes, MonteCarlo, QuasiMonteCarlo, FiniteDifference
     // ====================================================================
-    for (const std::string modelName : {"BlackScholes", "MonteCarlo", "FiniteDifference"}) {
+    for (const std::string modelName : {"BlackScholes", "MonteCarlo", "QuasiMonteCarlo", "FiniteDifference"}) {
         try {
-            auto model = PricingModelFactory::createModel(modelName);
+            std::shared_ptr<const OptionPricingModel> model = PricingModelFactory::createModel(modelName);
             if (!model) {
                 std::cerr << "Impossible de créer le modèle \"" << modelName << "\"." << std::endl;
                 continue;
             }
+            const auto pricer = withCache(cache, model, modelName);
 
-            double price = model->calculatePrice(option);
+            double price = pricer->calculatePrice(option);
             std::cout << std::setw(20) << modelName << ":\t " << price << std::endl;
 
             if (modelName == "FiniteDifference") {
-                auto* fdModel = dynamic_cast<FiniteDifferenceModel*>(model.get());
+                auto* fdModel = dynamic_cast<const FiniteDifferenceModel*>(model.get());
                 if (fdModel) {
                     // Calcul des Greeks pour le modèle de différences finies
                     std::cout << "\nCrank-Nicolson Greeks:" << std::endl;
-                    auto delta_fd = GreeksCalculator::delta(*fdModel, option);
-                    auto gamma_fd = GreeksCalculator::gamma(*fdModel, option);
-                    auto theta_fd = GreeksCalculator::theta(*fdModel, option);
-                    auto rho_fd = GreeksCalculator::rho(*fdModel, option);
-                    auto vega_fd = GreeksCalculator::vega(*fdModel, option);
-
-                    std::cout << "  Delta: " << delta_fd
-                              << "\n  Gamma: " << gamma_fd
-                              << "\n  Theta: " << theta_fd
-                              << "\n  Rho:   " << rho_fd
-                              << "\n  Vega:  " << vega_fd << std::endl;
+                    const Greeks fdGreeks = GreeksCalculator::greeks(*pricer, option);
+
+                    std::cout << "  Delta: " << fdGreeks.delta
+                              << "\n  Gamma: " << fdGreeks.gamma
+                              << "\n  Theta: " << fdGreeks.theta
+                              << "\n  Rho:   " << fdGreeks.rho
+                              << "\n  Vega:  " << fdGreeks.vega << std::endl;
 
                     // Export des données de différences finies
                     std::string fdCsvFilename = "output/finite_difference_data.csv";
@@ -188,5 +610,8 @@ int main(int argc, char* argv[]) {
         }
     }
 
+    if (cache) {
+        printCacheStats(std::cerr, *cache);
+    }
     return 0;
 }
\ No newline at end of file
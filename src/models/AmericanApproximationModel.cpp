@@ -0,0 +1,56 @@
+#include "models/AmericanApproximationModel.hpp"
+#include "util/MathHelpers.hpp"
+#include <cmath>
+
+static const long PARALLEL_BATCH_THRESHOLD = 1024;
+
+AmericanApproximationModel::AmericanApproximationModel(const TrustedRegion& region)
+    : region_(region), fallback_(region.pdeAssetSteps, region.pdeTimeStep) {}
+
+bool AmericanApproximationModel::isTrusted(const OptionSpec& option) const {
+    return option.maturity <= region_.maxMaturity &&
+           option.volatility * std::sqrt(option.maturity) <= region_.maxTotalVolatility &&
+           std::fabs(std::log(option.spot / option.strike)) <= region_.maxLogMoneyness;
+}
+
+const TrustedRegion& AmericanApproximationModel::getTrustedRegion() const {
+    return region_;
+}
+
+double AmericanApproximationModel::calculatePrice(const OptionSpec& option) const {
+    if (region_.fallbackToPde && !isTrusted(option)) {
+        return fallback_.calculatePrice(option);
+    }
+    return approximatePrice(option);
+}
+
+void AmericanApproximationModel::calculatePrices(const OptionBatch& batch, std::vector<double>& prices) const {
+    const long n = static_cast<long>(batch.size());
+    prices.resize(n);
+    // Ordonnancement dynamique : une option hors zone coûte une résolution PDE
+    #pragma omp parallel for schedule(dynamic, 64) if (n >= PARALLEL_BATCH_THRESHOLD)
+    for (long i = 0; i < n; ++i) {
+        prices[i] = calculatePrice(batch.spec(i));
+    }
+}
+
+double AmericanApproximationModel::europeanPrice(bool isCall, double S, double K, double T,
+                                                 double r, double b, double sigma) {
+    const double volSqrtT = sigma * std::sqrt(T);
+    const double d1 = (std::log(S / K) + (b + 0.5 * sigma * sigma) * T) / volSqrtT;
+    const double d2 = d1 - volSqrtT;
+    const double carry = std::exp((b - r) * T);
+    const double discount = std::exp(-r * T);
+    if (isCall) {
+        return S * carry * normcdf(d1) - K * discount * normcdf(d2);
+    }
+    return K * discount * normcdf(-d2) - S * carry * normcdf(-d1);
+}
+
+// Quelques itérations de Newton dans la zone de confiance, le PDE en dehors
+double AmericanApproximationModel::costHint(const OptionSpec& option) const {
+    if (!region_.fallbackToPde || isTrusted(option)) {
+        return 500.0;
+    }
+    return fallback_.costHint(option);
+}
@@ -1,126 +1,276 @@
 #include "models/AmericanOptionPricer.hpp"
+#include "util/SpotGrid.hpp"
+#include "util/TridiagonalSolver.hpp"
+#include "util/CubicSpline.hpp"
 #include <cmath>
-#include <iostream>
 #include <vector>
 #include <algorithm>
+#include <stdexcept>
 
-// Constructeur
-AmericanOptionPricer::AmericanOptionPricer(double S_now, double K, double T, double Vol, double r, int I, double delta_t, std::string optionType)
-    : S_now(S_now), K(K), T(T), Vol(Vol), r(r), I(I), delta_t(delta_t), optionType(optionType) {
-    // Calcul du prix de l'option américaine
-    Price = calculatePriceImpl(); // Utilise la méthode interne pour calculer le prix
+namespace {
+
+// Espace de travail d'une résolution, un par thread : les tableaux sont
+// conservés d'un appel à l'autre et ne sont réalloués que si la grille grandit
+struct AmericanWorkspace {
+    std::vector<double> S;             // Grille sinh, i = 0..I
+    std::vector<double> predictor;     // Second membre explicite
+    std::vector<double> Vprevious_j;
+    std::vector<double> Vcurrent_j;
+    std::vector<double> fix;           // Valeur d'exercice
+    std::vector<double> a, b, c;       // Opérateur explicite (I + dt/2 L)
+    std::vector<double> A, B, C;       // Opérateur implicite (I - dt/2 L)
+    std::vector<double> lower, diagonal, upper;
+    std::vector<double> sysLower, sysDiagonal, sysUpper; // Système de Brennan-Schwartz
+    std::vector<double> x, obstacle;
+    TridiagonalSolver system;
+
+    void resize(int I) {
+        for (std::vector<double>* v : {&predictor, &Vprevious_j, &Vcurrent_j, &fix, &a, &b, &c, &A, &B, &C}) {
+            v->assign(I + 1, 0.0);
+        }
+        for (std::vector<double>* v : {&lower, &diagonal, &upper, &sysLower, &sysDiagonal, &sysUpper, &x, &obstacle}) {
+            v->resize(I - 1);
+        }
+    }
+};
+
+AmericanWorkspace& threadWorkspace() {
+    thread_local AmericanWorkspace workspace;
+    return workspace;
 }
 
-// Méthode interne pour calculer le prix de l'option américaine
-double AmericanOptionPricer::calculatePriceImpl() const {
+} // namespace
+
+// Constructeur : configuration seule, aucune résolution
+AmericanOptionPricer::AmericanOptionPricer(int I, double delta_t, AmericanSolver solver)
+    : I_(I), delta_t_(delta_t), solver_(solver), hasOption_(false), option_() {
+    if (I < 2 || !(delta_t > 0.0)) {
+        throw std::invalid_argument("AmericanOptionPricer: I must be at least 2 and delta_t positive");
+    }
+}
+
+AmericanOptionPricer::AmericanOptionPricer(double S_now, double K, double T, double Vol, double r, int I, double delta_t, const std::string& optionType,
+                                           AmericanSolver solver)
+    : AmericanOptionPricer(S_now, K, T, Vol, r, I, delta_t, parseOptionType(optionType), solver) {
+}
+
+AmericanOptionPricer::AmericanOptionPricer(double S_now, double K, double T, double Vol, double r, int I, double delta_t, OptionType optionType,
+                                           AmericanSolver solver)
+    : AmericanOptionPricer(I, delta_t, solver) {
+    option_ = OptionSpec{S_now, K, r, Vol, T, optionType};
+    hasOption_ = true;
+}
+
+// Méthode interne : résout le contrat sur toute la grille (le spot n'intervient
+// pas) et renvoie la spline de la tranche finale
+std::shared_ptr<const CubicSpline> AmericanOptionPricer::solveGrid(const OptionSpec& option) const {
+    const double K = option.strike;
+    const double T = option.maturity;
+    const double Vol = option.volatility;
+    const double r = option.rate;
+    const int I = I_;
+    const double delta_t = delta_t_;
+    const AmericanSolver solver = solver_;
+
     int i, j, k;
-    double error, diff;
-    const double MAXk = 100;          // Nombre maximum d'itérations SOR
-    const double TOL = 1e-8;          // Tolérance pour SOR
-    const double DELTA_S = 3 * K / I; // Taille d'un pas pour le sous-jacent
-    const int i_STAR = static_cast<int>(S_now / DELTA_S);
-    const double WEIGHT = (S_now - i_STAR * DELTA_S) / DELTA_S;
-
-    const int J = static_cast<int>(T / delta_t);
+    const int MAXk = 1000;            // Nombre maximum d'itérations PSOR
+    const double TOL = 1e-12;         // Tolérance pour PSOR (somme des carrés des corrections)
+    // Grille sinh resserrée autour du strike, le strike (coude du payoff) sur un
+    // noeud ; indépendante du spot, elle sert à tous les spots du même contrat
+    const double S_MAX = maxSpot(option);
+    AmericanWorkspace& workspace = threadWorkspace();
+    workspace.resize(I);
+    std::vector<double>& S = workspace.S;
+    buildSpotGrid(GridType::Sinh, S_MAX, I, K, K, S, std::max(Vol * std::sqrt(T), 0.01));
+
+    const int J = std::max(static_cast<int>(T / delta_t), 1);
     double adjusted_delta_t = T / J;
 
-    const double W = 1.5; // Facteur de relaxation pour SOR
+    const bool isCall = option.isCall();
+    const int n = I - 1; // Noeuds intérieurs 1..I-1
 
-    std::vector<double> predictor(I + 1, 0.0);
-    std::vector<double> Vprevious_j(I + 1, 0.0);
-    std::vector<double> Vcurrent_j(I + 1, 0.0);
-    std::vector<double> fix(I + 1, 0.0);
-    std::vector<double> a(I + 1, 0.0);
-    std::vector<double> b(I + 1, 0.0);
-    std::vector<double> c(I + 1, 0.0);
-    std::vector<double> A(I + 1, 0.0);
-    std::vector<double> B(I + 1, 0.0);
-    std::vector<double> C(I + 1, 0.0);
+    std::vector<double>& predictor = workspace.predictor;
+    std::vector<double>& Vprevious_j = workspace.Vprevious_j;
+    std::vector<double>& Vcurrent_j = workspace.Vcurrent_j;
+    std::vector<double>& fix = workspace.fix;
+    std::vector<double>& a = workspace.a;
+    std::vector<double>& b = workspace.b;
+    std::vector<double>& c = workspace.c;
+    std::vector<double>& A = workspace.A;
+    std::vector<double>& B = workspace.B;
+    std::vector<double>& C = workspace.C;
 
-    // Initialisation des conditions initiales
+    // Initialisation des conditions initiales ; 'fix' est aussi la valeur d'exercice
     for (i = 0; i <= I; i++) {
-        double S = i * DELTA_S;
-        if (optionType == "call") {
-            Vprevious_j[i] = std::max(0.0, S - K); // Condition initiale pour une option call
+        if (isCall) {
+            Vprevious_j[i] = std::max(0.0, S[i] - K); // Condition initiale pour une option call
         } else {
-            Vprevious_j[i] = std::max(0.0, K - S); // Condition initiale pour une option put
+            Vprevious_j[i] = std::max(0.0, K - S[i]); // Condition initiale pour une option put
         }
         fix[i] = Vprevious_j[i];
     }
 
-    // Construction des coefficients
+    // Construction des coefficients : opérateur de Black-Scholes sur la grille non uniforme
+    std::vector<double>& lower = workspace.lower;
+    std::vector<double>& diagonal = workspace.diagonal;
+    std::vector<double>& upper = workspace.upper;
+    blackScholesOperator(S, Vol, r, lower.data(), diagonal.data(), upper.data());
     for (i = 1; i <= I - 1; i++) {
-        a[i] = adjusted_delta_t / 4 * (Vol * Vol * i * i - r * i);
-        b[i] = (1 - adjusted_delta_t / 2 * (r + Vol * Vol * i * i));
-        c[i] = (adjusted_delta_t / 4 * (Vol * Vol * i * i + r * i));
+        a[i] = adjusted_delta_t / 2 * lower[i - 1];
+        b[i] = 1 + adjusted_delta_t / 2 * diagonal[i - 1];
+        c[i] = adjusted_delta_t / 2 * upper[i - 1];
         A[i] = -a[i];
-        B[i] = (1 + adjusted_delta_t / 2 * (r + Vol * Vol * i * i));
+        B[i] = 1 - adjusted_delta_t / 2 * diagonal[i - 1];
         C[i] = -c[i];
     }
 
-    // Résolution Crank-Nicholson avec SOR
+    // Brennan-Schwartz : la zone d'exercice doit se trouver en fin de système.
+    // Pour un put (exercice aux petits S), les noeuds sont donc pris en ordre inverse
+    auto position = [&](int node) { return isCall ? node - 1 : n - node; };
+    TridiagonalSolver& system = workspace.system;
+    std::vector<double>& x = workspace.x;
+    std::vector<double>& obstacle = workspace.obstacle;
+    if (solver == AmericanSolver::BrennanSchwartz) {
+        std::vector<double>& sysLower = workspace.sysLower;
+        std::vector<double>& sysDiagonal = workspace.sysDiagonal;
+        std::vector<double>& sysUpper = workspace.sysUpper;
+        for (i = 1; i <= I - 1; i++) {
+            const int p = position(i);
+            sysDiagonal[p] = B[i];
+            sysLower[p] = isCall ? A[i] : C[i];
+            sysUpper[p] = isCall ? C[i] : A[i];
+            obstacle[p] = fix[i];
+        }
+        system.factorize(sysLower.data(), sysDiagonal.data(), sysUpper.data(), n);
+    }
+
+    // PSOR : le facteur de relaxation évolue d'un pas à l'autre dans le sens qui
+    // réduit le nombre d'itérations
+    double W = 1.0;
+    double W_step = 0.05;
+    int previousIterations = MAXk + 1;
+
+    // Résolution Crank-Nicholson, complémentarité linéaire à chaque pas
     for (j = 1; j <= J; j++) {
-        if (optionType == "call") {
+        if (isCall) {
             Vcurrent_j[0] = 0; // Limite inférieure pour une option call
-            Vcurrent_j[I] = I * DELTA_S - K * std::exp(-r * (T - j * adjusted_delta_t)); // Limite supérieure pour une option call
+            Vcurrent_j[I] = S[I] - K * std::exp(-r * (T - j * adjusted_delta_t)); // Limite supérieure pour une option call
         } else {
-            Vcurrent_j[0] = K * std::exp(-r * (T - j * adjusted_delta_t)); // Limite inférieure pour une option put
+            Vcurrent_j[0] = K; // Limite inférieure pour une option put : exercice immédiat en S = 0
             Vcurrent_j[I] = 0; // Limite supérieure pour une option put
         }
 
-        for (i = 1; i <= I - 1; i++) {
-            Vcurrent_j[i] = Vprevious_j[i];
-        }
-
         for (i = 1; i <= I - 1; i++) {
             predictor[i] = a[i] * Vprevious_j[i - 1] + b[i] * Vprevious_j[i] + c[i] * Vprevious_j[i + 1];
         }
 
-        k = 0;
-        do {
-            error = 0.0;
+        if (solver == AmericanSolver::BrennanSchwartz) {
+            // Les bords, connus, passent au second membre
+            predictor[1] -= A[1] * Vcurrent_j[0];
+            predictor[I - 1] -= C[I - 1] * Vcurrent_j[I];
+            for (i = 1; i <= I - 1; i++) {
+                x[position(i)] = predictor[i];
+            }
+            system.solveProjected(x.data(), obstacle.data());
+            for (i = 1; i <= I - 1; i++) {
+                Vcurrent_j[i] = x[position(i)];
+            }
+        } else {
             for (i = 1; i <= I - 1; i++) {
-                diff = (predictor[i] - A[i] * Vcurrent_j[i - 1] - C[i] * Vcurrent_j[i + 1]) / B[i] - Vcurrent_j[i];
-                error += diff * diff;
-                Vcurrent_j[i] += W * diff;
+                Vcurrent_j[i] = Vprevious_j[i];
             }
-            k++;
-        } while (error > TOL && k < MAXk);
 
-        // Exercice anticipé pour une option américaine
-        for (i = 1; i <= I - 1; i++) {
-            if (optionType == "call") {
-                Vcurrent_j[i] = std::max(Vcurrent_j[i], i * DELTA_S - K); // Exercice anticipé pour une option call
-            } else {
-                Vcurrent_j[i] = std::max(Vcurrent_j[i], K - i * DELTA_S); // Exercice anticipé pour une option put
+            // Projection à chaque mise à jour : itérations de Gauss-Seidel sur le
+            // problème de complémentarité, et non sur le système linéaire seul
+            double error;
+            k = 0;
+            do {
+                error = 0.0;
+                for (i = 1; i <= I - 1; i++) {
+                    const double gaussSeidel = (predictor[i] - A[i] * Vcurrent_j[i - 1] - C[i] * Vcurrent_j[i + 1]) / B[i];
+                    const double updated = std::max(fix[i], Vcurrent_j[i] + W * (gaussSeidel - Vcurrent_j[i]));
+                    const double diff = updated - Vcurrent_j[i];
+                    error += diff * diff;
+                    Vcurrent_j[i] = updated;
+                }
+                k++;
+            } while (error > TOL && k < MAXk);
+
+            if (k > previousIterations) {
+                W_step = -W_step;
             }
+            W = std::min(std::max(W + W_step, 1.0), 1.95);
+            previousIterations = k;
         }
 
-        for (i = 1; i <= I - 1; i++) {
+        for (i = 0; i <= I; i++) {
             Vprevious_j[i] = Vcurrent_j[i];
         }
     }
 
-    // Interpolation pour obtenir le prix final
-    if (i_STAR + 1 <= I) {
-        return (1 - WEIGHT) * Vprevious_j[i_STAR] + WEIGHT * Vprevious_j[i_STAR + 1];
-    } else {
-        return Vprevious_j[i_STAR];
-    }
+    return std::make_shared<const CubicSpline>(S, Vprevious_j);
+}
+
+// Borne haute de la grille : 3 K, ou 4 écarts-types du log-spot si c'est plus
+double AmericanOptionPricer::maxSpot(const OptionSpec& option) {
+    return option.strike * std::max(3.0, std::exp(4.0 * option.volatility * std::sqrt(option.maturity)));
 }
 
-// Méthode pour obtenir le prix de l'option
+// Méthode pour obtenir le prix de l'option liée au pricer
 double AmericanOptionPricer::Value() const {
-    return Price;
+    if (!hasOption_) {
+        throw std::logic_error("AmericanOptionPricer::Value: no option bound to this pricer");
+    }
+    return calculatePrice(option_);
 }
 
-// Méthode pour calculer le prix de l'option 
-double AmericanOptionPricer::calculatePrice(const Option& option) const {
-    // Crée une nouvelle instance de AmericanOptionPricer avec les paramètres de l'option
-    AmericanOptionPricer pricer(option.getSpotPrice(), option.getStrikePrice(), option.getTimeToMaturity(),
-                                option.getVolatility(), option.getRiskFreeRate(), I, delta_t, option.getType());
-    return pricer.Value();
+// Résolutions mémorisées par contrat : les appels répétés et les bumps de spot
+// (delta, gamma) sont lus sur la tranche déjà calculée. La résolution a lieu
+// hors du verrou
+double AmericanOptionPricer::calculatePrice(const OptionSpec& option) const {
+    const CacheKey key(option.strike, option.rate, option.volatility, option.maturity, option.type);
+    std::shared_ptr<const CubicSpline> slice;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto it = cache_.find(key);
+        if (it != cache_.end()) {
+            slice = it->second;
+        }
+    }
+
+    if (!slice) {
+        slice = solveGrid(option);
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        if (cache_.size() >= MAX_CACHED_SOLVES) {
+            cache_.clear();
+        }
+        cache_.emplace(key, slice);
+    }
+
+    // Au-delà de la grille, valeurs des conditions aux limites
+    const double S = option.spot;
+    const double K = option.strike;
+    if (S >= slice->maxX()) {
+        return option.isCall() ? S - K * std::exp(-option.rate * option.maturity) : 0.0;
+    }
+    const double exercise = option.isCall() ? std::max(S - K, 0.0) : std::max(K - S, 0.0);
+    return std::max(slice->value(S), exercise);
+}
+
+int AmericanOptionPricer::getAssetSteps() const {
+    return I_;
+}
+
+double AmericanOptionPricer::getTimeStep() const {
+    return delta_t_;
 }
 
-// Destructeur
-AmericanOptionPricer::~AmericanOptionPricer() {}
\ No newline at end of file
+AmericanSolver AmericanOptionPricer::getSolver() const {
+    return solver_;
+}
+
+// Résolution complète (hors cache) : le SOR projeté itère plusieurs fois par pas
+double AmericanOptionPricer::costHint(const OptionSpec& option) const {
+    const double steps = std::ceil(option.maturity / delta_t_);
+    return (solver_ == AmericanSolver::ProjectedSOR ? 10.0 : 4.0) * I_ * steps;
+}
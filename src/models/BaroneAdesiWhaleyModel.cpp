@@ -0,0 +1,121 @@
+#include "models/BaroneAdesiWhaleyModel.hpp"
+#include "util/MathHelpers.hpp"
+#include <cmath>
+
+namespace {
+
+const int MAX_NEWTON_ITERATIONS = 100;
+const double NEWTON_TOLERANCE = 1e-9; // Relative au strike
+
+// Paramètres communs : N = 2b / sigma^2, M = 2r / sigma^2, K(T) = 1 - e^{-rT}
+struct Quadratic {
+    double n, m, k;
+    double q;        // Racine q2 (call) ou q1 (put)
+    double carry;    // e^{(b - r) T}
+    double volSqrtT;
+};
+
+Quadratic quadratic(bool isCall, double T, double r, double b, double sigma) {
+    Quadratic p;
+    const double sigma2 = sigma * sigma;
+    p.n = 2.0 * b / sigma2;
+    p.m = 2.0 * r / sigma2;
+    p.k = 1.0 - std::exp(-r * T);
+    const double root = std::sqrt((p.n - 1.0) * (p.n - 1.0) + 4.0 * p.m / p.k);
+    p.q = isCall ? 0.5 * (-(p.n - 1.0) + root) : 0.5 * (-(p.n - 1.0) - root);
+    p.carry = std::exp((b - r) * T);
+    p.volSqrtT = sigma * std::sqrt(T);
+    return p;
+}
+
+double d1(double S, double K, double T, double b, double sigma) {
+    return (std::log(S / K) + (b + 0.5 * sigma * sigma) * T) / (sigma * std::sqrt(T));
+}
+
+} // namespace
+
+BaroneAdesiWhaleyModel::BaroneAdesiWhaleyModel(const TrustedRegion& region)
+    : AmericanApproximationModel(region) {}
+
+double BaroneAdesiWhaleyModel::criticalPrice(const OptionSpec& option) const {
+    const bool isCall = option.isCall();
+    const double K = option.strike;
+    const double T = option.maturity;
+    const double r = option.rate;
+    const double b = option.rate; // Pas de dividende
+    const double sigma = option.volatility;
+    const Quadratic p = quadratic(isCall, T, r, b, sigma);
+
+    // Point de départ de Barone-Adesi et Whaley : interpolation entre K et la
+    // frontière perpétuelle S(infini)
+    const double rootInfinity = std::sqrt((p.n - 1.0) * (p.n - 1.0) + 4.0 * p.m);
+    double S;
+    if (isCall) {
+        const double qInfinity = 0.5 * (-(p.n - 1.0) + rootInfinity);
+        const double sInfinity = K / (1.0 - 1.0 / qInfinity);
+        const double h = -(b * T + 2.0 * p.volSqrtT) * K / (sInfinity - K);
+        S = K + (sInfinity - K) * (1.0 - std::exp(h));
+    } else {
+        const double qInfinity = 0.5 * (-(p.n - 1.0) - rootInfinity);
+        const double sInfinity = K / (1.0 - 1.0 / qInfinity);
+        const double h = (b * T - 2.0 * p.volSqrtT) * K / (K - sInfinity);
+        S = sInfinity + (K - sInfinity) * std::exp(h);
+    }
+
+    // Newton sur la condition de raccordement valeur d'exercice = prix approché
+    for (int iteration = 0; iteration < MAX_NEWTON_ITERATIONS; ++iteration) {
+        const double d = d1(S, K, T, b, sigma);
+        const double european = europeanPrice(isCall, S, K, T, r, b, sigma);
+        double lhs, rhs, slope;
+        if (isCall) {
+            lhs = S - K;
+            rhs = european + (1.0 - p.carry * normcdf(d)) * S / p.q;
+            slope = p.carry * normcdf(d) * (1.0 - 1.0 / p.q) + (1.0 - p.carry * normpdf(d) / p.volSqrtT) / p.q;
+            if (std::fabs(lhs - rhs) < NEWTON_TOLERANCE * K) {
+                break;
+            }
+            S = (K + rhs - slope * S) / (1.0 - slope);
+        } else {
+            lhs = K - S;
+            rhs = european - (1.0 - p.carry * normcdf(-d)) * S / p.q;
+            slope = -p.carry * normcdf(-d) * (1.0 - 1.0 / p.q) - (1.0 + p.carry * normpdf(-d) / p.volSqrtT) / p.q;
+            if (std::fabs(lhs - rhs) < NEWTON_TOLERANCE * K) {
+                break;
+            }
+            S = (K - rhs + slope * S) / (1.0 + slope);
+        }
+    }
+    return S;
+}
+
+double BaroneAdesiWhaleyModel::approximatePrice(const OptionSpec& option) const {
+    const bool isCall = option.isCall();
+    const double S = option.spot;
+    const double K = option.strike;
+    const double T = option.maturity;
+    const double r = option.rate;
+    const double b = option.rate; // Pas de dividende
+    const double sigma = option.volatility;
+
+    const double european = europeanPrice(isCall, S, K, T, r, b, sigma);
+    // Call sans dividende (b >= r) : jamais exercé avant l'échéance
+    if ((isCall && b >= r) || r <= 0.0) {
+        return european;
+    }
+
+    const Quadratic p = quadratic(isCall, T, r, b, sigma);
+    const double critical = criticalPrice(option);
+    const double d = d1(critical, K, T, b, sigma);
+    if (isCall) {
+        if (S >= critical) {
+            return S - K;
+        }
+        const double A = critical / p.q * (1.0 - p.carry * normcdf(d));
+        return european + A * std::pow(S / critical, p.q);
+    }
+    if (S <= critical) {
+        return K - S;
+    }
+    const double A = -critical / p.q * (1.0 - p.carry * normcdf(-d));
+    return european + A * std::pow(S / critical, p.q);
+}
@@ -1,90 +1,207 @@
 #include "models/BinomialModel.hpp"
+#include "util/MathHelpers.hpp"
+#include "util/LatticeKernel.hpp"
 #include <vector>
 #include <cmath>
 #include <algorithm> 
+#include <stdexcept>
 
-BinomialModel::BinomialModel() {}
-
-// double BinomialModel::calculatePrice(const Option& option) const {
-//     const int steps = 12; // Hardcoded steps for monthly intervals
-//     double expiry = option.getTimeToMaturity();
-//     double annualVolatility = option.getVolatility();
-//     double riskFreeRate = option.getRiskFreeRate();
-//     double S = option.getSpotPrice();
-//     double K = option.getStrikePrice();
-
-//     // Calculate time per step, in years
-//     double deltaT = expiry / steps;
-//     // Adjust volatility for monthly steps
-//     double monthlyVolatility = annualVolatility / sqrt(12);
-
-//     // Cox-Ross-Rubinstein model parameters for monthly steps
-//     double upFactor = exp(monthlyVolatility * sqrt(deltaT));
-//     double downFactor = 1 / upFactor;
-//     double riskNeutralProb = (exp(riskFreeRate * deltaT) - downFactor) / (upFactor - downFactor);
-
-//     double optionPrice = 0.0;
-//     for (int i = 0; i <= steps; ++i) {
-//         double stockPriceAtNode = S * pow(upFactor, i) * pow(downFactor, steps - i);
-//         double payoff = 0;
-//         if (option.getType() == "call") {
-//             payoff = std::max(stockPriceAtNode - K, 0.0);
-//         } else { // put
-//             payoff = std::max(K - stockPriceAtNode, 0.0);
-//         }
-//         double binomialCoefficient = tgamma(steps + 1) / (tgamma(i + 1) * tgamma(steps - i + 1));
-//         optionPrice += binomialCoefficient * pow(riskNeutralProb, i) * pow(1 - riskNeutralProb, steps - i) * payoff;
-//     }
-
-//     // Discount back to present value
-//     optionPrice *= exp(-riskFreeRate * expiry);
-
-//     return optionPrice;
-// }
-
-
-
-
-double BinomialModel::calculatePrice(const Option& option) const {
-    const int steps = 12; // Number of steps in the binomial tree
-    const double S = option.getSpotPrice(); // Current stock price
-    const double K = option.getStrikePrice(); // Strike price
-    const double T = option.getTimeToMaturity(); // Time to maturity
-    const double r = option.getRiskFreeRate(); // Risk-free rate
-    const double sigma = option.getVolatility(); // Volatility
-    const std::string optionType = option.getType(); // "call" or "put"
-
-    // Calculate the up and down factors and the risk-neutral probability
-    const double dt = T / steps; // Time step
-    const double u = exp(sigma * sqrt(dt));
-    const double d = 1 / u;
-    const double q = (exp(r * dt) - d) / (u - d); // Risk-neutral probability
-
-    // Pre-compute powers of up and down factors and probabilities
-    std::vector<double> upPowers(steps + 1), downPowers(steps + 1);
-    upPowers[0] = downPowers[0] = 1.0; // u^0 and d^0
-    for (int i = 1; i <= steps; ++i) {
-        upPowers[i] = upPowers[i-1] * u;
-        downPowers[i] = downPowers[i-1] * d;
+namespace {
+
+// Inversion de Peizer-Pratt (méthode 2) utilisée par Leisen-Reimer
+double peizerPratt(double z, int n) {
+    const double t = z / (n + 1.0 / 3.0 + 0.1 / (n + 1.0));
+    const double root = 0.5 * std::sqrt(1.0 - std::exp(-t * t * (n + 1.0 / 6.0)));
+    return z >= 0.0 ? 0.5 + root : 0.5 - root;
+}
+
+// Black-Scholes sur le dernier pas (lissage de Broadie-Detemple)
+double europeanPrice(bool isCall, double S, double K, double T, double r, double sigma) {
+    const double volSqrtT = sigma * std::sqrt(T);
+    const double d1 = (std::log(S / K) + (r + 0.5 * sigma * sigma) * T) / volSqrtT;
+    const double d2 = d1 - volSqrtT;
+    const double discountedStrike = K * std::exp(-r * T);
+    return isCall ? S * normcdf(d1) - discountedStrike * normcdf(d2)
+                  : discountedStrike * normcdf(-d2) - S * normcdf(-d1);
+}
+
+// Rangées de l'arbre, une par thread, réutilisées d'un appel à l'autre
+struct LatticeWorkspace {
+    std::vector<double> values;
+    std::vector<double> spots;
+    std::vector<unsigned char> exercisable;
+
+    void resize(int nodes) {
+        values.resize(nodes);
+        spots.resize(nodes);
+        exercisable.resize(nodes);
+    }
+};
+
+LatticeWorkspace& threadWorkspace() {
+    thread_local LatticeWorkspace workspace;
+    return workspace;
+}
+
+} // namespace
+
+BinomialModel::BinomialModel(int steps, ExerciseStyle exercise, LatticeType lattice, int exerciseDates)
+    : steps_(steps), exercise_(exercise), lattice_(lattice), exerciseDates_(exerciseDates) {
+    if (steps < 4) {
+        throw std::invalid_argument("BinomialModel: steps must be at least 4");
+    }
+    if (exercise == ExerciseStyle::Bermudan && exerciseDates < 1) {
+        throw std::invalid_argument("BinomialModel: a Bermudan option needs at least one exercise date");
     }
+}
+
+int BinomialModel::getSteps() const {
+    return steps_;
+}
+
+ExerciseStyle BinomialModel::getExerciseStyle() const {
+    return exercise_;
+}
+
+LatticeType BinomialModel::getLatticeType() const {
+    return lattice_;
+}
+
+int BinomialModel::getExerciseDates() const {
+    return exerciseDates_;
+}
 
-    // Initialize option values at terminal nodes
-    std::vector<double> optionValuesAtTerminal(steps + 1);
-    for (int i = 0; i <= steps; ++i) {
-        double stockPriceAtNode = S * upPowers[i] * downPowers[steps - i];
-        if (optionType == "call") {
-            optionValuesAtTerminal[i] = std::max(stockPriceAtNode - K, 0.0);
-        } else { // put
-            optionValuesAtTerminal[i] = std::max(K - stockPriceAtNode, 0.0);
+double BinomialModel::rollback(const OptionSpec& option, double* levels) const {
+    const double S = option.spot; // Current stock price
+    const double K = option.strike; // Strike price
+    const double T = option.maturity; // Time to maturity
+    const double r = option.rate; // Risk-free rate
+    const double sigma = option.volatility; // Volatility
+    const bool isCall = option.isCall(); // Call or put
+
+    // Leisen-Reimer n'est défini que pour un nombre de pas impair
+    const bool leisenReimer = lattice_ == LatticeType::LeisenReimer;
+    const int N = leisenReimer ? (steps_ | 1) : steps_;
+    const double dt = T / N; // Time step
+    const double growth = std::exp(r * dt);
+
+    // Up and down factors and risk-neutral probability
+    double u, d, q;
+    if (leisenReimer) {
+        const double volSqrtT = sigma * std::sqrt(T);
+        const double d1 = (std::log(S / K) + (r + 0.5 * sigma * sigma) * T) / volSqrtT;
+        const double d2 = d1 - volSqrtT;
+        q = peizerPratt(d2, N);
+        u = growth * peizerPratt(d1, N) / q;
+        d = (growth - q * u) / (1.0 - q);
+    } else {
+        u = std::exp(sigma * std::sqrt(dt));
+        d = 1.0 / u;
+        q = (growth - d) / (u - d);
+    }
+    // Actualisation intégrée aux probabilités, calculée une seule fois
+    LatticeParameters parameters;
+    parameters.pu = q / growth;
+    parameters.pd = (1.0 - q) / growth;
+    parameters.inverseDown = 1.0 / d;
+    parameters.strike = K;
+    parameters.isCall = isCall;
+    const double ratio = u / d;
+
+    auto payoff = [&](double spot) { return isCall ? std::max(spot - K, 0.0) : std::max(K - spot, 0.0); };
+
+    LatticeWorkspace& workspace = threadWorkspace();
+    workspace.resize(N + 1);
+    double* V = workspace.values.data();
+    double* spots = workspace.spots.data();
+    unsigned char* exercisable = workspace.exercisable.data();
+
+    // Niveaux ouverts à l'exercice anticipé
+    bool anyExercise = false;
+    for (int step = 0; step <= N; ++step) {
+        bool open = exercise_ == ExerciseStyle::American;
+        if (exercise_ == ExerciseStyle::Bermudan) {
+            // Pas le plus proche de chaque date k T / exerciseDates
+            const long k = std::lround(static_cast<double>(step) * exerciseDates_ / N);
+            open = k >= 1 && std::lround(static_cast<double>(k) * N / exerciseDates_) == step;
         }
+        exercisable[step] = open ? 1 : 0;
+        anyExercise = anyExercise || (open && step < N);
     }
 
-    // Dynamic programming to fill the option price tree backward
-    for (int step = steps - 1; step >= 0; --step) {
-        for (int i = 0; i <= step; ++i) {
-            optionValuesAtTerminal[i] = exp(-r * dt) * (q * optionValuesAtTerminal[i + 1] + (1 - q) * optionValuesAtTerminal[i]);
+    // Valeurs terminales ; en CRR, le dernier pas est remplacé par Black-Scholes
+    // (Broadie-Detemple), ce qui supprime l'oscillation pair / impair
+    const int last = leisenReimer ? N : N - 1;
+    double spot = S * std::pow(d, last);
+    for (int i = 0; i <= last; ++i, spot *= ratio) {
+        spots[i] = spot;
+        V[i] = last == N ? payoff(spot) : europeanPrice(isCall, spot, K, dt, r, sigma);
+        if (last < N && exercisable[last]) {
+            V[i] = std::max(V[i], payoff(spot));
         }
     }
 
-    return optionValuesAtTerminal[0];
+    // Remontée jusqu'au niveau 2 : profondeur fixe si elle est courante,
+    // blocage temporel sinon
+    switch (last) {
+        case 100: rollbackFixedDepth<100>(parameters, exercisable, 2, V, spots); break;
+        case 101: rollbackFixedDepth<101>(parameters, exercisable, 2, V, spots); break;
+        case 200: rollbackFixedDepth<200>(parameters, exercisable, 2, V, spots); break;
+        case 201: rollbackFixedDepth<201>(parameters, exercisable, 2, V, spots); break;
+        case 500: rollbackFixedDepth<500>(parameters, exercisable, 2, V, spots); break;
+        case 501: rollbackFixedDepth<501>(parameters, exercisable, 2, V, spots); break;
+        case 1000: rollbackFixedDepth<1000>(parameters, exercisable, 2, V, spots); break;
+        case 1001: rollbackFixedDepth<1001>(parameters, exercisable, 2, V, spots); break;
+        default: rollbackLattice(last, 2, parameters, exercisable, V, spots); break;
+    }
+
+    if (levels) {
+        levels[2] = V[0];
+        levels[3] = V[1];
+        levels[4] = V[2];
+        levels[7] = S * d * d;
+        levels[8] = S * u * d;
+        levels[9] = S * u * u;
+    }
+    lattice::stepLevel(V, spots, 0, 2, exercisable[1] != 0, anyExercise, parameters);
+    if (levels) {
+        levels[0] = V[0];
+        levels[1] = V[1];
+        levels[5] = S * d;
+        levels[6] = S * u;
+        levels[10] = dt;
+    }
+    lattice::stepLevel(V, spots, 0, 1, exercisable[0] != 0, anyExercise, parameters);
+    return V[0];
+}
+
+double BinomialModel::calculatePrice(const OptionSpec& option) const {
+    return rollback(option, nullptr);
+}
+
+Greeks BinomialModel::calculateGreeks(const OptionSpec& option) const {
+    // V10 V11 V20 V21 V22 S10 S11 S20 S21 S22 dt
+    double levels[11];
+    Greeks g;
+    g.price = rollback(option, levels);
+
+    const double V10 = levels[0], V11 = levels[1];
+    const double V20 = levels[2], V21 = levels[3], V22 = levels[4];
+    const double S10 = levels[5], S11 = levels[6];
+    const double S20 = levels[7], S21 = levels[8], S22 = levels[9];
+    const double dt = levels[10];
+
+    g.delta = (V11 - V10) / (S11 - S10);
+    g.gamma = ((V22 - V21) / (S22 - S21) - (V21 - V20) / (S21 - S20)) / (0.5 * (S22 - S20));
+
+    // Theta = dV/dT : le noeud central du niveau 2 est ramené au spot initial
+    // (u d != 1 en Leisen-Reimer) par le delta de ce niveau
+    const double centre = V21 + (V22 - V20) / (S22 - S20) * (option.spot - S21);
+    g.theta = (g.price - centre) / (2.0 * dt);
+    return g;
+}
+
+// Une mise à jour par noeud de l'arbre
+double BinomialModel::costHint(const OptionSpec&) const {
+    return 0.5 * static_cast<double>(steps_) * (steps_ + 1);
 }
@@ -0,0 +1,104 @@
+#include "models/BjerksundStenslandModel.hpp"
+#include "util/MathHelpers.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// phi(S, T, gamma, H, I) de Bjerksund-Stensland (1993)
+double phi(double S, double T, double gamma, double H, double I, double r, double b, double sigma) {
+    const double sigma2 = sigma * sigma;
+    const double volSqrtT = sigma * std::sqrt(T);
+    const double lambda = (-r + gamma * b + 0.5 * gamma * (gamma - 1.0) * sigma2) * T;
+    const double d = -(std::log(S / H) + (b + (gamma - 0.5) * sigma2) * T) / volSqrtT;
+    const double kappa = 2.0 * b / sigma2 + 2.0 * gamma - 1.0;
+    return std::exp(lambda) * std::pow(S, gamma) *
+           (normcdf(d) - std::pow(I / S, kappa) * normcdf(d - 2.0 * std::log(I / S) / volSqrtT));
+}
+
+// psi(S, T, gamma, H, I2, I1, t1) de Bjerksund-Stensland (2002), avec la loi
+// normale bivariée de corrélation sqrt(t1 / T)
+double psi(double S, double T, double gamma, double H, double I2, double I1, double t1,
+           double r, double b, double sigma) {
+    const double sigma2 = sigma * sigma;
+    const double drift = b + (gamma - 0.5) * sigma2;
+    const double volSqrtT1 = sigma * std::sqrt(t1);
+    const double volSqrtT = sigma * std::sqrt(T);
+
+    const double e1 = (std::log(S / I1) + drift * t1) / volSqrtT1;
+    const double e2 = (std::log(I2 * I2 / (S * I1)) + drift * t1) / volSqrtT1;
+    const double e3 = (std::log(S / I1) - drift * t1) / volSqrtT1;
+    const double e4 = (std::log(I2 * I2 / (S * I1)) - drift * t1) / volSqrtT1;
+
+    const double f1 = (std::log(S / H) + drift * T) / volSqrtT;
+    const double f2 = (std::log(I2 * I2 / (S * H)) + drift * T) / volSqrtT;
+    const double f3 = (std::log(I1 * I1 / (S * H)) + drift * T) / volSqrtT;
+    const double f4 = (std::log(S * I1 * I1 / (H * I2 * I2)) + drift * T) / volSqrtT;
+
+    const double rho = std::sqrt(t1 / T);
+    const double lambda = -r + gamma * b + 0.5 * gamma * (gamma - 1.0) * sigma2;
+    const double kappa = 2.0 * b / sigma2 + 2.0 * gamma - 1.0;
+
+    return std::exp(lambda * T) * std::pow(S, gamma) *
+           (bivariateNormcdf(-e1, -f1, rho)
+            - std::pow(I2 / S, kappa) * bivariateNormcdf(-e2, -f2, rho)
+            - std::pow(I1 / S, kappa) * bivariateNormcdf(-e3, -f3, -rho)
+            + std::pow(I1 / I2, kappa) * bivariateNormcdf(-e4, -f4, -rho));
+}
+
+} // namespace
+
+BjerksundStenslandModel::BjerksundStenslandModel(const TrustedRegion& region)
+    : AmericanApproximationModel(region) {}
+
+double BjerksundStenslandModel::approximatePrice(const OptionSpec& option) const {
+    // Put : transformation put-call, le call est évalué en (K, S, r - b, -b)
+    double S = option.spot;
+    double K = option.strike;
+    double r = option.rate;
+    double b = option.rate; // Pas de dividende
+    if (!option.isCall()) {
+        std::swap(S, K);
+        r = r - b;
+        b = -b;
+    }
+    const double T = option.maturity;
+    const double sigma = option.volatility;
+    const double sigma2 = sigma * sigma;
+
+    // b >= r : le call n'est jamais exercé avant l'échéance
+    if (b >= r) {
+        return europeanPrice(true, S, K, T, r, b, sigma);
+    }
+
+    const double t1 = 0.5 * (std::sqrt(5.0) - 1.0) * T;
+    const double beta = (0.5 - b / sigma2) + std::sqrt((b / sigma2 - 0.5) * (b / sigma2 - 0.5) + 2.0 * r / sigma2);
+    const double bInfinity = beta / (beta - 1.0) * K;
+    const double b0 = std::max(K, r / (r - b) * K);
+
+    // Frontières d'exercice plates sur [0, t1] (I2) et [t1, T] (I1)
+    const double h1 = -(b * t1 + 2.0 * sigma * std::sqrt(t1)) * K * K / ((bInfinity - b0) * b0);
+    const double h2 = -(b * T + 2.0 * sigma * std::sqrt(T)) * K * K / ((bInfinity - b0) * b0);
+    const double I1 = b0 + (bInfinity - b0) * (1.0 - std::exp(h1));
+    const double I2 = b0 + (bInfinity - b0) * (1.0 - std::exp(h2));
+
+    if (S >= I2) {
+        return S - K;
+    }
+
+    const double alpha1 = (I1 - K) * std::pow(I1, -beta);
+    const double alpha2 = (I2 - K) * std::pow(I2, -beta);
+
+    return alpha2 * std::pow(S, beta)
+         - alpha2 * phi(S, t1, beta, I2, I2, r, b, sigma)
+         + phi(S, t1, 1.0, I2, I2, r, b, sigma)
+         - phi(S, t1, 1.0, I1, I2, r, b, sigma)
+         - K * phi(S, t1, 0.0, I2, I2, r, b, sigma)
+         + K * phi(S, t1, 0.0, I1, I2, r, b, sigma)
+         + alpha1 * phi(S, t1, beta, I1, I2, r, b, sigma)
+         - alpha1 * psi(S, T, beta, I1, I2, I1, t1, r, b, sigma)
+         + psi(S, T, 1.0, I1, I2, I1, t1, r, b, sigma)
+         - psi(S, T, 1.0, K, I2, I1, t1, r, b, sigma)
+         - K * psi(S, T, 0.0, I1, I2, I1, t1, r, b, sigma)
+         + K * psi(S, T, 0.0, K, I2, I1, t1, r, b, sigma);
+}
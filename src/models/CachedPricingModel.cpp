@@ -0,0 +1,67 @@
+#include "models/CachedPricingModel.hpp"
+#include "util/GreeksCalculator.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+// Coût (costHint) au-delà duquel une lecture du cache est rentable
+constexpr double MIN_CACHED_COST = 1000.0;
+const OptionSpec REFERENCE_OPTION{100.0, 100.0, 0.05, 0.2, 1.0, OptionType::Put};
+
+} // namespace
+
+CachedPricingModel::CachedPricingModel(std::shared_ptr<const OptionPricingModel> model,
+                                       std::shared_ptr<PricingCache> cache, const std::string& description)
+    : model_(std::move(model)), cache_(std::move(cache)), description_(description) {
+    if (!model_ || !cache_) {
+        throw std::invalid_argument("CachedPricingModel: model and cache required");
+    }
+    modelId_ = cache_->modelId(description_);
+}
+
+double CachedPricingModel::calculatePrice(const OptionSpec& option) const {
+    CacheKey key;
+    if (!cache_->makeKey(modelId_, option, key)) {
+        return model_->calculatePrice(option);
+    }
+    double price;
+    if (!cache_->findPrice(key, price)) {
+        price = model_->calculatePrice(key.option);
+        cache_->storePrice(key, price);
+    }
+    return price;
+}
+
+Greeks CachedPricingModel::greeks(const OptionSpec& option) const {
+    CacheKey key;
+    if (!cache_->makeKey(modelId_, option, key)) {
+        return GreeksCalculator::greeks(*model_, option);
+    }
+    Greeks g;
+    if (!cache_->findGreeks(key, g)) {
+        g = GreeksCalculator::greeks(*model_, key.option);
+        cache_->storeGreeks(key, g);
+    }
+    return g;
+}
+
+double CachedPricingModel::costHint(const OptionSpec& option) const {
+    return model_->costHint(option);
+}
+
+bool CachedPricingModel::isInternallyParallel() const {
+    return model_->isInternallyParallel();
+}
+
+bool CachedPricingModel::isWorthCaching(const OptionPricingModel& model) {
+    return model.costHint(REFERENCE_OPTION) > MIN_CACHED_COST;
+}
+
+const OptionPricingModel& CachedPricingModel::getModel() const {
+    return *model_;
+}
+
+const std::string& CachedPricingModel::getDescription() const {
+    return description_;
+}
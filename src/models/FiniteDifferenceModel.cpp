@@ -1,17 +1,270 @@
 #include "models/FiniteDifferenceModel.hpp"
-#include <Eigen/Dense>
-#include <Eigen/Sparse>
+#include "util/TridiagonalSolver.hpp"
+#include "util/CubicSpline.hpp"
+#include "util/SpotGrid.hpp"
 #include <cmath>
 #include <algorithm>
 #include <vector>
 #include <stdexcept>
+#include <string>
+#include <utility>
+
+// Surface de volatilité locale échantillonnée sur une grille PDE, mise sous la
+// forme des matrices de Crank-Nicolson de chaque tranche n (temps restant n dt) :
+// L^n = a^n (S^2 D2) + r (S D1 - I), avec a^n = 1/2 sigma^2(S_i, T - n dt)
+struct LocalVolatilityTable {
+    std::vector<double> nodes;              // S_i, i = 0..M
+    std::vector<double> explicitLower;      // I + dt/2 L^n, tranches n = 0..N contiguës,
+    std::vector<double> explicitDiagonal;   // (M - 1) noeuds intérieurs chacune
+    std::vector<double> explicitUpper;
+    std::vector<TridiagonalSolver> implicitSystems;  // Factorisation de I - dt/2 L^n
+    int timeSteps;
+};
+
+namespace {
+
+// Espace de travail du schéma de Crank-Nicolson, un par thread : les tableaux
+// sont conservés d'un appel à l'autre et ne sont réalloués que si la grille grandit
+struct CrankNicolsonWorkspace {
+    std::vector<double> grid;           // S_i, i = 0..M
+    std::vector<double> values;         // V(S_i) sur la grille, i = 0..M
+    std::vector<double> previous;       // Tranche précédant la dernière
+    std::vector<double> coarse;         // Tranche finale à N/2 pas (Richardson)
+    std::vector<double> explicitLower;  // Opérateur explicite (I + dt/2 L) sur les noeuds intérieurs
+    std::vector<double> explicitDiagonal;
+    std::vector<double> explicitUpper;
+    std::vector<double> implicitLower;  // Opérateur implicite (I - dt/2 L)
+    std::vector<double> implicitDiagonal;
+    std::vector<double> implicitUpper;
+    TridiagonalSolver implicitSystem;   // Factorisation de (I - dt/2 L)
+    CubicSpline spline;                 // Interpolation de la tranche finale
+
+    void resize(int interior) {
+        grid.resize(interior + 2);
+        values.resize(interior + 2);
+        previous.resize(interior + 2);
+        explicitLower.resize(interior);
+        explicitDiagonal.resize(interior);
+        explicitUpper.resize(interior);
+        implicitLower.resize(interior);
+        implicitDiagonal.resize(interior);
+        implicitUpper.resize(interior);
+    }
+};
+
+// Payoff moyen sur la cellule [a, b] : le coude du payoff n'a pas besoin d'être
+// sur un noeud pour garder une convergence régulière d'ordre 2
+double averagePayoff(double a, double b, double K, bool isCall) {
+    double integral;
+    if (isCall) {
+        integral = b <= K ? 0.0 : (a >= K ? (0.5 * (a + b) - K) * (b - a) : 0.5 * (b - K) * (b - K));
+    } else {
+        integral = a >= K ? 0.0 : (b <= K ? (K - 0.5 * (a + b)) * (b - a) : 0.5 * (K - a) * (K - a));
+    }
+    return integral / (b - a);
+}
+
+// L (lower, diagonal, upper) -> I + dt/2 L en place, et I - dt/2 L dans les tableaux implicit*
+void crankNicolsonOperators(double* lower, double* diagonal, double* upper, int interior, double dt,
+                            double* implicitLower, double* implicitDiagonal, double* implicitUpper) {
+    for (int k = 0; k < interior; ++k) {
+        const double alpha = 0.5 * dt * lower[k];
+        const double beta = 0.5 * dt * diagonal[k];
+        const double gamma = 0.5 * dt * upper[k];
+
+        implicitLower[k] = -alpha;
+        implicitDiagonal[k] = 1 - beta;
+        implicitUpper[k] = -gamma;
+
+        lower[k] = alpha;
+        diagonal[k] = 1 + beta;
+        upper[k] = gamma;
+    }
+}
+
+// Largeur de la zone resserrée de la grille sinh, relative au strike : de
+// l'ordre de deux écarts-types du log-spot à maturité
+double gridConcentration(double sigma, double T) {
+    return std::max(2.0 * sigma * std::sqrt(T), 0.01);
+}
+
+// Schéma de Crank-Nicolson sur [0, S_max], timeSteps pas dont les rannacherSteps
+// premiers sont faits en deux demi-pas d'Euler implicite : laisse dans le
+// workspace la grille, la tranche finale et la précédente ; renvoie le pas de temps.
+// Avec une table de volatilité locale, sa grille est utilisée et chaque pas lit
+// les matrices précalculées de ses deux tranches
+double solveCrankNicolson(const OptionSpec& option, int assetSteps, int timeSteps, int rannacherSteps,
+                          GridType gridType, CrankNicolsonWorkspace& workspace,
+                          const LocalVolatilityTable* localVolatility = nullptr) {
+    const double T = option.maturity;
+    const double S_0 = option.spot;
+    const double K = option.strike;
+    const double sigma = option.volatility;
+    const double r = option.rate;
+    const bool isCall = option.isCall();
+
+    const int M = assetSteps;
+    if (M < 2) {
+        throw std::invalid_argument("assetSteps must be at least 2");
+    }
+
+    // Crank-Nicolson est inconditionnellement stable : le nombre de pas demandé
+    // est utilisé tel quel, sans contrainte de type CFL
+    const int N = timeSteps;
+    const double dt = T / N;
+
+    // Noeuds intérieurs 1..M-1 ; les valeurs aux bords sont imposées
+    const int interior = M - 1;
+    workspace.resize(interior);
+    double S_max;
+    if (localVolatility) {
+        workspace.grid.assign(localVolatility->nodes.begin(), localVolatility->nodes.end());
+        S_max = workspace.grid[M];
+    } else {
+        // Ajuster S_max pour qu'il soit supérieur à S_0. La grille sinh, peu coûteuse
+        // loin du strike, va jusqu'à 4 écarts-types pour rendre l'erreur de bord négligeable
+        S_max = std::max(S_0 * 1.5, K * 2.0); // S_max >= S_0
+        if (gridType == GridType::Sinh) {
+            S_max = std::max(S_max, std::max(S_0, K) * std::exp(4.0 * sigma * std::sqrt(T)));
+        }
+        buildSpotGrid(gridType, S_max, M, K, S_0, workspace.grid, gridConcentration(sigma, T));
+    }
+    const double* S = workspace.grid.data();
+    double* F = workspace.values.data();
+
+    // Matrices de Crank-Nicolson : une paire pour tous les pas à volatilité
+    // constante, une par tranche (précalculée dans la table) en volatilité locale
+    const double* explicitLower = workspace.explicitLower.data();
+    const double* explicitDiagonal = workspace.explicitDiagonal.data();
+    const double* explicitUpper = workspace.explicitUpper.data();
+    const TridiagonalSolver* implicitSystem = &workspace.implicitSystem;
+
+    if (!localVolatility) {
+        // Opérateur L (différences non uniformes), puis I -/+ dt/2 L
+        blackScholesOperator(workspace.grid, sigma, r, workspace.explicitLower.data(),
+                             workspace.explicitDiagonal.data(), workspace.explicitUpper.data());
+        crankNicolsonOperators(workspace.explicitLower.data(), workspace.explicitDiagonal.data(),
+                               workspace.explicitUpper.data(), interior, dt, workspace.implicitLower.data(),
+                               workspace.implicitDiagonal.data(), workspace.implicitUpper.data());
+
+        // Pré-factorisation du système implicite, une fois pour tous les pas de temps.
+        // (I - dt/2 L) sert aussi aux demi-pas d'Euler implicite de Rannacher
+        workspace.implicitSystem.factorize(workspace.implicitLower.data(), workspace.implicitDiagonal.data(),
+                                           workspace.implicitUpper.data(), interior);
+    }
+
+    // Conditions initiales
+    F[0] = isCall ? 0.0 : K;
+    F[M] = isCall ? std::max(S[M] - K, 0.0) : 0.0;
+    for (int i = 1; i < M; ++i) {
+        // Cellule centrée sur le noeud : exacte là où le payoff est linéaire
+        const double halfWidth = 0.25 * (S[i + 1] - S[i - 1]);
+        F[i] = averagePayoff(S[i] - halfWidth, S[i] + halfWidth, K, isCall);
+    }
+
+    // Conditions aux frontières au temps restant tau
+    auto updateBoundaries = [&](double tau) {
+        F[0] = isCall ? 0.0 : K * std::exp(-r * tau);
+        F[M] = isCall ? S_max - K * std::exp(-r * tau) : 0.0;
+    };
+
+    // Résolution du système linéaire, en place sur les noeuds intérieurs
+    for (int t = N - 1; t >= 0; --t) {
+        const double tau = (N - t) * dt;
+        const bool rannacher = N - 1 - t < rannacherSteps;
+        if (t == 0) {
+            std::copy(F, F + M + 1, workspace.previous.begin());
+        }
+
+        // Explicite au temps restant tau - dt, implicite à tau. Les coefficients
+        // de bord de I - dt/2 L sont les opposés de ceux de I + dt/2 L
+        double alphaImplicit = explicitLower[0];
+        double gammaImplicit = explicitUpper[interior - 1];
+        if (localVolatility) {
+            const std::size_t slice = static_cast<std::size_t>(N - t) * interior;
+            explicitLower = localVolatility->explicitLower.data() + slice - interior;
+            explicitDiagonal = localVolatility->explicitDiagonal.data() + slice - interior;
+            explicitUpper = localVolatility->explicitUpper.data() + slice - interior;
+            implicitSystem = &localVolatility->implicitSystems[N - t];
+            alphaImplicit = localVolatility->explicitLower[slice];
+            gammaImplicit = localVolatility->explicitUpper[slice + interior - 1];
+        }
+
+        if (rannacher) {
+            // Deux demi-pas implicites : (I - dt/2 L) V(tau) = V(tau - dt/2)
+            for (int half = 1; half >= 0; --half) {
+                updateBoundaries(tau - 0.5 * half * dt);
+                F[1] += alphaImplicit * F[0];
+                F[interior] += gammaImplicit * F[M];
+                implicitSystem->solve(F + 1);
+            }
+            continue;
+        }
+
+        // Second membre explicite, avec les anciennes valeurs aux bords
+        const double oldLow = F[0];
+        const double oldHigh = F[M];
+        multiplyTridiagonal(explicitLower, explicitDiagonal, explicitUpper, F + 1, interior);
+
+        // Mise à jour des conditions aux frontières
+        updateBoundaries(tau);
+
+        // Contributions des bords (explicite puis implicite) aux noeuds voisins
+        F[1] += explicitLower[0] * oldLow + alphaImplicit * F[0];
+        F[interior] += explicitUpper[interior - 1] * oldHigh + gammaImplicit * F[M];
+
+        implicitSystem->solve(F + 1);
+    }
+
+    return dt;
+}
+
+// Résolution selon la politique de pas de temps. Avec Richardson, une première
+// résolution à N/2 pas est combinée à celle à N pas (N arrondi au pair) :
+// V = (4 V(N) - V(N/2)) / 3 élimine le terme d'erreur en dt^2
+double solveWithPolicy(const OptionSpec& option, int assetSteps, int timeSteps, GridType gridType,
+                       const TimeSteppingPolicy& policy, CrankNicolsonWorkspace& workspace,
+                       const LocalVolatilityTable* fineTable, const LocalVolatilityTable* coarseTable) {
+    if (!policy.richardson) {
+        return solveCrankNicolson(option, assetSteps, timeSteps, policy.rannacherSteps, gridType, workspace,
+                                  fineTable);
+    }
+
+    const int coarseSteps = (timeSteps + 1) / 2;
+    solveCrankNicolson(option, assetSteps, coarseSteps, policy.rannacherSteps, gridType, workspace, coarseTable);
+    workspace.coarse.assign(workspace.values.begin(), workspace.values.end());
+
+    const double dt = solveCrankNicolson(option, assetSteps, 2 * coarseSteps, policy.rannacherSteps,
+                                         gridType, workspace, fineTable);
+    // La tranche précédente reçoit la même correction : le theta reste celui du pas fin
+    for (std::size_t i = 0; i < workspace.values.size(); ++i) {
+        const double correction = (workspace.values[i] - workspace.coarse[i]) / 3.0;
+        workspace.values[i] += correction;
+        workspace.previous[i] += correction;
+    }
+    return dt;
+}
+
+// Workspace du thread courant, partagé par calculatePrice et solve
+CrankNicolsonWorkspace& threadWorkspace() {
+    thread_local CrankNicolsonWorkspace workspace;
+    return workspace;
+}
+
+} // namespace
 
 // Constructeur
-FiniteDifferenceModel::FiniteDifferenceModel(int timeSteps, int assetSteps)
-    : timeSteps_(timeSteps), assetSteps_(assetSteps) {
+FiniteDifferenceModel::FiniteDifferenceModel(int timeSteps, int assetSteps, GridType gridType,
+                                             TimeSteppingPolicy timeStepping,
+                                             std::shared_ptr<const LocalVolatilitySurface> localVolatility)
+    : timeSteps_(timeSteps), assetSteps_(assetSteps), gridType_(gridType), timeStepping_(timeStepping),
+      localVolatility_(std::move(localVolatility)) {
     if (timeSteps <= 0 || assetSteps <= 0) {
         throw std::invalid_argument("timeSteps and assetSteps must be positive");
     }
+    if (timeStepping.rannacherSteps < 0) {
+        throw std::invalid_argument("rannacherSteps must be non-negative");
+    }
 }
 
 // Getter pour assetSteps_
@@ -24,100 +277,129 @@ int FiniteDifferenceModel::getTimeSteps() const {
     return timeSteps_;
 }
 
-// Implémentation de calculatePrice pour les options européennes
-double FiniteDifferenceModel::calculatePrice(const Option& option) const {
-    const double T = option.getTimeToMaturity();
-    const double S_0 = option.getSpotPrice();
-    const double K = option.getStrikePrice();
-    const double sigma = option.getVolatility();
-    const double r = option.getRiskFreeRate();
-    const bool isCall = option.getType() == "call";
-
-    // Ajuster S_max pour qu'il soit supérieur à S_0
-    const double S_max = std::max(S_0 * 1.5, K * 2.0); // S_max >= S_0
-    const int M = assetSteps_;
-    const double ds = S_max / M;
-
-    // Calculer le nombre de pas de temps en fonction de la volatilité maximale
-    const double sigma2_max = std::pow(sigma * S_max, 2) / std::pow(ds, 2);
-    const int N = static_cast<int>(sigma2_max * T) + 1;
-    const double dt = T / N;
-
-    using Eigen::SparseMatrix;
-    using Eigen::SparseLU;
-    using Eigen::Triplet;
-    using Eigen::VectorXd;
-
-    // Matrices C et D pour le schéma de Crank-Nicolson
-    SparseMatrix<double> C(M + 1, M + 1);
-    SparseMatrix<double> D(M + 1, M + 1);
-    std::vector<Triplet<double>> tripletsC, tripletsD;
-    tripletsC.reserve(3 * M);
-    tripletsD.reserve(3 * M);
-
-    // Conditions aux limites
-    tripletsC.emplace_back(0, 0, 1.0);
-    tripletsD.emplace_back(0, 0, 1.0);
-    tripletsC.emplace_back(M, M, 1.0);
-    tripletsD.emplace_back(M, M, 1.0);
-
-    // Remplissage des matrices C et D
-    for (int i = 1; i < M; ++i) {
-        const double S = i * ds;
-        const double sigma2 = std::pow(sigma * S, 2) / std::pow(ds, 2);
-        const double mu = r * S / ds;
+GridType FiniteDifferenceModel::getGridType() const {
+    return gridType_;
+}
 
-        const double alpha = 0.25 * dt * (sigma2 - mu);
-        const double beta = -0.5 * dt * (sigma2 + r);
-        const double gamma = 0.25 * dt * (sigma2 + mu);
+const TimeSteppingPolicy& FiniteDifferenceModel::getTimeStepping() const {
+    return timeStepping_;
+}
 
-        tripletsC.emplace_back(i, i - 1, -alpha);
-        tripletsC.emplace_back(i, i, 1 - beta);
-        tripletsC.emplace_back(i, i + 1, -gamma);
+const std::shared_ptr<const LocalVolatilitySurface>& FiniteDifferenceModel::getLocalVolatility() const {
+    return localVolatility_;
+}
 
-        tripletsD.emplace_back(i, i - 1, alpha);
-        tripletsD.emplace_back(i, i, 1 + beta);
-        tripletsD.emplace_back(i, i + 1, gamma);
+void FiniteDifferenceModel::localVolatilityTables(const OptionSpec& option,
+                                                  std::shared_ptr<const LocalVolatilityTable>& fine,
+                                                  std::shared_ptr<const LocalVolatilityTable>& coarse) const {
+    fine.reset();
+    coarse.reset();
+    if (!localVolatility_) {
+        return;
     }
+    if (timeStepping_.richardson) {
+        const int coarseSteps = (timeSteps_ + 1) / 2;
+        coarse = localVolatilityTable(option, coarseSteps);
+        fine = localVolatilityTable(option, 2 * coarseSteps);
+    } else {
+        fine = localVolatilityTable(option, timeSteps_);
+    }
+}
 
-    C.setFromTriplets(tripletsC.begin(), tripletsC.end());
-    D.setFromTriplets(tripletsD.begin(), tripletsD.end());
+std::shared_ptr<const LocalVolatilityTable> FiniteDifferenceModel::localVolatilityTable(const OptionSpec& option,
+                                                                                        int timeSteps) const {
+    const LocalVolatilitySurface& surface = *localVolatility_;
+    const double T = option.maturity;
+    const double S_0 = option.spot;
 
-    // Conditions initiales
-    VectorXd F = VectorXd::Zero(M + 1);
-    for (int i = 0; i <= M; ++i) {
-        double S = i * ds;
-        F(i) = isCall ? std::max(S - K, 0.0) : std::max(K - S, 0.0);
-    }
+    // Domaine indépendant du strike tant qu'il reste sous S_max / 2 : quatre
+    // écarts-types à la plus forte volatilité de la surface
+    double S_max = S_0 * std::max(2.0, std::exp(4.0 * surface.maxVolatility() * std::sqrt(T)));
+    S_max = std::max(S_max, 2.0 * option.strike);
 
-    // Pré-factorisation du solveur
-    SparseLU<SparseMatrix<double>> solver;
-    solver.compute(C);
-    if (solver.info() != Eigen::Success) {
-        throw std::runtime_error("Échec de la décomposition LU");
+    const TableKey key(S_0, T, S_max, option.rate, timeSteps);
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto it = tables_.find(key);
+        if (it != tables_.end()) {
+            return it->second;
+        }
     }
 
-    // Résolution du système linéaire
-    for (int t = N - 1; t >= 0; --t) {
-        const double tau = (N - t) * dt;
+    auto table = std::make_shared<LocalVolatilityTable>();
+    table->timeSteps = timeSteps;
+    buildSpotGrid(gridType_, S_max, assetSteps_, S_0, S_0, table->nodes,
+                  gridConcentration(surface.volatility(S_0, 0.0), T));
 
-        // Mise à jour des conditions aux frontières
-        F(0) = isCall ? 0.0 : K * std::exp(-r * tau);
-        F(M) = isCall ? S_max - K * std::exp(-r * tau) : 0.0;
+    // Poids de S^2 V'' (sigma^2 / 2 = 1, r = 0) et de S V' - V (sigma = 0, r = 1)
+    const int interior = assetSteps_ - 1;
+    std::vector<double> secondLower(interior), secondDiagonal(interior), secondUpper(interior);
+    std::vector<double> driftLower(interior), driftDiagonal(interior), driftUpper(interior);
+    blackScholesOperator(table->nodes, std::sqrt(2.0), 0.0, secondLower.data(), secondDiagonal.data(),
+                         secondUpper.data());
+    blackScholesOperator(table->nodes, 0.0, 1.0, driftLower.data(), driftDiagonal.data(), driftUpper.data());
 
-        VectorXd b = D * F;
-        F = solver.solve(b);
+    // Tranche n au temps restant n dt, soit à la date T - n dt : coefficients de
+    // diffusion échantillonnés sur la grille, puis matrices de Crank-Nicolson
+    const double r = option.rate;
+    const double dt = T / timeSteps;
+    const std::size_t cells = static_cast<std::size_t>(timeSteps + 1) * interior;
+    table->explicitLower.resize(cells);
+    table->explicitDiagonal.resize(cells);
+    table->explicitUpper.resize(cells);
+    table->implicitSystems.resize(timeSteps + 1);
+    std::vector<double> sigma(interior), implicitLower(interior), implicitDiagonal(interior), implicitUpper(interior);
+    for (int n = 0; n <= timeSteps; ++n) {
+        const std::size_t offset = static_cast<std::size_t>(n) * interior;
+        double* lower = table->explicitLower.data() + offset;
+        double* diagonal = table->explicitDiagonal.data() + offset;
+        double* upper = table->explicitUpper.data() + offset;
 
-        if (solver.info() != Eigen::Success) {
-            throw std::runtime_error("Échec de la résolution du système");
+        surface.sample(std::max(T - n * dt, 0.0), table->nodes.data() + 1, interior, sigma.data());
+        for (int k = 0; k < interior; ++k) {
+            const double halfVariance = 0.5 * sigma[k] * sigma[k];
+            lower[k] = halfVariance * secondLower[k] + r * driftLower[k];
+            diagonal[k] = halfVariance * secondDiagonal[k] + r * driftDiagonal[k];
+            upper[k] = halfVariance * secondUpper[k] + r * driftUpper[k];
         }
+        crankNicolsonOperators(lower, diagonal, upper, interior, dt, implicitLower.data(),
+                               implicitDiagonal.data(), implicitUpper.data());
+        table->implicitSystems[n].factorize(implicitLower.data(), implicitDiagonal.data(),
+                                            implicitUpper.data(), interior);
     }
 
-    // Interpolation pour obtenir le prix final
-    const int index = static_cast<int>(S_0 / ds);
-    if (index < 0 || index >= M) {
-        throw std::out_of_range("Index invalide lors de l'interpolation : S_0 = " + std::to_string(S_0) + ", ds = " + std::to_string(ds) + ", index = " + std::to_string(index));
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    if (tables_.size() >= MAX_CACHED_TABLES) {
+        tables_.clear();
     }
-    const double theta = (S_0 - index * ds) / ds;
-    return std::max((1 - theta) * F(index) + theta * F(index + 1), 0.0);
-}
\ No newline at end of file
+    tables_.emplace(key, table);
+    return table;
+}
+
+// Implémentation de calculatePrice pour les options européennes
+double FiniteDifferenceModel::calculatePrice(const OptionSpec& option) const {
+    std::shared_ptr<const LocalVolatilityTable> fine, coarse;
+    localVolatilityTables(option, fine, coarse);
+    CrankNicolsonWorkspace& workspace = threadWorkspace();
+    solveWithPolicy(option, assetSteps_, timeSteps_, gridType_, timeStepping_, workspace, fine.get(), coarse.get());
+
+    // Interpolation cubique de la tranche finale au spot
+    const int nodes = assetSteps_ + 1;
+    workspace.spline.fit(workspace.grid.data(), workspace.values.data(), nodes);
+    return std::max(workspace.spline.value(option.spot), 0.0);
+}
+
+FiniteDifferenceSolution FiniteDifferenceModel::solve(const OptionSpec& option) const {
+    std::shared_ptr<const LocalVolatilityTable> fine, coarse;
+    localVolatilityTables(option, fine, coarse);
+    CrankNicolsonWorkspace& workspace = threadWorkspace();
+    const double dt = solveWithPolicy(option, assetSteps_, timeSteps_, gridType_, timeStepping_, workspace,
+                                      fine.get(), coarse.get());
+    return FiniteDifferenceSolution(option, workspace.grid, workspace.values, workspace.previous, dt);
+}
+
+// Produit explicite et résolution tridiagonale : quelques opérations par noeud et par pas
+double FiniteDifferenceModel::costHint(const OptionSpec&) const {
+    const double steps = timeSteps_ + timeStepping_.rannacherSteps;
+    return 4.0 * assetSteps_ * steps * (timeStepping_.richardson ? 1.5 : 1.0);
+}
@@ -0,0 +1,88 @@
+#include "models/FiniteDifferenceSolution.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+FiniteDifferenceSolution::FiniteDifferenceSolution(const OptionSpec& option, std::vector<double> grid,
+                                                   std::vector<double> values, std::vector<double> previousValues,
+                                                   double timeStep)
+    : option_(option), grid_(std::move(grid)), values_(std::move(values)),
+      previousValues_(std::move(previousValues)), timeStep_(timeStep) {
+    if (values_.size() != grid_.size() || previousValues_.size() != grid_.size()) {
+        throw std::invalid_argument("FiniteDifferenceSolution: slices must match the grid");
+    }
+    if (timeStep_ <= 0) {
+        throw std::invalid_argument("FiniteDifferenceSolution: timeStep must be positive");
+    }
+
+    const int n = static_cast<int>(grid_.size());
+    valueSpline_.fit(grid_.data(), values_.data(), n);
+
+    std::vector<double> thetas(n);
+    for (int i = 0; i < n; ++i) {
+        thetas[i] = (values_[i] - previousValues_[i]) / timeStep_;
+    }
+    thetaSpline_.fit(grid_.data(), thetas.data(), n);
+}
+
+void FiniteDifferenceSolution::checkSpot(double spot) const {
+    if (spot < grid_.front() || spot > grid_.back()) {
+        throw std::out_of_range("Spot hors de la grille : S = " + std::to_string(spot) +
+                                ", grille = [" + std::to_string(grid_.front()) + ", " +
+                                std::to_string(grid_.back()) + "]");
+    }
+}
+
+double FiniteDifferenceSolution::price(double spot) const {
+    checkSpot(spot);
+    return std::max(valueSpline_.value(spot), 0.0);
+}
+
+double FiniteDifferenceSolution::delta(double spot) const {
+    checkSpot(spot);
+    return valueSpline_.derivative(spot);
+}
+
+double FiniteDifferenceSolution::gamma(double spot) const {
+    checkSpot(spot);
+    return valueSpline_.secondDerivative(spot);
+}
+
+double FiniteDifferenceSolution::theta(double spot) const {
+    checkSpot(spot);
+    return thetaSpline_.value(spot);
+}
+
+Greeks FiniteDifferenceSolution::greeks(double spot) const {
+    checkSpot(spot);
+    Greeks g;
+    valueSpline_.evaluate(spot, g.price, g.delta, g.gamma);
+    g.price = std::max(g.price, 0.0);
+    g.theta = thetaSpline_.value(spot);
+    return g;
+}
+
+Greeks FiniteDifferenceSolution::greeks() const {
+    return greeks(option_.spot);
+}
+
+const OptionSpec& FiniteDifferenceSolution::option() const {
+    return option_;
+}
+
+const std::vector<double>& FiniteDifferenceSolution::grid() const {
+    return grid_;
+}
+
+const std::vector<double>& FiniteDifferenceSolution::values() const {
+    return values_;
+}
+
+const std::vector<double>& FiniteDifferenceSolution::previousValues() const {
+    return previousValues_;
+}
+
+double FiniteDifferenceSolution::timeStep() const {
+    return timeStep_;
+}
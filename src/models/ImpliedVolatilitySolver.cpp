@@ -0,0 +1,333 @@
+#include "models/ImpliedVolatilitySolver.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+// Lots européens (formule fermée) et américains (un pricer PDE par option)
+static const long PARALLEL_BATCH_THRESHOLD = 1024;
+static const long PARALLEL_AMERICAN_THRESHOLD = 8;
+
+namespace {
+
+const double NaN = std::numeric_limits<double>::quiet_NaN();
+const double INV_SQRT_2PI = 0.3989422804014327;
+const double TWO_PI = 6.283185307179586;
+
+// Loi normale par erfc : précise dans les queues, contrairement à normcdf()
+double cdf(double x) {
+    return 0.5 * std::erfc(-x * 0.7071067811865476);
+}
+
+/**
+ * Call normalisé hors de la monnaie, x = ln(F / K) <= 0, s = sigma sqrt(T) > 0 :
+ *   b = e^{x/2} N(x/s + s/2) - e^{-x/2} N(x/s - s/2)
+ * et son écart à la borne b_max = e^{x/2}, calculé sans soustraction.
+ */
+struct NormalizedCall {
+    double value;
+    double gap;         // b_max - b
+    double vega;        // db/ds
+    double ratio2;      // (d2b/ds2) / (db/ds)
+    double ratio3;      // (d3b/ds3) / (db/ds)
+};
+
+NormalizedCall normalizedCall(double x, double s) {
+    const double d1 = x / s + 0.5 * s;
+    const double d2 = x / s - 0.5 * s;
+    const double up = std::exp(0.5 * x);
+    const double down = std::exp(-0.5 * x);
+    const double xs = x / s;
+
+    NormalizedCall b;
+    b.value = up * cdf(d1) - down * cdf(d2);
+    b.gap = up * cdf(-d1) + down * cdf(d2);
+    b.vega = INV_SQRT_2PI * std::exp(-0.5 * xs * xs - 0.125 * s * s);
+    b.ratio2 = x * x / (s * s * s) - 0.25 * s;
+    b.ratio3 = b.ratio2 * b.ratio2 - 3.0 * xs * xs / (s * s) - 0.25;
+    return b;
+}
+
+// Pas de Householder d'ordre 3 pour f(s) = 0, avec f1, f2, f3 ses dérivées
+double householderStep(double f, double f1, double f2, double f3) {
+    const double newton = -f / f1;
+    const double h2 = f2 / f1;
+    const double h3 = f3 / f1;
+    return newton * (1.0 + 0.5 * h2 * newton) / (1.0 + newton * (h2 + h3 * newton / 6.0));
+}
+
+ImpliedVolResult failure(ImpliedVolStatus status, int iterations = 0) {
+    return ImpliedVolResult{NaN, status, iterations};
+}
+
+ImpliedVolResult solveEuropean(double S, double K, double r, double T, bool isCall, double price,
+                               const ImpliedVolSettings& settings) {
+    if (!(S > 0) || !(K > 0) || !(T > 0) || !std::isfinite(price) || !std::isfinite(r)) {
+        return failure(ImpliedVolStatus::InvalidInput);
+    }
+
+    // Prix forward (non actualisé) et retour au call hors de la monnaie :
+    // la valeur temps d'une option dans la monnaie est le prix de l'autre (parité)
+    const double discount = std::exp(-r * T);
+    const double F = S / discount;
+    const double undiscounted = price / discount;
+    const double intrinsic = isCall ? std::max(F - K, 0.0) : std::max(K - F, 0.0);
+    if (undiscounted >= (isCall ? F : K)) {
+        return failure(ImpliedVolStatus::AboveMaximum);
+    }
+    const double timeValue = undiscounted - intrinsic;
+    if (!(timeValue > 0)) {
+        return failure(ImpliedVolStatus::BelowIntrinsic);
+    }
+
+    const double x = -std::fabs(std::log(F / K));
+    const double beta = timeValue / std::sqrt(F * K);
+    const double maxValue = std::exp(0.5 * x);
+    if (beta >= maxValue) {
+        return failure(ImpliedVolStatus::AboveMaximum);
+    }
+
+    // Point d'inflexion s_c de b(s) et intersections de sa tangente avec
+    // b = 0 (s_l) et b = b_max (s_u) : elles délimitent trois régions
+    const double sc = std::sqrt(-2.0 * x);
+    const NormalizedCall atInflection = normalizedCall(x, std::max(sc, 1e-300));
+    const double bc = sc > 0 ? atInflection.value : 0.0;
+    const double sl = sc - bc / atInflection.vega;
+    const double su = sc + (maxValue - bc) / atInflection.vega;
+    const double bl = sl > 0 ? normalizedCall(x, sl).value : 0.0;
+    const double bu = normalizedCall(x, su).value;
+
+    enum class Region { Lower, Middle, Upper };
+    const Region region = beta < bl ? Region::Lower : (beta <= bu ? Region::Middle : Region::Upper);
+
+    // Estimations initiales explicites, exactes au point de raccord et dans leur limite
+    double s;
+    if (region == Region::Lower) {
+        // ln b ~ -x^2 / (2 s^2) quand s -> 0, raccordé en (s_l, b_l)
+        s = -x / std::sqrt(2.0 * std::log(bl / beta) + x * x / (sl * sl));
+    } else if (region == Region::Middle) {
+        // Tangente au point d'inflexion
+        s = std::max(sc + (beta - bc) / atInflection.vega, 0.5 * std::max(sl, 0.0) + 0.5 * sc);
+    } else {
+        // Approximation de Pólya de erf, exacte à la monnaie au premier ordre
+        const double q = beta / maxValue;
+        s = std::max(std::sqrt(-TWO_PI * std::log1p(-q * q)), su);
+    }
+    double lo = 0.0;
+    double hi = std::numeric_limits<double>::infinity();
+    const double logBeta = std::log(beta);
+    const double logGap = std::log(maxValue - beta);
+
+    for (int iteration = 1; iteration <= settings.maxIterations; ++iteration) {
+        const NormalizedCall b = normalizedCall(x, s);
+
+        // Encadrement entretenu au fil des itérations : b est croissante en s
+        if (b.value < beta) {
+            lo = s;
+        } else {
+            hi = s;
+        }
+
+        double step;
+        if (region == Region::Lower) {
+            // f = ln b - ln beta
+            const double g1 = b.vega / b.value;
+            const double f2 = g1 * b.ratio2 - g1 * g1;
+            const double f3 = g1 * b.ratio3 - 3.0 * g1 * g1 * b.ratio2 + 2.0 * g1 * g1 * g1;
+            step = householderStep(std::log(b.value) - logBeta, g1, f2, f3);
+        } else if (region == Region::Middle) {
+            // f = b - beta
+            step = householderStep(b.value - beta, b.vega, b.vega * b.ratio2, b.vega * b.ratio3);
+        } else {
+            // f = -ln(b_max - b) + ln(b_max - beta)
+            const double g1 = b.vega / b.gap;
+            const double f2 = g1 * b.ratio2 + g1 * g1;
+            const double f3 = g1 * b.ratio3 + 3.0 * g1 * g1 * b.ratio2 + 2.0 * g1 * g1 * g1;
+            step = householderStep(logGap - std::log(b.gap), g1, f2, f3);
+        }
+
+        if (std::fabs(step) <= settings.tolerance * std::max(1.0, s)) {
+            return ImpliedVolResult{(s + step) / std::sqrt(T), ImpliedVolStatus::Converged, iteration};
+        }
+        s += step;
+        if (!(s > lo && s < hi)) {
+            // Pas hors de l'encadrement : bissection (doublement si pas de borne haute)
+            s = std::isinf(hi) ? 2.0 * lo : 0.5 * (lo + hi);
+        }
+    }
+    return ImpliedVolResult{s / std::sqrt(T), ImpliedVolStatus::MaxIterations, settings.maxIterations};
+}
+
+} // namespace
+
+const char* toString(ImpliedVolStatus status) {
+    switch (status) {
+        case ImpliedVolStatus::Converged: return "converged";
+        case ImpliedVolStatus::MaxIterations: return "max_iterations";
+        case ImpliedVolStatus::BelowIntrinsic: return "below_intrinsic";
+        case ImpliedVolStatus::AboveMaximum: return "above_maximum";
+        case ImpliedVolStatus::InvalidInput: return "invalid_input";
+        case ImpliedVolStatus::NoBracket: return "no_bracket";
+    }
+    return "unknown";
+}
+
+void ImpliedVolBatch::resize(std::size_t n) {
+    volatility.resize(n);
+    status.resize(n);
+    iterations.resize(n);
+}
+
+std::size_t ImpliedVolBatch::size() const {
+    return volatility.size();
+}
+
+std::size_t ImpliedVolBatch::convergedCount() const {
+    return static_cast<std::size_t>(std::count(status.begin(), status.end(), ImpliedVolStatus::Converged));
+}
+
+ImpliedVolResult ImpliedVolBatch::result(std::size_t i) const {
+    return ImpliedVolResult{volatility[i], status[i], iterations[i]};
+}
+
+ImpliedVolatilitySolver::ImpliedVolatilitySolver(const ImpliedVolSettings& settings) : settings_(settings) {
+    if (settings.tolerance <= 0 || settings.americanTolerance <= 0 || settings.maxIterations < 1 ||
+        settings.maxAmericanIterations < 2) {
+        throw std::invalid_argument("ImpliedVolatilitySolver: tolerances and iteration limits must be positive");
+    }
+    if (!(settings.minVolatility > 0) || !(settings.maxVolatility > settings.minVolatility)) {
+        throw std::invalid_argument("ImpliedVolatilitySolver: need 0 < minVolatility < maxVolatility");
+    }
+}
+
+const ImpliedVolSettings& ImpliedVolatilitySolver::getSettings() const {
+    return settings_;
+}
+
+ImpliedVolResult ImpliedVolatilitySolver::solve(const OptionSpec& option, double price) const {
+    return solveEuropean(option.spot, option.strike, option.rate, option.maturity, option.isCall(), price, settings_);
+}
+
+void ImpliedVolatilitySolver::solve(const OptionBatch& quotes, const std::vector<double>& prices,
+                                    ImpliedVolBatch& results) const {
+    if (prices.size() != quotes.size()) {
+        throw std::invalid_argument("ImpliedVolatilitySolver: one price per quote is required");
+    }
+    results.resize(quotes.size());
+    solveBatch(quotes.size(), quotes.spot.data(), quotes.strike.data(), quotes.rate.data(),
+               quotes.maturity.data(), quotes.isCall.data(), prices.data(),
+               results.volatility.data(), results.status.data(), results.iterations.data());
+}
+
+void ImpliedVolatilitySolver::solveBatch(std::size_t n, const double* spot, const double* strike, const double* rate,
+                                         const double* maturity, const unsigned char* isCall, const double* price,
+                                         double* volatility, ImpliedVolStatus* status, int* iterations) const {
+    const long count = static_cast<long>(n);
+    #pragma omp parallel for schedule(static) if (count >= PARALLEL_BATCH_THRESHOLD)
+    for (long i = 0; i < count; ++i) {
+        const ImpliedVolResult result =
+            solveEuropean(spot[i], strike[i], rate[i], maturity[i], isCall[i] != 0, price[i], settings_);
+        volatility[i] = result.volatility;
+        status[i] = result.status;
+        iterations[i] = result.iterations;
+    }
+}
+
+ImpliedVolResult ImpliedVolatilitySolver::solveAmerican(const OptionPricingModel& model, const OptionSpec& option,
+                                                        double price) const {
+    if (!(option.spot > 0) || !(option.strike > 0) || !(option.maturity > 0) || !std::isfinite(price)) {
+        return failure(ImpliedVolStatus::InvalidInput);
+    }
+    // Sans dividende, le call américain n'est jamais exercé avant l'échéance
+    if (option.isCall()) {
+        return solve(option, price);
+    }
+    if (price <= std::max(option.strike - option.spot, 0.0)) {
+        return failure(ImpliedVolStatus::BelowIntrinsic);
+    }
+    if (price >= option.strike) {
+        return failure(ImpliedVolStatus::AboveMaximum);
+    }
+
+    int evaluations = 0;
+    auto excess = [&](double vol) {
+        ++evaluations;
+        return model.calculatePrice(option.withVol(vol)) - price;
+    };
+
+    // Borne haute : volatilité européenne du même prix, élargie si le modèle
+    // (approché ou discrétisé) reste en dessous
+    const ImpliedVolResult european = solve(option, price);
+    const bool hasEuropean = european.status == ImpliedVolStatus::Converged ||
+                             european.status == ImpliedVolStatus::MaxIterations;
+    double hi = hasEuropean ? std::min(std::max(european.volatility, settings_.minVolatility), settings_.maxVolatility)
+                            : settings_.maxVolatility;
+    double fhi = excess(hi);
+    while (fhi < 0 && hi < settings_.maxVolatility) {
+        hi = std::min(2.0 * hi, settings_.maxVolatility);
+        fhi = excess(hi);
+    }
+    if (fhi < 0) {
+        return failure(ImpliedVolStatus::NoBracket, evaluations);
+    }
+    if (fhi == 0) {
+        return ImpliedVolResult{hi, ImpliedVolStatus::Converged, evaluations};
+    }
+
+    // Borne basse : la prime d'exercice anticipé est faible, on part près de hi
+    double lo = std::max(0.8 * hi, settings_.minVolatility);
+    double flo = lo < hi ? excess(lo) : fhi;
+    while (flo > 0 && lo > settings_.minVolatility) {
+        lo = std::max(0.5 * lo, settings_.minVolatility);
+        flo = excess(lo);
+    }
+    if (flo > 0) {
+        return failure(ImpliedVolStatus::NoBracket, evaluations);
+    }
+
+    // Méthode d'Illinois : fausse position, la valeur du côté qui ne bouge pas est divisée par deux
+    int side = 0;
+    double vol = hi;
+    while (evaluations < settings_.maxAmericanIterations) {
+        const double next = hi - fhi * (hi - lo) / (fhi - flo);
+        const double fnext = excess(next);
+        const bool converged = std::fabs(next - vol) <= settings_.americanTolerance || fnext == 0;
+        vol = next;
+        if (converged || hi - lo <= settings_.americanTolerance) {
+            return ImpliedVolResult{vol, ImpliedVolStatus::Converged, evaluations};
+        }
+        if (fnext > 0) {
+            hi = next;
+            fhi = fnext;
+            if (side == 1) {
+                flo *= 0.5;
+            }
+            side = 1;
+        } else {
+            lo = next;
+            flo = fnext;
+            if (side == -1) {
+                fhi *= 0.5;
+            }
+            side = -1;
+        }
+    }
+    return ImpliedVolResult{vol, ImpliedVolStatus::MaxIterations, evaluations};
+}
+
+void ImpliedVolatilitySolver::solveAmerican(const OptionPricingModel& model, const OptionBatch& quotes,
+                                            const std::vector<double>& prices, ImpliedVolBatch& results) const {
+    if (prices.size() != quotes.size()) {
+        throw std::invalid_argument("ImpliedVolatilitySolver: one price per quote is required");
+    }
+    const long n = static_cast<long>(quotes.size());
+    results.resize(quotes.size());
+    // Ordonnancement dynamique : le coût d'une inversion dépend du nombre d'évaluations
+    #pragma omp parallel for schedule(dynamic, 4) if (n >= PARALLEL_AMERICAN_THRESHOLD)
+    for (long i = 0; i < n; ++i) {
+        const ImpliedVolResult result = solveAmerican(model, quotes.spec(i), prices[i]);
+        results.volatility[i] = result.volatility;
+        results.status[i] = result.status;
+        results.iterations[i] = result.iterations;
+    }
+}
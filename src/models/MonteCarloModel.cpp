@@ -1,68 +1,741 @@
 #include "models/MonteCarloModel.hpp"
+#include "util/Philox.hpp"
+#include "util/SobolSequence.hpp"
+#include "util/VectorMath.hpp"
+#include "util/RunningStatistics.hpp"
+#include "util/BrownianBridge.hpp"
 #include <omp.h>
 #include <cmath>
-#include <random>
 #include <algorithm>
+#include <vector>
+#include <stdexcept>
+#include <chrono>
 
-MonteCarloModel::MonteCarloModel(int numSimulations) : numSimulations_(numSimulations) {}
+namespace {
 
-// Slower implementation 
-// double MonteCarloModel::calculatePrice(const Option& option) const {
-//     std::default_random_engine generator;
-//     std::normal_distribution<double> distribution(0.0, 1.0);
+/**
+ * État d'un bloc de trajectoires, rangé par composante (SoA) : seules la date
+ * courante (log du sous-jacent) et les statistiques cumulées sont conservées,
+ * jamais la trajectoire complète. Une instance par thread, réutilisée d'un
+ * bloc à l'autre.
+ */
+class PathBlock {
+public:
+    PathBlock(const OptionSpec& option, const PathDependentPayoff& payoff, int capacity)
+        : payoff_(payoff), strike_(option.strike), isCall_(option.isCall()),
+          logSpot_(std::log(option.spot)), sigma_(option.volatility),
+          logSpots_(capacity), sums_(capacity), minima_(capacity), maxima_(capacity), survival_(capacity) {
+        const double dt = option.maturity / payoff.monitoringDates;
+        stepDrift_ = (option.rate - 0.5 * sigma_ * sigma_) * dt;
+        if (payoff.isBarrier()) {
+            logBarrier_ = std::log(payoff.barrier);
+            // Trajectoire vivante tant que side * (log S - log B) > 0
+            const bool up = payoff.product == PathProduct::BarrierUpAndOut ||
+                            payoff.product == PathProduct::BarrierUpAndIn;
+            side_ = up ? -1.0 : 1.0;
+            // P(franchissement entre deux dates | extrémités) = exp(-2 d0 d1 / (sigma^2 dt))
+            crossingScale_ = 2.0 / (sigma_ * sigma_ * dt);
+        }
+    }
+
+    void reset(int count) {
+        count_ = count;
+        const double spot = std::exp(logSpot_);
+        const double alive = side_ * (logSpot_ - logBarrier_) > 0.0 ? 1.0 : 0.0;
+        std::fill(logSpots_.begin(), logSpots_.begin() + count, logSpot_);
+        std::fill(sums_.begin(), sums_.begin() + count, 0.0);
+        std::fill(minima_.begin(), minima_.begin() + count, spot);
+        std::fill(maxima_.begin(), maxima_.begin() + count, spot);
+        std::fill(survival_.begin(), survival_.begin() + count, alive);
+    }
+
+    // Avance toutes les trajectoires d'une date ; dw : accroissements browniens
+    void advance(const double* dw) {
+        double* x = logSpots_.data();
+        double* sum = sums_.data();
+        double* lo = minima_.data();
+        double* hi = maxima_.data();
+        const double drift = stepDrift_;
+        const double sigma = sigma_;
 
-//     double S = option.getSpotPrice();
-//     double K = option.getStrikePrice();
-//     double T = option.getTimeToMaturity();
-//     double r = option.getRiskFreeRate();
-//     double sigma = option.getVolatility();
+        if (payoff_.isBarrier()) {
+            double* alive = survival_.data();
+            const double side = side_;
+            const double logBarrier = logBarrier_;
+            const double scale = crossingScale_;
+            const bool continuous = payoff_.continuousMonitoring;
+            #pragma omp simd
+            for (int p = 0; p < count_; ++p) {
+                const double previous = x[p];
+                const double next = previous + drift + sigma * dw[p];
+                x[p] = next;
+                const double d0 = side * (previous - logBarrier);
+                const double d1 = side * (next - logBarrier);
+                // Barrière atteinte à la date, ou franchie entre deux dates (pont brownien)
+                const double bridge = continuous ? vecmath::exp(-scale * std::max(d0, 0.0) * d1) : 0.0;
+                const double hit = d1 > 0.0 ? bridge : 1.0;
+                alive[p] *= 1.0 - hit;
+            }
+        } else {
+            #pragma omp simd
+            for (int p = 0; p < count_; ++p) {
+                const double next = x[p] + drift + sigma * dw[p];
+                x[p] = next;
+                const double spot = vecmath::exp(next);
+                sum[p] += spot;
+                lo[p] = std::min(lo[p], spot);
+                hi[p] = std::max(hi[p], spot);
+            }
+        }
+    }
+
+    // Payoffs non actualisés, à appeler après la dernière date
+    void payoffs(double* out) const {
+        const double K = strike_;
+        const double w = isCall_ ? 1.0 : -1.0;
+        const double inverseDates = 1.0 / payoff_.monitoringDates;
+        const double* x = logSpots_.data();
+        const double* sum = sums_.data();
+        const double* lo = minima_.data();
+        const double* hi = maxima_.data();
+        const double* alive = survival_.data();
 
-//     double sumPayoff = 0.0;
-//     for (int i = 0; i < numSimulations_; ++i) {
-//         double Z = distribution(generator); // Random draw from a standard normal distribution
-//         double St = S * exp((r - 0.5 * sigma * sigma) * T + sigma * sqrt(T) * Z); // Simulated asset price at maturity
-//         double payoff = std::max(St - K, 0.0); // Payoff for a call option
-//         sumPayoff += payoff;
-//     }
+        switch (payoff_.product) {
+        case PathProduct::AsianArithmetic:
+            #pragma omp simd
+            for (int p = 0; p < count_; ++p) {
+                out[p] = std::max(w * (sum[p] * inverseDates - K), 0.0);
+            }
+            break;
+        case PathProduct::LookbackFloating:
+            #pragma omp simd
+            for (int p = 0; p < count_; ++p) {
+                const double spot = vecmath::exp(x[p]);
+                out[p] = isCall_ ? spot - lo[p] : hi[p] - spot;
+            }
+            break;
+        case PathProduct::LookbackFixed:
+            #pragma omp simd
+            for (int p = 0; p < count_; ++p) {
+                out[p] = isCall_ ? std::max(hi[p] - K, 0.0) : std::max(K - lo[p], 0.0);
+            }
+            break;
+        case PathProduct::BarrierUpAndOut:
+        case PathProduct::BarrierDownAndOut:
+            #pragma omp simd
+            for (int p = 0; p < count_; ++p) {
+                out[p] = alive[p] * std::max(w * (vecmath::exp(x[p]) - K), 0.0);
+            }
+            break;
+        case PathProduct::BarrierUpAndIn:
+        case PathProduct::BarrierDownAndIn:
+            #pragma omp simd
+            for (int p = 0; p < count_; ++p) {
+                out[p] = (1.0 - alive[p]) * std::max(w * (vecmath::exp(x[p]) - K), 0.0);
+            }
+            break;
+        }
+    }
 
-//     double optionPrice = exp(-r * T) * (sumPayoff / numSimulations_); // Discounted average payoff
-//     return optionPrice;
-// }
+private:
+    PathDependentPayoff payoff_;
+    double strike_;
+    bool isCall_;
+    double logSpot_;
+    double sigma_;
+    double stepDrift_ = 0.0;
+    double logBarrier_ = 0.0;
+    double side_ = 1.0;
+    double crossingScale_ = 0.0;
+    int count_ = 0;
 
+    std::vector<double> logSpots_;
+    std::vector<double> sums_;      // Somme des fixings (Asiatique)
+    std::vector<double> minima_;    // Extrema courants (lookback)
+    std::vector<double> maxima_;
+    std::vector<double> survival_;  // Probabilité de ne pas avoir touché la barrière
+};
+
+void validatePathPayoff(const PathDependentPayoff& payoff) {
+    if (payoff.monitoringDates <= 0) {
+        throw std::invalid_argument("monitoringDates must be positive");
+    }
+    if (payoff.isBarrier() && payoff.barrier <= 0.0) {
+        throw std::invalid_argument("barrier must be positive");
+    }
+}
+
+} // namespace
+
+MonteCarloModel::MonteCarloModel(int numSimulations, std::uint64_t seed)
+    : MonteCarloModel(numSimulations, SamplingMethod::PseudoRandom, DEFAULT_RANDOMIZATIONS, seed) {
+}
+
+MonteCarloModel::MonteCarloModel(int numSimulations, SamplingMethod sampling, int randomizations, std::uint64_t seed)
+    : numSimulations_(numSimulations), seed_(seed), sampling_(sampling), randomizations_(randomizations) {
+    if (numSimulations <= 0) {
+        throw std::invalid_argument("numSimulations must be positive");
+    }
+    if (randomizations <= 0) {
+        throw std::invalid_argument("randomizations must be positive");
+    }
+}
+
+int MonteCarloModel::getNumSimulations() const {
+    return numSimulations_;
+}
+
+std::uint64_t MonteCarloModel::getSeed() const {
+    return seed_;
+}
+
+SamplingMethod MonteCarloModel::getSamplingMethod() const {
+    return sampling_;
+}
+
+int MonteCarloModel::getRandomizations() const {
+    return randomizations_;
+}
+
+double MonteCarloModel::calculatePrice(const OptionSpec& option) const {
+    return simulate(option, seed_).price;
+}
+
+double MonteCarloModel::calculatePrice(const OptionSpec& option, std::uint64_t seed) const {
+    return simulate(option, seed).price;
+}
+
+MonteCarloResult MonteCarloModel::simulate(const OptionSpec& option) const {
+    return simulate(option, seed_);
+}
+
+MonteCarloResult MonteCarloModel::simulate(const OptionSpec& option, std::uint64_t seed) const {
+    return sampling_ == SamplingMethod::Sobol ? simulateSobol(option, seed)
+                                              : simulatePseudoRandom(option, seed);
+}
 
-double MonteCarloModel::calculatePrice(const Option& option) const {
+MonteCarloResult MonteCarloModel::simulatePseudoRandom(const OptionSpec& option, std::uint64_t seed) const {
     // Paramètres de l'option
-    double S = option.getSpotPrice();
-    double K = option.getStrikePrice();
-    double T = option.getTimeToMaturity();
-    double r = option.getRiskFreeRate();
-    double sigma = option.getVolatility();
-    std::string optionType = option.getType(); // Récupération du type d'option (call/put)
+    const double S = option.spot;
+    const double K = option.strike;
+    const double T = option.maturity;
+    const double r = option.rate;
+    const double sigma = option.volatility;
+    const bool isCall = option.isCall(); // Type d'option (call/put)
 
+    // Pré-calcul des termes constants
+    const double drift = S * exp((r - 0.5 * sigma * sigma) * T);
+    const double vol = sigma * sqrt(T);
+
+    // Générateur à compteur : la trajectoire i utilise toujours le compteur (i, 0)
+    const Philox4x32 generator(seed);
+
+    // Chaque bloc de trajectoires a ses propres sommes ; les blocs sont fixés
+    // indépendamment du nombre de threads
+    const long numBlocks = (numSimulations_ + PATH_BLOCK - 1) / PATH_BLOCK;
+    std::vector<double> blockSums(numBlocks, 0.0);
+    std::vector<double> blockSquares(numBlocks, 0.0);
+
+    #pragma omp parallel for schedule(static)
+    for (long block = 0; block < numBlocks; ++block) {
+        const long first = block * PATH_BLOCK;
+        const int count = static_cast<int>(std::min<long>(PATH_BLOCK, numSimulations_ - first));
+
+        double Z[PATH_BLOCK];
+        double payoffs[PATH_BLOCK];
+        generator.normalPairs(static_cast<std::uint64_t>(first), count, 0, Z, nullptr);
+
+        #pragma omp simd
+        for (int i = 0; i < count; ++i) {
+            const double St = drift * vecmath::exp(vol * Z[i]); // Prix simulé à maturité
+            payoffs[i] = isCall ? std::max(St - K, 0.0) : std::max(K - St, 0.0);
+        }
+
+        // Sommes séquentielles : ordre d'addition fixe
+        double sum = 0.0;
+        double squares = 0.0;
+        for (int i = 0; i < count; ++i) {
+            sum += payoffs[i];
+            squares += payoffs[i] * payoffs[i];
+        }
+        blockSums[block] = sum;
+        blockSquares[block] = squares;
+    }
+
+    // Réduction des blocs dans l'ordre
     double sumPayoff = 0.0;
+    double sumSquares = 0.0;
+    for (long block = 0; block < numBlocks; ++block) {
+        sumPayoff += blockSums[block];
+        sumSquares += blockSquares[block];
+    }
 
-    // Pré-calcul des termes constants
-    double drift = exp((r - 0.5 * sigma * sigma) * T);
-    double vol = sigma * sqrt(T);
+    // Moyenne des paiements et actualisation
+    const double discount = exp(-r * T);
+    const double n = static_cast<double>(numSimulations_);
+    const double mean = sumPayoff / n;
+    const double variance = numSimulations_ > 1 ? std::max(sumSquares - n * mean * mean, 0.0) / (n - 1.0) : 0.0;
+
+    MonteCarloResult result;
+    result.price = discount * mean;
+    result.standardError = discount * std::sqrt(variance / n);
+    result.pathsUsed = numSimulations_;
+    return result;
+}
+
+// Quasi Monte Carlo randomisé : chaque décalage numérique de la suite de Sobol
+// donne un estimateur sans biais ; leur dispersion fournit l'erreur standard
+MonteCarloResult MonteCarloModel::simulateSobol(const OptionSpec& option, std::uint64_t seed) const {
+    const double S = option.spot;
+    const double K = option.strike;
+    const double T = option.maturity;
+    const double r = option.rate;
+    const double sigma = option.volatility;
+    const bool isCall = option.isCall();
+
+    const double drift = S * exp((r - 0.5 * sigma * sigma) * T);
+    const double vol = sigma * sqrt(T);
+
+    // Payoff européen : une seule dimension (W(T), premier point du pont brownien)
+    const SobolSequence sobol(1);
+    const int R = randomizations_;
+    const long pointsPerRandomization = (numSimulations_ + R - 1) / R;
+    const long blocksPerRandomization = (pointsPerRandomization + PATH_BLOCK - 1) / PATH_BLOCK;
+    const long numTasks = R * blocksPerRandomization;
+
+    // Décalage numérique de chaque randomisation, tiré du générateur à compteur
+    const Philox4x32 generator(seed);
+    std::vector<std::uint32_t> shifts(R);
+    for (int k = 0; k < R; ++k) {
+        std::uint32_t words[4];
+        generator.generate(static_cast<std::uint32_t>(k), 0, 0, 0, words);
+        shifts[k] = words[0];
+    }
+
+    std::vector<double> blockSums(numTasks, 0.0);
+
+    #pragma omp parallel for schedule(static)
+    for (long task = 0; task < numTasks; ++task) {
+        const int k = static_cast<int>(task / blocksPerRandomization);
+        const long first = (task % blocksPerRandomization) * PATH_BLOCK;
+        const int count = static_cast<int>(std::min<long>(PATH_BLOCK, pointsPerRandomization - first));
+
+        std::uint32_t points[PATH_BLOCK];
+        double payoffs[PATH_BLOCK];
+        sobol.generate(static_cast<std::uint64_t>(first), count, 0, points);
+
+        const std::uint32_t shift = shifts[k];
+        #pragma omp simd
+        for (int i = 0; i < count; ++i) {
+            const double Z = vecmath::normInv(SobolSequence::toUniform(points[i], shift));
+            const double St = drift * vecmath::exp(vol * Z);
+            payoffs[i] = isCall ? std::max(St - K, 0.0) : std::max(K - St, 0.0);
+        }
+
+        double sum = 0.0;
+        for (int i = 0; i < count; ++i) {
+            sum += payoffs[i];
+        }
+        blockSums[task] = sum;
+    }
+
+    // Estimateur de chaque randomisation puis moyenne et dispersion
+    const double discount = exp(-r * T);
+    std::vector<double> estimates(R, 0.0);
+    double mean = 0.0;
+    for (int k = 0; k < R; ++k) {
+        double sum = 0.0;
+        for (long b = 0; b < blocksPerRandomization; ++b) {
+            sum += blockSums[k * blocksPerRandomization + b];
+        }
+        estimates[k] = discount * sum / pointsPerRandomization;
+        mean += estimates[k];
+    }
+    mean /= R;
+
+    double variance = 0.0;
+    for (int k = 0; k < R; ++k) {
+        variance += (estimates[k] - mean) * (estimates[k] - mean);
+    }
+    variance = R > 1 ? variance / (R - 1) : 0.0;
+
+    MonteCarloResult result;
+    result.price = mean;
+    result.standardError = std::sqrt(variance / R);
+    result.pathsUsed = R * pointsPerRandomization;
+    return result;
+}
 
-    // Générateur aléatoire par thread
-    #pragma omp parallel reduction(+:sumPayoff)
+MonteCarloGreeks MonteCarloModel::simulateGreeks(const OptionSpec& option) const {
+    return simulateGreeks(option, seed_);
+}
+
+// Estimateurs sur S_T = S exp((r - sigma^2/2) T + sigma sqrt(T) Z), payoff g :
+//   delta = e^{-rT} g'(S_T) S_T / S
+//   vega  = e^{-rT} g'(S_T) S_T (sqrt(T) Z - sigma T)
+//   rho   = T e^{-rT} (g'(S_T) S_T - g(S_T))
+//   theta = e^{-rT} (g'(S_T) S_T ((r - sigma^2/2) + sigma Z / (2 sqrt(T))) - r g(S_T))
+//   gamma = e^{-rT} g'(S_T) S_T / S^2 (Z / (sigma sqrt(T)) - 1)   (delta dérivé par rapport à S par LR)
+// avec g'(x) = 1{x > K} pour un call, -1{x < K} pour un put
+MonteCarloGreeks MonteCarloModel::simulateGreeks(const OptionSpec& option, std::uint64_t seed) const {
+    const double S = option.spot;
+    const double K = option.strike;
+    const double T = option.maturity;
+    const double r = option.rate;
+    const double sigma = option.volatility;
+    const double w = option.isCall() ? 1.0 : -1.0;
+
+    const double sqrtT = sqrt(T);
+    const double drift = S * exp((r - 0.5 * sigma * sigma) * T);
+    const double vol = sigma * sqrtT;
+    const double discount = exp(-r * T);
+    const double driftRate = r - 0.5 * sigma * sigma;
+
+    // Même découpage et mêmes tirages que simulatePseudoRandom : le prix est identique
+    enum { PRICE, DELTA, GAMMA, VEGA, THETA, RHO, ESTIMATORS };
+    const Philox4x32 generator(seed);
+    const long numBlocks = (numSimulations_ + PATH_BLOCK - 1) / PATH_BLOCK;
+    std::vector<double> blockSums(numBlocks * ESTIMATORS, 0.0);
+    std::vector<double> blockSquares(numBlocks * ESTIMATORS, 0.0);
+
+    #pragma omp parallel for schedule(static)
+    for (long block = 0; block < numBlocks; ++block) {
+        const long first = block * PATH_BLOCK;
+        const int count = static_cast<int>(std::min<long>(PATH_BLOCK, numSimulations_ - first));
+
+        double Z[PATH_BLOCK];
+        double values[ESTIMATORS][PATH_BLOCK];
+        generator.normalPairs(static_cast<std::uint64_t>(first), count, 0, Z, nullptr);
+
+        #pragma omp simd
+        for (int i = 0; i < count; ++i) {
+            const double St = drift * vecmath::exp(vol * Z[i]);
+            const double payoff = std::max(w * (St - K), 0.0);
+            // g'(S_T) S_T, actualisé
+            const double slope = w * (payoff > 0.0 ? 1.0 : 0.0) * St * discount;
+            values[PRICE][i] = discount * payoff;
+            values[DELTA][i] = slope / S;
+            values[GAMMA][i] = slope / (S * S) * (Z[i] / vol - 1.0);
+            values[VEGA][i] = slope * (sqrtT * Z[i] - sigma * T);
+            values[THETA][i] = slope * (driftRate + 0.5 * sigma * Z[i] / sqrtT) - r * discount * payoff;
+            values[RHO][i] = T * (slope - discount * payoff);
+        }
+
+        for (int e = 0; e < ESTIMATORS; ++e) {
+            double sum = 0.0;
+            double squares = 0.0;
+            for (int i = 0; i < count; ++i) {
+                sum += values[e][i];
+                squares += values[e][i] * values[e][i];
+            }
+            blockSums[block * ESTIMATORS + e] = sum;
+            blockSquares[block * ESTIMATORS + e] = squares;
+        }
+    }
+
+    // Réduction des blocs dans l'ordre, moyenne et erreur standard de chaque estimateur
+    const double n = static_cast<double>(numSimulations_);
+    double mean[ESTIMATORS];
+    double error[ESTIMATORS];
+    for (int e = 0; e < ESTIMATORS; ++e) {
+        double sum = 0.0;
+        double squares = 0.0;
+        for (long block = 0; block < numBlocks; ++block) {
+            sum += blockSums[block * ESTIMATORS + e];
+            squares += blockSquares[block * ESTIMATORS + e];
+        }
+        mean[e] = sum / n;
+        const double variance = numSimulations_ > 1 ? std::max(squares - n * mean[e] * mean[e], 0.0) / (n - 1.0) : 0.0;
+        error[e] = std::sqrt(variance / n);
+    }
+
+    MonteCarloGreeks result;
+    result.value.price = mean[PRICE];
+    result.value.delta = mean[DELTA];
+    result.value.gamma = mean[GAMMA];
+    result.value.vega = mean[VEGA];
+    result.value.theta = mean[THETA];
+    result.value.rho = mean[RHO];
+    result.standardError.price = error[PRICE];
+    result.standardError.delta = error[DELTA];
+    result.standardError.gamma = error[GAMMA];
+    result.standardError.vega = error[VEGA];
+    result.standardError.theta = error[THETA];
+    result.standardError.rho = error[RHO];
+    result.pathsUsed = numSimulations_;
+    return result;
+}
+
+// Monte Carlo adaptatif : lots successifs de trajectoires, estimateur
+// antithétique avec variable de contrôle e^{-rT} S_T (d'espérance S0),
+// arrêt sur l'erreur standard cible, le budget de temps ou de trajectoires
+MonteCarloResult MonteCarloModel::simulateAdaptive(const OptionSpec& option, const AdaptiveSettings& settings) const {
+    if (settings.batchPaths <= 0 || settings.maxPaths <= 0) {
+        throw std::invalid_argument("batchPaths and maxPaths must be positive");
+    }
+
+    const double S = option.spot;
+    const double K = option.strike;
+    const double T = option.maturity;
+    const double r = option.rate;
+    const double sigma = option.volatility;
+    const bool isCall = option.isCall();
+
+    const double drift = S * exp((r - 0.5 * sigma * sigma) * T);
+    const double vol = sigma * sqrt(T);
+    const double discount = exp(-r * T);
+    const bool antithetic = settings.antithetic;
+
+    // Une observation = une paire (Z, -Z) en mode antithétique, une trajectoire sinon
+    const int pathsPerSample = antithetic ? 2 : 1;
+    const long samplesPerBatch = std::max<long>(1, settings.batchPaths / pathsPerSample);
+    const long blocksPerBatch = (samplesPerBatch + PATH_BLOCK - 1) / PATH_BLOCK;
+
+    const Philox4x32 generator(seed_);
+    std::vector<RunningCovariance> blockStats(blocksPerBatch);
+    std::vector<RunningStatistics> blockCrude(blocksPerBatch);
+    RunningCovariance total;   // (contrôle, payoff de l'observation)
+    RunningStatistics crude;   // Payoffs individuels, pour le ratio de réduction de variance
+
+    const auto start = std::chrono::steady_clock::now();
+    MonteCarloResult result;
+
+    for (long batch = 0; ; ++batch) {
+        #pragma omp parallel for schedule(static)
+        for (long block = 0; block < blocksPerBatch; ++block) {
+            const long offset = block * PATH_BLOCK;
+            const int count = static_cast<int>(std::min<long>(PATH_BLOCK, samplesPerBatch - offset));
+            const std::uint64_t firstSample = static_cast<std::uint64_t>(batch * samplesPerBatch + offset);
+
+            double Z[PATH_BLOCK];
+            double payoffs[PATH_BLOCK];
+            double mirrored[PATH_BLOCK];
+            double controls[PATH_BLOCK];
+            generator.normalPairs(firstSample, count, 0, Z, nullptr);
+
+            #pragma omp simd
+            for (int i = 0; i < count; ++i) {
+                const double up = drift * vecmath::exp(vol * Z[i]);
+                const double down = drift * vecmath::exp(-vol * Z[i]);
+                payoffs[i] = discount * (isCall ? std::max(up - K, 0.0) : std::max(K - up, 0.0));
+                mirrored[i] = discount * (isCall ? std::max(down - K, 0.0) : std::max(K - down, 0.0));
+                controls[i] = discount * (antithetic ? 0.5 * (up + down) : up);
+            }
+
+            // Accumulateurs de Welford propres au bloc
+            RunningCovariance stats;
+            RunningStatistics single;
+            for (int i = 0; i < count; ++i) {
+                stats.add(controls[i], antithetic ? 0.5 * (payoffs[i] + mirrored[i]) : payoffs[i]);
+                single.add(payoffs[i]);
+                if (antithetic) {
+                    single.add(mirrored[i]);
+                }
+            }
+            blockStats[block] = stats;
+            blockCrude[block] = single;
+        }
+
+        // Fusion dans l'ordre des blocs
+        for (long block = 0; block < blocksPerBatch; ++block) {
+            total.merge(blockStats[block]);
+            crude.merge(blockCrude[block]);
+        }
+
+        // Estimateur avec coefficient de contrôle optimal beta = Cov(X, Y) / Var(X)
+        double price = total.meanY;
+        double variance = total.varianceY();
+        if (settings.controlVariate && total.varianceX() > 0.0) {
+            const double beta = total.covariance() / total.varianceX();
+            price -= beta * (total.meanX - S);
+            variance = std::max(variance - beta * total.covariance(), 0.0);
+        }
+
+        result.price = price;
+        result.standardError = std::sqrt(variance / total.count);
+        result.pathsUsed = static_cast<long>(total.count) * pathsPerSample;
+
+        const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (result.standardError <= settings.targetStandardError ||
+            elapsed >= settings.maxSeconds ||
+            result.pathsUsed + samplesPerBatch * pathsPerSample > settings.maxPaths) {
+            break;
+        }
+    }
+
+    // Variance du Monte Carlo brut avec le même nombre de trajectoires
+    const double crudeVariance = crude.variance() / result.pathsUsed;
+    const double achievedVariance = result.standardError * result.standardError;
+    result.varianceReductionRatio = achievedVariance > 0.0 ? crudeVariance / achievedVariance : 1.0;
+    return result;
+}
+
+MonteCarloResult MonteCarloModel::simulatePathDependent(const OptionSpec& option,
+                                                        const PathDependentPayoff& payoff) const {
+    return simulatePathDependent(option, payoff, seed_);
+}
+
+MonteCarloResult MonteCarloModel::simulatePathDependent(const OptionSpec& option, const PathDependentPayoff& payoff,
+                                                        std::uint64_t seed) const {
+    validatePathPayoff(payoff);
+    return sampling_ == SamplingMethod::Sobol ? simulatePathsSobol(option, payoff, seed)
+                                              : simulatePathsPseudoRandom(option, payoff, seed);
+}
+
+// Trajectoires Philox : la date i de la trajectoire p utilise le tirage i de p,
+// produit par paires (deux dates par appel au générateur)
+MonteCarloResult MonteCarloModel::simulatePathsPseudoRandom(const OptionSpec& option,
+                                                            const PathDependentPayoff& payoff,
+                                                            std::uint64_t seed) const {
+    const int steps = payoff.monitoringDates;
+    const double sqrtDt = std::sqrt(option.maturity / steps);
+    const Philox4x32 generator(seed);
+
+    const long numBlocks = (numSimulations_ + PATH_BLOCK - 1) / PATH_BLOCK;
+    std::vector<RunningStatistics> blockStats(numBlocks);
+
+    #pragma omp parallel
     {
-        std::default_random_engine generator(omp_get_thread_num()); // Un générateur par thread
-        std::normal_distribution<double> distribution(0.0, 1.0);
+        PathBlock paths(option, payoff, PATH_BLOCK);
+        std::vector<double> even(PATH_BLOCK);
+        std::vector<double> odd(PATH_BLOCK);
+        std::vector<double> payoffs(PATH_BLOCK);
 
-        #pragma omp for
-        for (int i = 0; i < numSimulations_; ++i) {
-            double Z = distribution(generator); // Tirage aléatoire
-            double St = S * drift * exp(vol * Z); // Prix simulé à maturité
+        #pragma omp for schedule(static)
+        for (long block = 0; block < numBlocks; ++block) {
+            const long first = block * PATH_BLOCK;
+            const int count = static_cast<int>(std::min<long>(PATH_BLOCK, numSimulations_ - first));
+            paths.reset(count);
 
-            // Calcul du paiement en fonction du type d'option
-            double payoff = (optionType == "call") ? std::max(St - K, 0.0) : std::max(K - St, 0.0);
-            sumPayoff += payoff;
+            for (int step = 0; step < steps; step += 2) {
+                const bool pair = step + 1 < steps;
+                generator.normalPairs(static_cast<std::uint64_t>(first), count, static_cast<std::uint64_t>(step / 2),
+                                      even.data(), pair ? odd.data() : nullptr);
+                #pragma omp simd
+                for (int p = 0; p < count; ++p) {
+                    even[p] *= sqrtDt;
+                    odd[p] *= sqrtDt;
+                }
+                paths.advance(even.data());
+                if (pair) {
+                    paths.advance(odd.data());
+                }
+            }
+
+            paths.payoffs(payoffs.data());
+            RunningStatistics stats;
+            for (int p = 0; p < count; ++p) {
+                stats.add(payoffs[p]);
+            }
+            blockStats[block] = stats;
         }
     }
 
-    // Moyenne des paiements et actualisation
-    double optionPrice = exp(-r * T) * (sumPayoff / numSimulations_);
-    return optionPrice;
+    RunningStatistics total;
+    for (long block = 0; block < numBlocks; ++block) {
+        total.merge(blockStats[block]);
+    }
+
+    const double discount = exp(-option.rate * option.maturity);
+    MonteCarloResult result;
+    result.price = discount * total.mean;
+    result.standardError = discount * std::sqrt(total.variance() / total.count);
+    result.pathsUsed = numSimulations_;
+    return result;
+}
+
+// Trajectoires Sobol : une dimension par date, attribuées par le pont brownien
+// pour que les premières dimensions portent l'essentiel de la variance
+MonteCarloResult MonteCarloModel::simulatePathsSobol(const OptionSpec& option, const PathDependentPayoff& payoff,
+                                                     std::uint64_t seed) const {
+    const int steps = payoff.monitoringDates;
+    const SobolSequence sobol(steps);
+    const BrownianBridge bridge(steps, option.maturity);
+
+    // Blocs plus petits qu'en pseudo-aléatoire : la matrice dates x trajectoires
+    // des normales doit rester en cache
+    const int blockSize = std::max(16, std::min(PATH_BLOCK, SOBOL_BLOCK_VALUES / steps));
+    const int R = randomizations_;
+    const long pointsPerRandomization = (numSimulations_ + R - 1) / R;
+    const long blocksPerRandomization = (pointsPerRandomization + blockSize - 1) / blockSize;
+    const long numTasks = R * blocksPerRandomization;
+
+    // Décalage numérique de chaque (randomisation, dimension)
+    const Philox4x32 generator(seed);
+    std::vector<std::uint32_t> shifts(static_cast<std::size_t>(R) * steps);
+    for (int k = 0; k < R; ++k) {
+        for (int d = 0; d < steps; ++d) {
+            std::uint32_t words[4];
+            generator.generate(static_cast<std::uint32_t>(k), static_cast<std::uint32_t>(d), 0, 0, words);
+            shifts[static_cast<std::size_t>(k) * steps + d] = words[0];
+        }
+    }
+
+    std::vector<double> blockSums(numTasks, 0.0);
+
+    #pragma omp parallel
+    {
+        PathBlock paths(option, payoff, blockSize);
+        std::vector<std::uint32_t> points(blockSize);
+        std::vector<double> normals(static_cast<std::size_t>(steps) * blockSize);
+        std::vector<double> increments(static_cast<std::size_t>(steps) * blockSize);
+        std::vector<double> payoffs(blockSize);
+
+        #pragma omp for schedule(static)
+        for (long task = 0; task < numTasks; ++task) {
+            const int k = static_cast<int>(task / blocksPerRandomization);
+            const long first = (task % blocksPerRandomization) * blockSize;
+            const int count = static_cast<int>(std::min<long>(blockSize, pointsPerRandomization - first));
+
+            // Normales rangées par dimension : normals[d * count + p]
+            for (int d = 0; d < steps; ++d) {
+                sobol.generate(static_cast<std::uint64_t>(first), count, d, points.data());
+                const std::uint32_t shift = shifts[static_cast<std::size_t>(k) * steps + d];
+                double* row = normals.data() + static_cast<std::size_t>(d) * count;
+                #pragma omp simd
+                for (int p = 0; p < count; ++p) {
+                    row[p] = vecmath::normInv(SobolSequence::toUniform(points[p], shift));
+                }
+            }
+            bridge.buildIncrements(normals.data(), increments.data(), count);
+
+            paths.reset(count);
+            for (int step = 0; step < steps; ++step) {
+                paths.advance(increments.data() + static_cast<std::size_t>(step) * count);
+            }
+
+            paths.payoffs(payoffs.data());
+            double sum = 0.0;
+            for (int p = 0; p < count; ++p) {
+                sum += payoffs[p];
+            }
+            blockSums[task] = sum;
+        }
+    }
+
+    // Estimateur de chaque randomisation puis moyenne et dispersion
+    const double discount = exp(-option.rate * option.maturity);
+    RunningStatistics estimates;
+    for (int k = 0; k < R; ++k) {
+        double sum = 0.0;
+        for (long b = 0; b < blocksPerRandomization; ++b) {
+            sum += blockSums[k * blocksPerRandomization + b];
+        }
+        estimates.add(discount * sum / pointsPerRandomization);
+    }
+
+    MonteCarloResult result;
+    result.price = estimates.mean;
+    result.standardError = std::sqrt(estimates.variance() / R);
+    result.pathsUsed = R * pointsPerRandomization;
+    return result;
+}
+
+// Un tirage, une exponentielle et un payoff par trajectoire
+double MonteCarloModel::costHint(const OptionSpec&) const {
+    return 20.0 * numSimulations_;
+}
+
+bool MonteCarloModel::isInternallyParallel() const {
+    return true;
 }
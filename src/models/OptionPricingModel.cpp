@@ -0,0 +1,19 @@
+#include "models/OptionPricingModel.hpp"
+
+// Implémentation par défaut : price chaque option individuellement
+void OptionPricingModel::calculatePrices(const OptionBatch& batch, std::vector<double>& prices) const {
+    const std::size_t n = batch.size();
+    prices.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        prices[i] = calculatePrice(batch.spec(i));
+    }
+}
+
+// Ordre de grandeur d'une formule fermée
+double OptionPricingModel::costHint(const OptionSpec&) const {
+    return 100.0;
+}
+
+bool OptionPricingModel::isInternallyParallel() const {
+    return false;
+}
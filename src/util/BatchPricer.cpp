@@ -0,0 +1,419 @@
+#include "util/BatchPricer.hpp"
+#include "Factory/PricingModelFactory.hpp"
+#include "domain/Option.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "models/CachedPricingModel.hpp"
+#include "util/CsvFormat.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+
+namespace {
+
+const char* const REQUIRED_COLUMNS[] = {"spot", "strike", "rate", "volatility", "maturity", "type"};
+constexpr std::size_t REQUIRED_COUNT = sizeof(REQUIRED_COLUMNS) / sizeof(REQUIRED_COLUMNS[0]);
+constexpr std::size_t NO_COLUMN = static_cast<std::size_t>(-1);
+
+// Position des colonnes utiles dans l'en-tête
+struct ColumnLayout {
+    std::array<std::size_t, REQUIRED_COUNT> required;
+    std::size_t id = NO_COLUMN;
+    std::size_t model = NO_COLUMN;
+};
+
+// Ligne du paquet courant
+struct BatchRow {
+    std::string id;
+    std::string model;
+    const OptionPricingModel* pricer = nullptr;
+    OptionSpec option{};
+    std::string status;      // Vide tant qu'aucune erreur
+    Greeks greeks;
+    std::string line;        // Ligne de sortie formatée
+};
+
+ColumnLayout parseHeader(const std::string& header) {
+    std::vector<std::string_view> fields;
+    splitCsvLine(header, fields);
+
+    ColumnLayout layout;
+    layout.required.fill(NO_COLUMN);
+    for (std::size_t c = 0; c < fields.size(); ++c) {
+        for (std::size_t r = 0; r < REQUIRED_COUNT; ++r) {
+            if (fields[c] == REQUIRED_COLUMNS[r]) {
+                layout.required[r] = c;
+            }
+        }
+        if (fields[c] == "id") {
+            layout.id = c;
+        } else if (fields[c] == "model") {
+            layout.model = c;
+        }
+    }
+    for (std::size_t r = 0; r < REQUIRED_COUNT; ++r) {
+        if (layout.required[r] == NO_COLUMN) {
+            throw std::invalid_argument(std::string("BatchPricer: missing column '") + REQUIRED_COLUMNS[r] + "'");
+        }
+    }
+    return layout;
+}
+
+double greekValue(const Greeks& g, GreekColumn column) {
+    switch (column) {
+        case GreekColumn::Delta: return g.delta;
+        case GreekColumn::Gamma: return g.gamma;
+        case GreekColumn::Vega:  return g.vega;
+        case GreekColumn::Theta: return g.theta;
+        case GreekColumn::Rho:   return g.rho;
+    }
+    return 0.0;
+}
+
+SchedulerSettings schedulerSettings(const BatchSettings& settings) {
+    SchedulerSettings scheduler;
+    scheduler.computeGreeks = !settings.greeks.empty();
+    return scheduler;
+}
+
+} // namespace
+
+GreekColumn parseGreekColumn(const std::string& name) {
+    for (GreekColumn column : {GreekColumn::Delta, GreekColumn::Gamma, GreekColumn::Vega,
+                               GreekColumn::Theta, GreekColumn::Rho}) {
+        if (name == toString(column)) {
+            return column;
+        }
+    }
+    throw std::invalid_argument("Unknown greek: " + name + " (expected delta, gamma, vega, theta or rho)");
+}
+
+const char* toString(GreekColumn column) {
+    switch (column) {
+        case GreekColumn::Delta: return "delta";
+        case GreekColumn::Gamma: return "gamma";
+        case GreekColumn::Vega:  return "vega";
+        case GreekColumn::Theta: return "theta";
+        case GreekColumn::Rho:   return "rho";
+    }
+    return "unknown";
+}
+
+BatchPricer::BatchPricer(const BatchSettings& settings)
+    : settings_(settings), scheduler_(schedulerSettings(settings)) {
+    if (settings_.chunkRows == 0) {
+        throw std::invalid_argument("BatchPricer: chunkRows must be positive");
+    }
+}
+
+const BatchSettings& BatchPricer::getSettings() const {
+    return settings_;
+}
+
+const OptionPricingModel* BatchPricer::model(const std::string& spec, std::string& error) {
+    const auto found = models_.find(spec);
+    if (found != models_.end()) {
+        return found->second.get();
+    }
+    const auto failed = modelErrors_.find(spec);
+    if (failed != modelErrors_.end()) {
+        error = failed->second;
+        return nullptr;
+    }
+
+    try {
+        auto created = PricingModelFactory::createModelFromSpec(spec);
+        if (!created) {
+            throw std::invalid_argument("unknown model '" + spec + "'");
+        }
+        if (settings_.cache && CachedPricingModel::isWorthCaching(*created)) {
+            created = std::make_unique<CachedPricingModel>(std::shared_ptr<const OptionPricingModel>(std::move(created)),
+                                                           settings_.cache, spec);
+        }
+        return models_.emplace(spec, std::move(created)).first->second.get();
+    } catch (const std::exception& e) {
+        error = e.what();
+        modelErrors_.emplace(spec, error);
+        return nullptr;
+    }
+}
+
+BatchSummary BatchPricer::run(std::istream& input, std::ostream& output) {
+    const auto start = std::chrono::steady_clock::now();
+    BatchSummary summary;
+
+    std::string header;
+    if (!std::getline(input, header)) {
+        throw std::invalid_argument("BatchPricer: empty input, a header line is required");
+    }
+    const ColumnLayout layout = parseHeader(header);
+
+    output << "id,model,price";
+    for (GreekColumn column : settings_.greeks) {
+        output << ',' << toString(column);
+    }
+    output << ",status\n";
+
+    std::vector<BatchRow> rows(settings_.chunkRows);
+    std::vector<std::string_view> fields;
+    std::string text;
+    std::vector<PricingTask> tasks;
+    std::vector<std::size_t> taskRows;
+    std::vector<PricingTaskResult> taskResults;
+
+    while (input) {
+        // Lecture et analyse (séquentielles : les modèles sont créés ici, pas dans la région parallèle)
+        std::size_t count = 0;
+        while (count < rows.size() && std::getline(input, text)) {
+            if (trimCsvField(text).empty()) {
+                continue;
+            }
+            BatchRow& row = rows[count++];
+            ++summary.rows;
+            row.status.clear();
+            row.pricer = nullptr;
+
+            splitCsvLine(text, fields);
+            row.id = layout.id < fields.size() && !fields[layout.id].empty()
+                         ? std::string(fields[layout.id]) : std::to_string(summary.rows);
+            row.model = layout.model < fields.size() && !fields[layout.model].empty()
+                            ? std::string(fields[layout.model]) : settings_.defaultModel;
+            try {
+                double values[REQUIRED_COUNT - 1];
+                for (std::size_t r = 0; r + 1 < REQUIRED_COUNT; ++r) {
+                    const std::size_t c = layout.required[r];
+                    if (c >= fields.size()) {
+                        throw std::invalid_argument(std::string("missing ") + REQUIRED_COLUMNS[r]);
+                    }
+                    values[r] = parseCsvNumber(fields[c], REQUIRED_COLUMNS[r]);
+                }
+                const std::size_t typeColumn = layout.required[REQUIRED_COUNT - 1];
+                if (typeColumn >= fields.size()) {
+                    throw std::invalid_argument("missing type");
+                }
+                // Mêmes règles de validation qu'en ligne de commande
+                row.option = Option(values[0], values[1], values[2], values[3], values[4],
+                                    std::string(fields[typeColumn])).spec();
+                row.pricer = model(row.model, row.status);
+            } catch (const std::exception& e) {
+                row.status = e.what();
+            }
+        }
+        if (count == 0) {
+            break;
+        }
+        ++summary.chunks;
+
+        // Pricing : les lignes valides sont confiées à l'ordonnanceur, qui
+        // équilibre les modèles de coûts très différents
+        tasks.clear();
+        taskRows.clear();
+        for (std::size_t i = 0; i < count; ++i) {
+            if (rows[i].pricer) {
+                tasks.push_back({rows[i].option, rows[i].pricer});
+                taskRows.push_back(i);
+            }
+        }
+        scheduler_.run(tasks, taskResults);
+        for (std::size_t k = 0; k < tasks.size(); ++k) {
+            BatchRow& row = rows[taskRows[k]];
+            row.greeks = taskResults[k].greeks;
+            row.status = taskResults[k].error;
+        }
+
+        // Formatage en parallèle
+        const long n = static_cast<long>(count);
+        #pragma omp parallel for schedule(static)
+        for (long i = 0; i < n; ++i) {
+            BatchRow& row = rows[i];
+            const bool ok = row.status.empty();
+            row.line.clear();
+            row.line += row.id;
+            row.line += ',';
+            row.line += row.model;
+            row.line += ',';
+            if (ok) {
+                appendShortest(row.line, row.greeks.price);
+            }
+            for (GreekColumn column : settings_.greeks) {
+                row.line += ',';
+                if (ok) {
+                    appendShortest(row.line, greekValue(row.greeks, column));
+                }
+            }
+            row.line += ',';
+            if (ok) {
+                row.line += "ok";
+            } else {
+                // Le message ne doit pas casser le découpage en colonnes
+                for (char c : row.status) {
+                    row.line += (c == ',' || c == '\n' || c == '\r') ? ';' : c;
+                }
+            }
+            row.line += '\n';
+        }
+
+        // Écriture dans l'ordre d'entrée, avant de lire le paquet suivant
+        for (std::size_t i = 0; i < count; ++i) {
+            output << rows[i].line;
+            if (!rows[i].status.empty()) {
+                ++summary.failed;
+            }
+        }
+        output.flush();
+    }
+
+    summary.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return summary;
+}
+
+ColumnSchema BatchPricer::resultSchema() const {
+    ColumnSchema schema{{"id", ColumnType::Int64}, {"price", ColumnType::Float64}};
+    for (GreekColumn column : settings_.greeks) {
+        schema.push_back({toString(column), ColumnType::Float64});
+    }
+    schema.push_back({"status", ColumnType::UInt8});
+    return schema;
+}
+
+BatchSummary BatchPricer::run(const ColumnarReader& input, ColumnarWriter& output) {
+    const auto start = std::chrono::steady_clock::now();
+    BatchSummary summary;
+
+    int columns[REQUIRED_COUNT];
+    for (std::size_t r = 0; r < REQUIRED_COUNT; ++r) {
+        columns[r] = input.columnIndex(REQUIRED_COLUMNS[r]);
+        const ColumnType expected = r + 1 < REQUIRED_COUNT ? ColumnType::Float64 : ColumnType::UInt8;
+        if (columns[r] < 0 || input.schema()[columns[r]].type != expected) {
+            throw std::invalid_argument(std::string("BatchPricer: missing or mistyped column '") + REQUIRED_COLUMNS[r] + "'");
+        }
+    }
+    const int idColumn = input.columnIndex("id");
+    if (idColumn >= 0 && input.schema()[idColumn].type != ColumnType::Int64) {
+        throw std::invalid_argument("BatchPricer: column 'id' must be Int64");
+    }
+    const int modelColumn = input.columnIndex("model");
+    if (modelColumn >= 0 && input.schema()[modelColumn].type != ColumnType::Text) {
+        throw std::invalid_argument("BatchPricer: column 'model' must be Text");
+    }
+
+    const ColumnSchema expected = resultSchema();
+    const ColumnSchema& actual = output.schema();
+    if (actual.size() != expected.size() ||
+        !std::equal(actual.begin(), actual.end(), expected.begin(), [](const ColumnDescriptor& a, const ColumnDescriptor& b) {
+            return a.name == b.name && a.type == b.type;
+        })) {
+        throw std::invalid_argument("BatchPricer: output schema must be resultSchema()");
+    }
+
+    std::string error;
+    const OptionPricingModel* pricer = model(settings_.defaultModel, error);
+    if (!pricer) {
+        throw std::invalid_argument("BatchPricer: " + error);
+    }
+    const bool wantGreeks = !settings_.greeks.empty();
+    std::vector<PricingTask> tasks;
+    std::vector<std::size_t> taskRows;
+    std::vector<PricingTaskResult> taskResults;
+    // Modèle de chaque chaîne de la table du bloc (nul si invalide)
+    std::vector<const OptionPricingModel*> blockModels;
+
+    const std::size_t chunk = settings_.chunkRows;
+    const std::size_t greekCount = settings_.greeks.size();
+    std::vector<std::int64_t> ids(chunk);
+    std::vector<double> prices(chunk);
+    std::vector<std::vector<double>> greekValues(greekCount, std::vector<double>(chunk));
+    std::vector<unsigned char> status(chunk);
+    std::vector<const void*> results{ids.data(), prices.data()};
+    for (const std::vector<double>& values : greekValues) {
+        results.push_back(values.data());
+    }
+    results.push_back(status.data());
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (std::size_t b = 0; b < input.blockCount(); ++b) {
+        const std::size_t rows = input.blockRows(b);
+        const double* spot = input.float64(b, columns[0]);
+        const double* strike = input.float64(b, columns[1]);
+        const double* rate = input.float64(b, columns[2]);
+        const double* volatility = input.float64(b, columns[3]);
+        const double* maturity = input.float64(b, columns[4]);
+        const unsigned char* isCall = input.uint8(b, columns[5]);
+        const std::int64_t* id = idColumn >= 0 ? input.int64(b, idColumn) : nullptr;
+        const std::uint32_t* modelCode = modelColumn >= 0 ? input.text(b, modelColumn) : nullptr;
+        if (modelCode) {
+            blockModels.clear();
+            for (std::string_view spec : input.blockStrings(b)) {
+                std::string ignored;
+                blockModels.push_back(spec.empty() ? pricer : model(std::string(spec), ignored));
+            }
+        }
+
+        for (std::size_t first = 0; first < rows; first += chunk) {
+            const std::size_t count = std::min(chunk, rows - first);
+            // Prix seul et paquet entièrement en Black-Scholes : noyau vectorisé sur les colonnes projetées
+            bool vectorized = !wantGreeks;
+            for (std::size_t i = 0; vectorized && i < (modelCode ? count : 1); ++i) {
+                const OptionPricingModel* rowModel = modelCode ? blockModels[modelCode[first + i]] : pricer;
+                vectorized = dynamic_cast<const BlackScholesModel*>(rowModel) != nullptr;
+            }
+            if (vectorized) {
+                BlackScholesModel::priceBatchSimd(count, spot + first, strike + first, rate + first,
+                                                  volatility + first, maturity + first, isCall + first, prices.data());
+            }
+
+            const long n = static_cast<long>(count);
+            const std::size_t rowBase = summary.rows;
+            tasks.clear();
+            taskRows.clear();
+            for (long i = 0; i < n; ++i) {
+                const std::size_t k = first + i;
+                ids[i] = id ? id[k] : static_cast<std::int64_t>(rowBase + i + 1);
+                const OptionPricingModel* rowModel = modelCode ? blockModels[modelCode[k]] : pricer;
+                // Mêmes règles que le constructeur d'Option ; les NaN sont rejetés
+                const bool valid = rowModel && spot[k] > 0 && strike[k] > 0 && volatility[k] > 0 && maturity[k] > 0 &&
+                                   std::isfinite(spot[k] + strike[k] + rate[k] + volatility[k] + maturity[k]) &&
+                                   isCall[k] <= 1;
+                status[i] = static_cast<unsigned char>(valid ? BatchStatus::Ok : BatchStatus::InvalidInput);
+                if (!valid) {
+                    prices[i] = nan;
+                    for (std::size_t j = 0; j < greekCount; ++j) {
+                        greekValues[j][i] = nan;
+                    }
+                } else if (!vectorized) {
+                    tasks.push_back({OptionSpec{spot[k], strike[k], rate[k], volatility[k], maturity[k],
+                                                isCall[k] ? OptionType::Call : OptionType::Put},
+                                     rowModel});
+                    taskRows.push_back(static_cast<std::size_t>(i));
+                }
+            }
+
+            scheduler_.run(tasks, taskResults);
+            for (std::size_t t = 0; t < tasks.size(); ++t) {
+                const std::size_t i = taskRows[t];
+                const Greeks& g = taskResults[t].greeks;
+                const bool ok = taskResults[t].error.empty();
+                status[i] = static_cast<unsigned char>(ok ? BatchStatus::Ok : BatchStatus::PricingError);
+                prices[i] = ok ? g.price : nan;
+                for (std::size_t j = 0; j < greekCount; ++j) {
+                    greekValues[j][i] = ok ? greekValue(g, settings_.greeks[j]) : nan;
+                }
+            }
+
+            output.append(count, results.data());
+            summary.rows += count;
+            summary.failed += count - static_cast<std::size_t>(
+                std::count(status.begin(), status.begin() + n, static_cast<unsigned char>(BatchStatus::Ok)));
+            ++summary.chunks;
+        }
+    }
+    output.flush();
+
+    summary.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return summary;
+}
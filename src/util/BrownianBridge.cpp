@@ -0,0 +1,138 @@
+#include "util/BrownianBridge.hpp"
+#include <cmath>
+#include <stdexcept>
+
+BrownianBridge::BrownianBridge(int numSteps, double maturity) {
+    if (numSteps <= 0 || maturity <= 0) {
+        throw std::invalid_argument("BrownianBridge: numSteps and maturity must be positive");
+    }
+    times_.resize(numSteps);
+    for (int i = 0; i < numSteps; ++i) {
+        times_[i] = maturity * (i + 1) / numSteps;
+    }
+    initialize();
+}
+
+BrownianBridge::BrownianBridge(const std::vector<double>& times) : times_(times) {
+    if (times_.empty() || times_[0] <= 0) {
+        throw std::invalid_argument("BrownianBridge: times must be positive");
+    }
+    for (std::size_t i = 1; i < times_.size(); ++i) {
+        if (times_[i] <= times_[i - 1]) {
+            throw std::invalid_argument("BrownianBridge: times must be increasing");
+        }
+    }
+    initialize();
+}
+
+int BrownianBridge::numSteps() const {
+    return static_cast<int>(times_.size());
+}
+
+// Ordre de construction : dernier point, puis points milieux successifs
+void BrownianBridge::initialize() {
+    const int n = numSteps();
+    bridgeIndex_.assign(n, 0);
+    leftIndex_.assign(n, 0);
+    rightIndex_.assign(n, 0);
+    leftWeight_.assign(n, 0.0);
+    rightWeight_.assign(n, 0.0);
+    stdDev_.assign(n, 0.0);
+
+    // map[i] != 0 si W(t_i) est déjà construit
+    std::vector<int> map(n, 0);
+    map[n - 1] = 1;
+    bridgeIndex_[0] = n - 1;
+    stdDev_[0] = std::sqrt(times_[n - 1]);
+
+    int j = 0;
+    for (int i = 1; i < n; ++i) {
+        // Premier point non construit, puis premier point construit qui le suit
+        while (map[j]) {
+            ++j;
+        }
+        int k = j;
+        while (!map[k]) {
+            ++k;
+        }
+        // Point milieu de l'intervalle [j, k - 1]
+        const int l = j + ((k - 1 - j) >> 1);
+        map[l] = i;
+
+        bridgeIndex_[i] = l;
+        leftIndex_[i] = j;
+        rightIndex_[i] = k;
+        const double tLeft = j > 0 ? times_[j - 1] : 0.0;
+        leftWeight_[i] = (times_[k] - times_[l]) / (times_[k] - tLeft);
+        rightWeight_[i] = (times_[l] - tLeft) / (times_[k] - tLeft);
+        stdDev_[i] = std::sqrt((times_[l] - tLeft) * (times_[k] - times_[l]) / (times_[k] - tLeft));
+
+        j = k + 1;
+        if (j >= n) {
+            j = 0;
+        }
+    }
+}
+
+void BrownianBridge::buildPath(const double* z, double* w) const {
+    const int n = numSteps();
+    w[n - 1] = stdDev_[0] * z[0];
+    for (int i = 1; i < n; ++i) {
+        const int j = leftIndex_[i];
+        const int k = rightIndex_[i];
+        const int l = bridgeIndex_[i];
+        const double left = j > 0 ? w[j - 1] : 0.0;
+        w[l] = leftWeight_[i] * left + rightWeight_[i] * w[k] + stdDev_[i] * z[i];
+    }
+}
+
+void BrownianBridge::buildIncrements(const double* z, double* dw) const {
+    buildPath(z, dw);
+    for (int i = numSteps() - 1; i > 0; --i) {
+        dw[i] -= dw[i - 1];
+    }
+}
+
+void BrownianBridge::buildIncrements(const double* z, double* dw, std::size_t count) const {
+    const int n = numSteps();
+    const long m = static_cast<long>(count);
+
+    // W(t_i) construits ligne par ligne dans dw
+    double* last = dw + static_cast<std::size_t>(n - 1) * count;
+    const double terminal = stdDev_[0];
+    #pragma omp simd
+    for (long p = 0; p < m; ++p) {
+        last[p] = terminal * z[p];
+    }
+    for (int i = 1; i < n; ++i) {
+        const int j = leftIndex_[i];
+        double* target = dw + static_cast<std::size_t>(bridgeIndex_[i]) * count;
+        const double* right = dw + static_cast<std::size_t>(rightIndex_[i]) * count;
+        const double* zi = z + static_cast<std::size_t>(i) * count;
+        const double wl = leftWeight_[i];
+        const double wr = rightWeight_[i];
+        const double sd = stdDev_[i];
+        if (j > 0) {
+            const double* left = dw + static_cast<std::size_t>(j - 1) * count;
+            #pragma omp simd
+            for (long p = 0; p < m; ++p) {
+                target[p] = wl * left[p] + wr * right[p] + sd * zi[p];
+            }
+        } else {
+            #pragma omp simd
+            for (long p = 0; p < m; ++p) {
+                target[p] = wr * right[p] + sd * zi[p];
+            }
+        }
+    }
+
+    // Accroissements, de la dernière date vers la première
+    for (int i = n - 1; i > 0; --i) {
+        double* current = dw + static_cast<std::size_t>(i) * count;
+        const double* previous = current - count;
+        #pragma omp simd
+        for (long p = 0; p < m; ++p) {
+            current[p] -= previous[p];
+        }
+    }
+}
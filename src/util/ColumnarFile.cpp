@@ -0,0 +1,637 @@
+#include "util/ColumnarFile.hpp"
+#include "domain/OptionSpec.hpp"
+#include "util/CsvFormat.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+const char MAGIC[8] = {'O', 'P', 'C', 'B', '\r', '\n', '\x1a', '\n'};
+constexpr std::uint32_t VERSION = 2;        // Colonnes Text et tables de chaînes
+constexpr std::uint32_t FIRST_VERSION = 1;  // Sans colonne Text : encore écrite, lisible par les anciens lecteurs
+constexpr std::uint32_t ENDIAN_TAG = 0x01020304;
+constexpr std::size_t ALIGNMENT = 64;
+constexpr std::size_t MAX_COLUMNS = 1024;
+
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t endianTag;     // Relu différemment sur une machine big-endian
+    std::uint32_t columnCount;
+    std::uint32_t headerBytes;   // En-tête et schéma, alignés
+    std::uint64_t rows;          // Lignes des blocs validés
+    std::uint64_t blocks;
+    std::uint64_t dataEnd;       // Fin du dernier bloc validé
+    unsigned char reserved[16];
+};
+
+struct SchemaEntry {
+    char name[31];               // Terminé par '\0'
+    std::uint8_t type;
+};
+
+struct BlockHeader {
+    std::uint64_t rows;
+    std::uint64_t bytes;         // En-tête de bloc et table de chaînes compris
+    std::uint64_t stringBytes;   // Table de chaînes des colonnes Text, 0 sans chaîne
+    unsigned char reserved[40];
+};
+
+static_assert(sizeof(FileHeader) == 64 && sizeof(SchemaEntry) == 32 && sizeof(BlockHeader) == 64,
+              "Le format fixe la taille des en-têtes");
+
+std::size_t aligned(std::size_t bytes) {
+    return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+}
+
+std::size_t headerBytes(std::size_t columns) {
+    return aligned(sizeof(FileHeader) + columns * sizeof(SchemaEntry));
+}
+
+std::size_t blockBytes(std::size_t rows, const ColumnSchema& schema) {
+    std::size_t bytes = sizeof(BlockHeader);
+    for (const ColumnDescriptor& column : schema) {
+        bytes += aligned(rows * columnWidth(column.type));
+    }
+    return bytes;
+}
+
+bool validType(std::uint8_t type, std::uint32_t version) {
+    const ColumnType last = version >= VERSION ? ColumnType::Text : ColumnType::UInt8;
+    return type >= static_cast<std::uint8_t>(ColumnType::Float64) && type <= static_cast<std::uint8_t>(last);
+}
+
+// Largeur d'une valeur dans les colonnes passées à ColumnarWriter::append
+std::size_t inputWidth(ColumnType type) {
+    return type == ColumnType::Text ? sizeof(std::string) : columnWidth(type);
+}
+
+// Valide l'en-tête et le schéma contenus dans les 'size' premiers octets du fichier
+FileHeader parseHeader(const unsigned char* data, std::size_t size, ColumnSchema& schema) {
+    FileHeader header;
+    if (size < sizeof(header)) {
+        throw std::runtime_error("ColumnarFile: file too short for a header");
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("ColumnarFile: not a columnar option file");
+    }
+    if (header.endianTag != ENDIAN_TAG) {
+        throw std::runtime_error("ColumnarFile: byte order differs from this machine");
+    }
+    if (header.version < FIRST_VERSION || header.version > VERSION) {
+        throw std::runtime_error("ColumnarFile: unsupported version " + std::to_string(header.version));
+    }
+    if (header.columnCount == 0 || header.columnCount > MAX_COLUMNS ||
+        header.headerBytes != headerBytes(header.columnCount) || header.headerBytes > size) {
+        throw std::runtime_error("ColumnarFile: corrupted schema");
+    }
+
+    schema.clear();
+    for (std::uint32_t c = 0; c < header.columnCount; ++c) {
+        SchemaEntry entry;
+        std::memcpy(&entry, data + sizeof(header) + c * sizeof(entry), sizeof(entry));
+        if (!validType(entry.type, header.version) || std::memchr(entry.name, '\0', sizeof(entry.name)) == nullptr) {
+            throw std::runtime_error("ColumnarFile: corrupted schema");
+        }
+        schema.push_back({entry.name, static_cast<ColumnType>(entry.type)});
+    }
+    return header;
+}
+
+} // namespace
+
+std::size_t columnWidth(ColumnType type) {
+    switch (type) {
+        case ColumnType::Float64: return sizeof(double);
+        case ColumnType::Int64:   return sizeof(std::int64_t);
+        case ColumnType::UInt8:   return 1;
+        case ColumnType::Text:    return sizeof(std::uint32_t);
+    }
+    throw std::invalid_argument("Unknown column type");
+}
+
+// ------------------------------------------
+// ColumnarReader
+// ------------------------------------------
+ColumnarReader::ColumnarReader(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Could not open file: " + path);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        ::close(fd);
+        throw std::runtime_error("ColumnarFile: file too short for a header: " + path);
+    }
+    size_ = static_cast<std::size_t>(info.st_size);
+    void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        throw std::runtime_error("Could not map file: " + path);
+    }
+    data_ = static_cast<const unsigned char*>(mapped);
+    // Les blocs sont lus une fois, du début à la fin
+    ::madvise(mapped, size_, MADV_SEQUENTIAL);
+
+    try {
+        const FileHeader header = parseHeader(data_, size_, schema_);
+        if (header.dataEnd > size_) {
+            throw std::runtime_error("ColumnarFile: truncated file");
+        }
+        std::size_t offset = header.headerBytes;
+        for (std::uint64_t b = 0; b < header.blocks; ++b) {
+            BlockHeader block;
+            if (offset + sizeof(block) > header.dataEnd) {
+                throw std::runtime_error("ColumnarFile: truncated block");
+            }
+            std::memcpy(&block, data_ + offset, sizeof(block));
+            const std::size_t columnBytes = blockBytes(block.rows, schema_);
+            if (block.stringBytes > header.dataEnd || block.bytes != columnBytes + aligned(block.stringBytes) ||
+                offset + block.bytes > header.dataEnd) {
+                throw std::runtime_error("ColumnarFile: corrupted block");
+            }
+            blockOffsets_.push_back(offset);
+            blockRows_.push_back(block.rows);
+
+            // Table de chaînes, puis codes des colonnes Text vérifiés une fois pour toutes
+            std::vector<std::string_view> strings;
+            const unsigned char* cursor = data_ + offset + columnBytes;
+            const unsigned char* end = cursor + block.stringBytes;
+            while (cursor < end) {
+                std::uint32_t length;
+                if (static_cast<std::size_t>(end - cursor) < sizeof(length)) {
+                    throw std::runtime_error("ColumnarFile: corrupted string table");
+                }
+                std::memcpy(&length, cursor, sizeof(length));
+                cursor += sizeof(length);
+                if (static_cast<std::size_t>(end - cursor) < length) {
+                    throw std::runtime_error("ColumnarFile: corrupted string table");
+                }
+                strings.emplace_back(reinterpret_cast<const char*>(cursor), length);
+                cursor += length;
+            }
+            blockStrings_.push_back(std::move(strings));
+            for (std::size_t c = 0; c < schema_.size(); ++c) {
+                if (schema_[c].type == ColumnType::Text) {
+                    const std::uint32_t* codes = text(blockRows_.size() - 1, static_cast<int>(c));
+                    for (std::size_t i = 0; i < block.rows; ++i) {
+                        if (codes[i] >= blockStrings_.back().size()) {
+                            throw std::runtime_error("ColumnarFile: text code out of range");
+                        }
+                    }
+                }
+            }
+            rows_ += block.rows;
+            offset += block.bytes;
+        }
+        if (offset != header.dataEnd || rows_ != header.rows) {
+            throw std::runtime_error("ColumnarFile: header does not match its blocks");
+        }
+    } catch (...) {
+        ::munmap(mapped, size_);
+        throw;
+    }
+}
+
+ColumnarReader::~ColumnarReader() {
+    ::munmap(const_cast<unsigned char*>(data_), size_);
+}
+
+bool ColumnarReader::isColumnarFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    char magic[sizeof(MAGIC)];
+    return file.read(magic, sizeof(magic)) && std::memcmp(magic, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+const ColumnSchema& ColumnarReader::schema() const {
+    return schema_;
+}
+
+int ColumnarReader::columnIndex(const std::string& name) const {
+    for (std::size_t c = 0; c < schema_.size(); ++c) {
+        if (schema_[c].name == name) {
+            return static_cast<int>(c);
+        }
+    }
+    return -1;
+}
+
+std::size_t ColumnarReader::rows() const {
+    return rows_;
+}
+
+std::size_t ColumnarReader::blockCount() const {
+    return blockRows_.size();
+}
+
+std::size_t ColumnarReader::blockRows(std::size_t block) const {
+    return blockRows_.at(block);
+}
+
+const unsigned char* ColumnarReader::column(std::size_t block, int column, ColumnType expected) const {
+    if (block >= blockRows_.size() || column < 0 || column >= static_cast<int>(schema_.size())) {
+        throw std::out_of_range("ColumnarReader: block or column out of range");
+    }
+    if (schema_[column].type != expected) {
+        throw std::logic_error("ColumnarReader: column '" + schema_[column].name + "' has another type");
+    }
+    const std::size_t rows = blockRows_[block];
+    std::size_t offset = blockOffsets_[block] + sizeof(BlockHeader);
+    for (int c = 0; c < column; ++c) {
+        offset += aligned(rows * columnWidth(schema_[c].type));
+    }
+    return data_ + offset;
+}
+
+const double* ColumnarReader::float64(std::size_t block, int column) const {
+    return reinterpret_cast<const double*>(this->column(block, column, ColumnType::Float64));
+}
+
+const std::int64_t* ColumnarReader::int64(std::size_t block, int column) const {
+    return reinterpret_cast<const std::int64_t*>(this->column(block, column, ColumnType::Int64));
+}
+
+const unsigned char* ColumnarReader::uint8(std::size_t block, int column) const {
+    return this->column(block, column, ColumnType::UInt8);
+}
+
+const std::uint32_t* ColumnarReader::text(std::size_t block, int column) const {
+    return reinterpret_cast<const std::uint32_t*>(this->column(block, column, ColumnType::Text));
+}
+
+const std::vector<std::string_view>& ColumnarReader::blockStrings(std::size_t block) const {
+    return blockStrings_.at(block);
+}
+
+// ------------------------------------------
+// ColumnarWriter
+// ------------------------------------------
+ColumnarWriter::ColumnarWriter(const std::string& path, ColumnSchema schema, WriteMode mode, std::size_t blockRows)
+    : schema_(std::move(schema)), blockRows_(blockRows) {
+    if (schema_.empty() || schema_.size() > MAX_COLUMNS || blockRows_ == 0) {
+        throw std::invalid_argument("ColumnarWriter: schema must have 1 to 1024 columns and blockRows must be positive");
+    }
+    for (const ColumnDescriptor& column : schema_) {
+        if (column.name.empty() || column.name.size() >= sizeof(SchemaEntry::name)) {
+            throw std::invalid_argument("ColumnarWriter: column names must have 1 to 30 characters");
+        }
+        columnWidth(column.type);
+        hasText_ = hasText_ || column.type == ColumnType::Text;
+    }
+
+    std::error_code error;
+    const bool existing = mode == WriteMode::Append && std::filesystem::file_size(path, error) > 0 && !error;
+    if (existing) {
+        // Reprise après le dernier bloc validé, un bloc interrompu est écarté
+        std::vector<unsigned char> head(headerBytes(MAX_COLUMNS));
+        {
+            std::ifstream in(path, std::ios::binary);
+            in.read(reinterpret_cast<char*>(head.data()), static_cast<std::streamsize>(head.size()));
+            head.resize(static_cast<std::size_t>(in.gcount()));
+        }
+        ColumnSchema stored;
+        const FileHeader header = parseHeader(head.data(), head.size(), stored);
+        const bool sameSchema = stored.size() == schema_.size() &&
+            std::equal(stored.begin(), stored.end(), schema_.begin(), [](const ColumnDescriptor& a, const ColumnDescriptor& b) {
+                return a.name == b.name && a.type == b.type;
+            });
+        if (!sameSchema) {
+            throw std::invalid_argument("ColumnarWriter: cannot append, schema differs from " + path);
+        }
+        rows_ = header.rows;
+        blocks_ = header.blocks;
+        dataEnd_ = header.dataEnd;
+        std::filesystem::resize_file(path, dataEnd_);
+        file_.open(path, std::ios::in | std::ios::out | std::ios::binary);
+    } else {
+        file_.open(path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+        dataEnd_ = headerBytes(schema_.size());
+    }
+    if (!file_.is_open()) {
+        throw std::runtime_error("Could not open file: " + path);
+    }
+
+    if (!existing) {
+        writeHeader();
+        file_.seekp(sizeof(FileHeader));
+        std::vector<char> entries(dataEnd_ - sizeof(FileHeader), '\0');
+        for (std::size_t c = 0; c < schema_.size(); ++c) {
+            SchemaEntry entry{};
+            std::memcpy(entry.name, schema_[c].name.data(), schema_[c].name.size());
+            entry.type = static_cast<std::uint8_t>(schema_[c].type);
+            std::memcpy(entries.data() + c * sizeof(entry), &entry, sizeof(entry));
+        }
+        file_.write(entries.data(), static_cast<std::streamsize>(entries.size()));
+    }
+    file_.seekp(static_cast<std::streamoff>(dataEnd_));
+
+    pending_.resize(schema_.size());
+    for (std::size_t c = 0; c < schema_.size(); ++c) {
+        pending_[c].resize(blockRows_ * columnWidth(schema_[c].type));
+    }
+}
+
+ColumnarWriter::~ColumnarWriter() {
+    try {
+        close();
+    } catch (...) {
+        // Un destructeur ne lance pas : appeler close() pour être averti d'une erreur
+    }
+}
+
+void ColumnarWriter::append(std::size_t rows, const void* const* columns) {
+    std::vector<const void*> cursor(columns, columns + schema_.size());
+    auto advance = [&](std::size_t count) {
+        for (std::size_t c = 0; c < schema_.size(); ++c) {
+            cursor[c] = static_cast<const unsigned char*>(cursor[c]) + count * inputWidth(schema_[c].type);
+        }
+    };
+
+    while (rows > 0) {
+        // Les chaînes sont codées dans la table du bloc : pas d'écriture directe
+        if (pendingRows_ == 0 && rows >= blockRows_ && !hasText_) {
+            writeBlock(blockRows_, cursor.data());
+            advance(blockRows_);
+            rows -= blockRows_;
+            continue;
+        }
+        const std::size_t take = std::min(blockRows_ - pendingRows_, rows);
+        for (std::size_t c = 0; c < schema_.size(); ++c) {
+            const std::size_t width = columnWidth(schema_[c].type);
+            if (schema_[c].type == ColumnType::Text) {
+                const std::string* values = static_cast<const std::string*>(cursor[c]);
+                for (std::size_t i = 0; i < take; ++i) {
+                    const std::uint32_t code = textCode(values[i]);
+                    std::memcpy(pending_[c].data() + (pendingRows_ + i) * width, &code, width);
+                }
+            } else {
+                std::memcpy(pending_[c].data() + pendingRows_ * width, cursor[c], take * width);
+            }
+        }
+        pendingRows_ += take;
+        advance(take);
+        rows -= take;
+        if (pendingRows_ == blockRows_) {
+            flush();
+        }
+    }
+}
+
+void ColumnarWriter::flush() {
+    if (!file_.is_open()) {
+        return;
+    }
+    if (pendingRows_ > 0) {
+        std::vector<const void*> columns(schema_.size());
+        for (std::size_t c = 0; c < schema_.size(); ++c) {
+            columns[c] = pending_[c].data();
+        }
+        writeBlock(pendingRows_, columns.data());
+        pendingRows_ = 0;
+    }
+    file_.flush();
+}
+
+void ColumnarWriter::close() {
+    if (file_.is_open()) {
+        flush();
+        file_.close();
+    }
+}
+
+const ColumnSchema& ColumnarWriter::schema() const {
+    return schema_;
+}
+
+std::size_t ColumnarWriter::rows() const {
+    return static_cast<std::size_t>(rows_) + pendingRows_;
+}
+
+std::uint32_t ColumnarWriter::textCode(const std::string& value) {
+    const auto found = pendingCodes_.find(value);
+    if (found != pendingCodes_.end()) {
+        return found->second;
+    }
+    if (value.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::invalid_argument("ColumnarWriter: string too long");
+    }
+    const std::uint32_t code = static_cast<std::uint32_t>(pendingStrings_.size());
+    pendingStrings_.push_back(value);
+    pendingCodes_.emplace(value, code);
+    return code;
+}
+
+void ColumnarWriter::writeBlock(std::size_t rows, const void* const* columns) {
+    std::string strings;
+    for (const std::string& value : pendingStrings_) {
+        const std::uint32_t length = static_cast<std::uint32_t>(value.size());
+        strings.append(reinterpret_cast<const char*>(&length), sizeof(length));
+        strings += value;
+    }
+
+    BlockHeader block{};
+    block.rows = rows;
+    block.stringBytes = strings.size();
+    block.bytes = blockBytes(rows, schema_) + aligned(strings.size());
+    file_.write(reinterpret_cast<const char*>(&block), sizeof(block));
+
+    static const char padding[ALIGNMENT] = {};
+    for (std::size_t c = 0; c < schema_.size(); ++c) {
+        const std::size_t bytes = rows * columnWidth(schema_[c].type);
+        file_.write(static_cast<const char*>(columns[c]), static_cast<std::streamsize>(bytes));
+        file_.write(padding, static_cast<std::streamsize>(aligned(bytes) - bytes));
+    }
+    file_.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+    file_.write(padding, static_cast<std::streamsize>(aligned(strings.size()) - strings.size()));
+    pendingStrings_.clear();
+    pendingCodes_.clear();
+
+    // Le bloc n'est validé qu'une fois entièrement écrit
+    rows_ += rows;
+    blocks_ += 1;
+    dataEnd_ += block.bytes;
+    writeHeader();
+    if (!file_) {
+        throw std::runtime_error("ColumnarWriter: write failed");
+    }
+}
+
+void ColumnarWriter::writeHeader() {
+    FileHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = hasText_ ? VERSION : FIRST_VERSION;
+    header.endianTag = ENDIAN_TAG;
+    header.columnCount = static_cast<std::uint32_t>(schema_.size());
+    header.headerBytes = static_cast<std::uint32_t>(headerBytes(schema_.size()));
+    header.rows = rows_;
+    header.blocks = blocks_;
+    header.dataEnd = dataEnd_;
+    file_.seekp(0);
+    file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file_.seekp(static_cast<std::streamoff>(dataEnd_));
+}
+
+// ------------------------------------------
+// Conversions CSV
+// ------------------------------------------
+std::size_t convertCsvToColumnar(std::istream& csv, const std::string& path, std::size_t blockRows) {
+    std::string line;
+    if (!std::getline(csv, line)) {
+        throw std::invalid_argument("convertCsvToColumnar: empty input, a header line is required");
+    }
+    std::vector<std::string_view> fields;
+    splitCsvLine(line, fields);
+    ColumnSchema schema;
+    std::vector<std::size_t> source;  // Colonne CSV de chaque colonne binaire
+    for (std::size_t f = 0; f < fields.size(); ++f) {
+        const std::string_view name = fields[f];
+        source.push_back(f);
+        const ColumnType type = name == "type" ? ColumnType::UInt8 : name == "id" ? ColumnType::Int64
+                              : name == "model" ? ColumnType::Text : ColumnType::Float64;
+        schema.push_back({std::string(name), type});
+    }
+
+    const std::size_t headerFields = fields.size();
+
+    ColumnarWriter writer(path, schema, WriteMode::Truncate, blockRows);
+    std::vector<std::vector<unsigned char>> buffers(schema.size());
+    std::vector<std::vector<std::string>> texts(schema.size());
+    std::vector<const void*> columns(schema.size());
+    for (std::size_t c = 0; c < schema.size(); ++c) {
+        if (schema[c].type == ColumnType::Text) {
+            texts[c].resize(blockRows);
+            columns[c] = texts[c].data();
+        } else {
+            buffers[c].resize(blockRows * columnWidth(schema[c].type));
+            columns[c] = buffers[c].data();
+        }
+    }
+
+    std::size_t total = 0;
+    std::size_t count = 0;
+    std::size_t lineNumber = 1;
+    while (std::getline(csv, line)) {
+        ++lineNumber;
+        if (trimCsvField(line).empty()) {
+            continue;
+        }
+        splitCsvLine(line, fields);
+        if (fields.size() != headerFields) {
+            throw std::invalid_argument("convertCsvToColumnar: line " + std::to_string(lineNumber) + " has " +
+                                        std::to_string(fields.size()) + " fields, expected " +
+                                        std::to_string(headerFields));
+        }
+        try {
+            for (std::size_t c = 0; c < schema.size(); ++c) {
+                const std::string_view field = fields[source[c]];
+                if (schema[c].type == ColumnType::Text) {
+                    texts[c][count].assign(field.data(), field.size());
+                    continue;
+                }
+                unsigned char* cell = buffers[c].data() + count * columnWidth(schema[c].type);
+                if (schema[c].type == ColumnType::UInt8) {
+                    *cell = parseOptionType(std::string(field)) == OptionType::Call ? 1 : 0;
+                } else if (schema[c].type == ColumnType::Int64) {
+                    std::int64_t id = 0;
+                    const auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), id);
+                    if (field.empty() || error != std::errc() || end != field.data() + field.size()) {
+                        throw std::invalid_argument("invalid id '" + std::string(field) + "'");
+                    }
+                    std::memcpy(cell, &id, sizeof(id));
+                } else {
+                    const double value = parseCsvNumber(field, schema[c].name.c_str());
+                    std::memcpy(cell, &value, sizeof(value));
+                }
+            }
+        } catch (const std::invalid_argument& e) {
+            throw std::invalid_argument("convertCsvToColumnar: line " + std::to_string(lineNumber) + ": " + e.what());
+        }
+        if (++count == blockRows) {
+            writer.append(count, columns.data());
+            total += count;
+            count = 0;
+        }
+    }
+    writer.append(count, columns.data());
+    writer.close();
+    return total + count;
+}
+
+std::size_t convertColumnarToCsv(const std::string& path, std::ostream& csv) {
+    const ColumnarReader reader(path);
+    const ColumnSchema& schema = reader.schema();
+
+    std::string text;
+    for (std::size_t c = 0; c < schema.size(); ++c) {
+        text += c == 0 ? "" : ",";
+        text += schema[c].name;
+    }
+    text += '\n';
+
+    std::vector<const unsigned char*> columns(schema.size());
+    for (std::size_t b = 0; b < reader.blockCount(); ++b) {
+        for (std::size_t c = 0; c < schema.size(); ++c) {
+            const int index = static_cast<int>(c);
+            switch (schema[c].type) {
+                case ColumnType::Float64: columns[c] = reinterpret_cast<const unsigned char*>(reader.float64(b, index)); break;
+                case ColumnType::Int64:   columns[c] = reinterpret_cast<const unsigned char*>(reader.int64(b, index)); break;
+                case ColumnType::UInt8:   columns[c] = reader.uint8(b, index); break;
+                case ColumnType::Text:    columns[c] = reinterpret_cast<const unsigned char*>(reader.text(b, index)); break;
+            }
+        }
+        for (std::size_t i = 0; i < reader.blockRows(b); ++i) {
+            for (std::size_t c = 0; c < schema.size(); ++c) {
+                if (c > 0) {
+                    text += ',';
+                }
+                char buffer[24];
+                switch (schema[c].type) {
+                    case ColumnType::Float64: {
+                        double value;
+                        std::memcpy(&value, columns[c] + i * sizeof(double), sizeof(value));
+                        appendShortest(text, value);
+                        break;
+                    }
+                    case ColumnType::Int64: {
+                        std::int64_t value;
+                        std::memcpy(&value, columns[c] + i * sizeof(value), sizeof(value));
+                        text.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+                        break;
+                    }
+                    case ColumnType::UInt8: {
+                        const unsigned value = columns[c][i];
+                        if (schema[c].name == "type" && value <= 1) {
+                            text += toString(value == 1 ? OptionType::Call : OptionType::Put);
+                        } else {
+                            text.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+                        }
+                        break;
+                    }
+                    case ColumnType::Text: {
+                        std::uint32_t code;
+                        std::memcpy(&code, columns[c] + i * sizeof(code), sizeof(code));
+                        text += reader.blockStrings(b)[code];
+                        break;
+                    }
+                }
+            }
+            text += '\n';
+        }
+        // Écriture bloc par bloc : mémoire bornée par la taille d'un bloc
+        csv << text;
+        text.clear();
+    }
+    csv << text;
+    return reader.rows();
+}
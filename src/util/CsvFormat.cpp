@@ -0,0 +1,40 @@
+#include "util/CsvFormat.hpp"
+#include <charconv>
+#include <stdexcept>
+
+std::string_view trimCsvField(std::string_view text) {
+    const auto first = text.find_first_not_of(" \t\r");
+    if (first == std::string_view::npos) {
+        return {};
+    }
+    return text.substr(first, text.find_last_not_of(" \t\r") - first + 1);
+}
+
+void splitCsvLine(std::string_view line, std::vector<std::string_view>& fields) {
+    fields.clear();
+    std::size_t start = 0;
+    while (true) {
+        const std::size_t comma = line.find(',', start);
+        fields.push_back(trimCsvField(line.substr(start, comma == std::string_view::npos ? std::string_view::npos
+                                                                                          : comma - start)));
+        if (comma == std::string_view::npos) {
+            return;
+        }
+        start = comma + 1;
+    }
+}
+
+double parseCsvNumber(std::string_view text, const char* what) {
+    double value = 0.0;
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (text.empty() || error != std::errc() || end != text.data() + text.size()) {
+        throw std::invalid_argument(std::string("invalid ") + what + " '" + std::string(text) + "'");
+    }
+    return value;
+}
+
+void appendShortest(std::string& out, double value) {
+    char buffer[32];
+    const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+}
@@ -0,0 +1,89 @@
+#include "util/CubicSpline.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+CubicSpline::CubicSpline(const std::vector<double>& x, const std::vector<double>& y) {
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("CubicSpline: x and y must have the same size");
+    }
+    fit(x.data(), y.data(), static_cast<int>(x.size()));
+}
+
+void CubicSpline::fit(const double* x, const double* y, int n) {
+    if (n < 2) {
+        throw std::invalid_argument("CubicSpline: at least two nodes are required");
+    }
+    for (int i = 1; i < n; ++i) {
+        if (x[i] <= x[i - 1]) {
+            throw std::invalid_argument("CubicSpline: nodes must be increasing");
+        }
+    }
+    x_.assign(x, x + n);
+    y_.assign(y, y + n);
+    m_.assign(n, 0.0);
+    if (n == 2) {
+        return;
+    }
+
+    // h_{i-1} m_{i-1} + 2 (h_{i-1} + h_i) m_i + h_i m_{i+1} = 6 (pente_i - pente_{i-1}), i = 1..n-2
+    const int interior = n - 2;
+    lower_.resize(interior);
+    diagonal_.resize(interior);
+    upper_.resize(interior);
+    for (int k = 0; k < interior; ++k) {
+        const int i = k + 1;
+        const double hLeft = x_[i] - x_[i - 1];
+        const double hRight = x_[i + 1] - x_[i];
+        lower_[k] = hLeft;
+        diagonal_[k] = 2.0 * (hLeft + hRight);
+        upper_[k] = hRight;
+        m_[i] = 6.0 * ((y_[i + 1] - y_[i]) / hRight - (y_[i] - y_[i - 1]) / hLeft);
+    }
+    solver_.factorize(lower_.data(), diagonal_.data(), upper_.data(), interior);
+    solver_.solve(m_.data() + 1);
+}
+
+int CubicSpline::interval(double x) const {
+    const auto it = std::upper_bound(x_.begin(), x_.end(), x);
+    const int i = static_cast<int>(it - x_.begin()) - 1;
+    return std::clamp(i, 0, static_cast<int>(x_.size()) - 2);
+}
+
+void CubicSpline::evaluate(double x, double& value, double& first, double& second) const {
+    const int i = interval(x);
+    const double h = x_[i + 1] - x_[i];
+    const double a = x_[i + 1] - x;   // Distance au noeud de droite
+    const double b = x - x_[i];       // Distance au noeud de gauche
+    const double left = y_[i] / h - m_[i] * h / 6.0;
+    const double right = y_[i + 1] / h - m_[i + 1] * h / 6.0;
+
+    value = (m_[i] * a * a * a + m_[i + 1] * b * b * b) / (6.0 * h) + left * a + right * b;
+    first = (m_[i + 1] * b * b - m_[i] * a * a) / (2.0 * h) + right - left;
+    second = (m_[i] * a + m_[i + 1] * b) / h;
+}
+
+double CubicSpline::value(double x) const {
+    double v, d1, d2;
+    evaluate(x, v, d1, d2);
+    return v;
+}
+
+double CubicSpline::derivative(double x) const {
+    double v, d1, d2;
+    evaluate(x, v, d1, d2);
+    return d1;
+}
+
+double CubicSpline::secondDerivative(double x) const {
+    double v, d1, d2;
+    evaluate(x, v, d1, d2);
+    return d2;
+}
+
+double CubicSpline::minX() const {
+    return x_.front();
+}
+
+double CubicSpline::maxX() const {
+    return x_.back();
+}
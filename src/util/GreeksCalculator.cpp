@@ -1,4 +1,5 @@
 #include "util/GreeksCalculator.hpp"
+#include "models/CachedPricingModel.hpp"
 #include <iostream>
 #include <cmath>
 
@@ -6,20 +7,9 @@
  * @brief Calcule la Delta par différences finies centrées.
  */
 template<typename Model>
-double GreeksCalculator::calculateDelta(const Model& model, const Option& option, double deltaS) {
-    Option optionUp  (option.getSpotPrice() + deltaS,
-                      option.getStrikePrice(),
-                      option.getRiskFreeRate(),
-                      option.getVolatility(),
-                      option.getTimeToMaturity(),
-                      option.getType());
-
-    Option optionDown(option.getSpotPrice() - deltaS,
-                      option.getStrikePrice(),
-                      option.getRiskFreeRate(),
-                      option.getVolatility(),
-                      option.getTimeToMaturity(),
-                      option.getType());
+double GreeksCalculator::calculateDelta(const Model& model, const OptionSpec& option, double deltaS) {
+    const OptionSpec optionUp   = option.withSpot(option.spot + deltaS);
+    const OptionSpec optionDown = option.withSpot(option.spot - deltaS);
     
     double priceUp   = model.calculatePrice(optionUp);
     double priceDown = model.calculatePrice(optionDown);
@@ -31,20 +21,9 @@ double GreeksCalculator::calculateDelta(const Model& model, const Option& option
  * @brief Calcule la Gamma par différences finies centrées.
  */
 template<typename Model>
-double GreeksCalculator::calculateGamma(const Model& model, const Option& option, double deltaS) {
-    Option optionUp  (option.getSpotPrice() + deltaS,
-                      option.getStrikePrice(),
-                      option.getRiskFreeRate(),
-                      option.getVolatility(),
-                      option.getTimeToMaturity(),
-                      option.getType());
-
-    Option optionDown(option.getSpotPrice() - deltaS,
-                      option.getStrikePrice(),
-                      option.getRiskFreeRate(),
-                      option.getVolatility(),
-                      option.getTimeToMaturity(),
-                      option.getType());
+double GreeksCalculator::calculateGamma(const Model& model, const OptionSpec& option, double deltaS) {
+    const OptionSpec optionUp   = option.withSpot(option.spot + deltaS);
+    const OptionSpec optionDown = option.withSpot(option.spot - deltaS);
 
     double priceUp     = model.calculatePrice(optionUp);
     double priceCenter = model.calculatePrice(option);
@@ -57,20 +36,9 @@ double GreeksCalculator::calculateGamma(const Model& model, const Option& option
  * @brief Calcule la Vega par différences finies sur la volatilité.
  */
 template<typename Model>
-double GreeksCalculator::calculateVega(const Model& model, const Option& option, double deltaSigma) {
-    Option optionUp  (option.getSpotPrice(),
-                      option.getStrikePrice(),
-                      option.getRiskFreeRate(),
-                      option.getVolatility() + deltaSigma,
-                      option.getTimeToMaturity(),
-                      option.getType());
-
-    Option optionDown(option.getSpotPrice(),
-                      option.getStrikePrice(),
-                      option.getRiskFreeRate(),
-                      option.getVolatility() - deltaSigma,
-                      option.getTimeToMaturity(),
-                      option.getType());
+double GreeksCalculator::calculateVega(const Model& model, const OptionSpec& option, double deltaSigma) {
+    const OptionSpec optionUp   = option.withVol(option.volatility + deltaSigma);
+    const OptionSpec optionDown = option.withVol(option.volatility - deltaSigma);
     
     double priceUp   = model.calculatePrice(optionUp);
     double priceDown = model.calculatePrice(optionDown);
@@ -83,17 +51,12 @@ double GreeksCalculator::calculateVega(const Model& model, const Option& option,
  *        Convention : Theta = - (P(T-Δt) - P(T)) / Δt
  */
 template<typename Model>
-double GreeksCalculator::calculateTheta(const Model& model, const Option& option, double deltaT) {
-    if (option.getTimeToMaturity() <= deltaT) {
+double GreeksCalculator::calculateTheta(const Model& model, const OptionSpec& option, double deltaT) {
+    if (option.maturity <= deltaT) {
         return 0.0;
     }
     
-    Option optionNext(option.getSpotPrice(),
-                      option.getStrikePrice(),
-                      option.getRiskFreeRate(),
-                      option.getVolatility(),
-                      option.getTimeToMaturity() - deltaT,
-                      option.getType());
+    const OptionSpec optionNext = option.withMaturity(option.maturity - deltaT);
     
     double priceNext   = model.calculatePrice(optionNext);
     double priceCenter = model.calculatePrice(option);
@@ -105,20 +68,9 @@ double GreeksCalculator::calculateTheta(const Model& model, const Option& option
  * @brief Calcule la Rho par différences finies sur le taux d'intérêt.
  */
 template<typename Model>
-double GreeksCalculator::calculateRho(const Model& model, const Option& option, double deltaR) {
-    Option optionUp  (option.getSpotPrice(),
-                      option.getStrikePrice(),
-                      option.getRiskFreeRate() + deltaR,
-                      option.getVolatility(),
-                      option.getTimeToMaturity(),
-                      option.getType());
-
-    Option optionDown(option.getSpotPrice(),
-                      option.getStrikePrice(),
-                      option.getRiskFreeRate() - deltaR,
-                      option.getVolatility(),
-                      option.getTimeToMaturity(),
-                      option.getType());
+double GreeksCalculator::calculateRho(const Model& model, const OptionSpec& option, double deltaR) {
+    const OptionSpec optionUp   = option.withRate(option.rate + deltaR);
+    const OptionSpec optionDown = option.withRate(option.rate - deltaR);
     
     double priceUp   = model.calculatePrice(optionUp);
     double priceDown = model.calculatePrice(optionDown);
@@ -130,128 +82,207 @@ double GreeksCalculator::calculateRho(const Model& model, const Option& option,
 // Instanciations explicites (BlackScholesModel)
 // ------------------------------------------
 template double GreeksCalculator::calculateDelta<BlackScholesModel>(
-    const BlackScholesModel&, const Option&, double);
+    const BlackScholesModel&, const OptionSpec&, double);
 template double GreeksCalculator::calculateGamma<BlackScholesModel>(
-    const BlackScholesModel&, const Option&, double);
+    const BlackScholesModel&, const OptionSpec&, double);
 template double GreeksCalculator::calculateVega<BlackScholesModel>(
-    const BlackScholesModel&, const Option&, double);
+    const BlackScholesModel&, const OptionSpec&, double);
 template double GreeksCalculator::calculateTheta<BlackScholesModel>(
-    const BlackScholesModel&, const Option&, double);
+    const BlackScholesModel&, const OptionSpec&, double);
 template double GreeksCalculator::calculateRho<BlackScholesModel>(
-    const BlackScholesModel&, const Option&, double);
+    const BlackScholesModel&, const OptionSpec&, double);
 
 // ------------------------------------------
 // Instanciations explicites (FiniteDifferenceModel)
 // ------------------------------------------
 template double GreeksCalculator::calculateDelta<FiniteDifferenceModel>(
-    const FiniteDifferenceModel&, const Option&, double);
+    const FiniteDifferenceModel&, const OptionSpec&, double);
 template double GreeksCalculator::calculateGamma<FiniteDifferenceModel>(
-    const FiniteDifferenceModel&, const Option&, double);
+    const FiniteDifferenceModel&, const OptionSpec&, double);
 template double GreeksCalculator::calculateVega<FiniteDifferenceModel>(
-    const FiniteDifferenceModel&, const Option&, double);
+    const FiniteDifferenceModel&, const OptionSpec&, double);
 template double GreeksCalculator::calculateTheta<FiniteDifferenceModel>(
-    const FiniteDifferenceModel&, const Option&, double);
+    const FiniteDifferenceModel&, const OptionSpec&, double);
 template double GreeksCalculator::calculateRho<FiniteDifferenceModel>(
-    const FiniteDifferenceModel&, const Option&, double);
+    const FiniteDifferenceModel&, const OptionSpec&, double);
+
+// ------------------------------------------
+// Instanciations explicites (BinomialModel)
+// ------------------------------------------
+template double GreeksCalculator::calculateVega<BinomialModel>(
+    const BinomialModel&, const OptionSpec&, double);
+template double GreeksCalculator::calculateRho<BinomialModel>(
+    const BinomialModel&, const OptionSpec&, double);
 
 // ------------------------------------------
 // Instanciations explicites (AmericanOptionPricer)
 // ------------------------------------------
 template double GreeksCalculator::calculateDelta<AmericanOptionPricer>(
-    const AmericanOptionPricer&, const Option&, double);
+    const AmericanOptionPricer&, const OptionSpec&, double);
 template double GreeksCalculator::calculateGamma<AmericanOptionPricer>(
-    const AmericanOptionPricer&, const Option&, double);
+    const AmericanOptionPricer&, const OptionSpec&, double);
 template double GreeksCalculator::calculateVega<AmericanOptionPricer>(
-    const AmericanOptionPricer&, const Option&, double);
+    const AmericanOptionPricer&, const OptionSpec&, double);
 template double GreeksCalculator::calculateTheta<AmericanOptionPricer>(
-    const AmericanOptionPricer&, const Option&, double);
+    const AmericanOptionPricer&, const OptionSpec&, double);
 template double GreeksCalculator::calculateRho<AmericanOptionPricer>(
-    const AmericanOptionPricer&, const Option&, double);
+    const AmericanOptionPricer&, const OptionSpec&, double);
+
+// ------------------------------------------
+// Instanciations explicites (OptionPricingModel, repli générique)
+// ------------------------------------------
+template double GreeksCalculator::calculateVega<OptionPricingModel>(
+    const OptionPricingModel&, const OptionSpec&, double);
+template double GreeksCalculator::calculateTheta<OptionPricingModel>(
+    const OptionPricingModel&, const OptionSpec&, double);
+template double GreeksCalculator::calculateRho<OptionPricingModel>(
+    const OptionPricingModel&, const OptionSpec&, double);
 
 // ------------------------------------------
 // Méthodes publiques : Black-Scholes
 // ------------------------------------------
-double GreeksCalculator::delta(const BlackScholesModel& model, const Option& option) {
-    double deltaS = option.getSpotPrice() * 0.01;
-    return calculateDelta(model, option, deltaS);
+// Formules fermées : pas de bump-and-reprice, donc pas de bruit sur la gamma
+Greeks GreeksCalculator::greeks(const BlackScholesModel& model, const OptionSpec& option) {
+    return model.calculateGreeks(option);
 }
 
-double GreeksCalculator::gamma(const BlackScholesModel& model, const Option& option) {
-    double deltaS = 0.01;
-    return calculateGamma(model, option, deltaS);
+Greeks GreeksCalculator::greeks(const MonteCarloModel& model, const OptionSpec& option) {
+    return model.simulateGreeks(option).value;
 }
 
-double GreeksCalculator::vega(const BlackScholesModel& model, const Option& option) {
-    double deltaSigma = 0.0001;
-    return calculateVega(model, option, deltaSigma);
+double GreeksCalculator::delta(const BlackScholesModel& model, const OptionSpec& option) {
+    return model.calculateGreeks(option).delta;
 }
 
-double GreeksCalculator::theta(const BlackScholesModel& model, const Option& option) {
-    double deltaT = 1.0 / 365.0;
-    return calculateTheta(model, option, deltaT);
+double GreeksCalculator::gamma(const BlackScholesModel& model, const OptionSpec& option) {
+    return model.calculateGreeks(option).gamma;
 }
 
-double GreeksCalculator::rho(const BlackScholesModel& model, const Option& option) {
-    double deltaR = 0.0001;
-    return calculateRho(model, option, deltaR);
+double GreeksCalculator::vega(const BlackScholesModel& model, const OptionSpec& option) {
+    return model.calculateGreeks(option).vega;
+}
+
+double GreeksCalculator::theta(const BlackScholesModel& model, const OptionSpec& option) {
+    return model.calculateGreeks(option).theta;
+}
+
+double GreeksCalculator::rho(const BlackScholesModel& model, const OptionSpec& option) {
+    return model.calculateGreeks(option).rho;
 }
 
 // ------------------------------------------
 // Méthodes publiques : FiniteDifferenceModel
 // ------------------------------------------
-double GreeksCalculator::delta(const FiniteDifferenceModel& model, const Option& option) {
-    double S_max = 2.0 * option.getStrikePrice();
-    int M = model.getAssetSteps();
-    double ds = S_max / M;
-    return calculateDelta(model, option, ds);
+// Delta, gamma et theta lus sur la grille d'une seule résolution : plus de
+// bump-and-reprice en spot, dont la gamma n'était que du bruit d'interpolation
+Greeks GreeksCalculator::greeks(const FiniteDifferenceModel& model, const OptionSpec& option) {
+    Greeks g = model.solve(option).greeks();
+    g.vega = vega(model, option);
+    g.rho = rho(model, option);
+    return g;
+}
+
+double GreeksCalculator::delta(const FiniteDifferenceModel& model, const OptionSpec& option) {
+    return model.solve(option).delta(option.spot);
 }
 
-double GreeksCalculator::gamma(const FiniteDifferenceModel& model, const Option& option) {
-    double S_max = 2.0 * option.getStrikePrice();
-    int M = model.getAssetSteps();
-    double ds = S_max / M;
-    return calculateGamma(model, option, ds);
+double GreeksCalculator::gamma(const FiniteDifferenceModel& model, const OptionSpec& option) {
+    return model.solve(option).gamma(option.spot);
 }
 
-double GreeksCalculator::vega(const FiniteDifferenceModel& model, const Option& option) {
+double GreeksCalculator::vega(const FiniteDifferenceModel& model, const OptionSpec& option) {
     double deltaSigma = 0.0001;
     return calculateVega(model, option, deltaSigma);
 }
 
-double GreeksCalculator::theta(const FiniteDifferenceModel& model, const Option& option) {
-    double deltaT = 1.0 / 365.0;
-    return calculateTheta(model, option, deltaT);
+double GreeksCalculator::theta(const FiniteDifferenceModel& model, const OptionSpec& option) {
+    return model.solve(option).theta(option.spot);
 }
 
-double GreeksCalculator::rho(const FiniteDifferenceModel& model, const Option& option) {
+double GreeksCalculator::rho(const FiniteDifferenceModel& model, const OptionSpec& option) {
     double deltaR = 0.0001;
     return calculateRho(model, option, deltaR);
 }
 
+// ------------------------------------------
+// Méthodes publiques : BinomialModel
+// ------------------------------------------
+// Bumps plus larges qu'en PDE : le prix d'un arbre n'est lisse en sigma et en r
+// qu'à l'échelle de l'écart entre deux noeuds
+Greeks GreeksCalculator::greeks(const BinomialModel& model, const OptionSpec& option) {
+    Greeks g = model.calculateGreeks(option);
+    g.vega = calculateVega(model, option, 0.01);
+    g.rho = calculateRho(model, option, 0.001);
+    return g;
+}
+
 // ------------------------------------------
 // Méthodes publiques : AmericanOptionPricer
 // ------------------------------------------
-double GreeksCalculator::delta(const AmericanOptionPricer& pricer, const Option& option) {
-    double deltaS = option.getSpotPrice() * 0.01;
+double GreeksCalculator::delta(const AmericanOptionPricer& pricer, const OptionSpec& option) {
+    double deltaS = option.spot * 0.01;
     return calculateDelta(pricer, option, deltaS);
 }
 
-double GreeksCalculator::gamma(const AmericanOptionPricer& pricer, const Option& option) {
+double GreeksCalculator::gamma(const AmericanOptionPricer& pricer, const OptionSpec& option) {
     double deltaS = 0.01;
     return calculateGamma(pricer, option, deltaS);
 }
 
-double GreeksCalculator::vega(const AmericanOptionPricer& pricer, const Option& option) {
+double GreeksCalculator::vega(const AmericanOptionPricer& pricer, const OptionSpec& option) {
     double deltaSigma = 0.0001;
     return calculateVega(pricer, option, deltaSigma);
 }
 
-double GreeksCalculator::theta(const AmericanOptionPricer& pricer, const Option& option) {
+double GreeksCalculator::theta(const AmericanOptionPricer& pricer, const OptionSpec& option) {
     double deltaT = 1.0 / 365.0;
     return calculateTheta(pricer, option, deltaT);
 }
 
-double GreeksCalculator::rho(const AmericanOptionPricer& pricer, const Option& option) {
+double GreeksCalculator::rho(const AmericanOptionPricer& pricer, const OptionSpec& option) {
     double deltaR = 0.0001;
     return calculateRho(pricer, option, deltaR);
-}
\ No newline at end of file
+}
+
+// ------------------------------------------
+// Méthodes publiques : modèle quelconque
+// ------------------------------------------
+Greeks GreeksCalculator::greeks(const OptionPricingModel& model, const OptionSpec& option) {
+    if (auto* bs = dynamic_cast<const BlackScholesModel*>(&model)) {
+        return greeks(*bs, option);
+    }
+    if (auto* fd = dynamic_cast<const FiniteDifferenceModel*>(&model)) {
+        return greeks(*fd, option);
+    }
+    if (auto* binomial = dynamic_cast<const BinomialModel*>(&model)) {
+        return greeks(*binomial, option);
+    }
+    if (auto* mc = dynamic_cast<const MonteCarloModel*>(&model)) {
+        return greeks(*mc, option);
+    }
+    if (auto* cached = dynamic_cast<const CachedPricingModel*>(&model)) {
+        return cached->greeks(option);
+    }
+
+    Greeks g;
+    g.price = model.calculatePrice(option);
+    if (auto* american = dynamic_cast<const AmericanOptionPricer*>(&model)) {
+        g.delta = delta(*american, option);
+        g.gamma = gamma(*american, option);
+        g.vega = vega(*american, option);
+        g.theta = theta(*american, option);
+        g.rho = rho(*american, option);
+        return g;
+    }
+
+    // Bumps de 1 % du spot ; le prix central sert aussi à la gamma
+    const double deltaS = option.spot * 0.01;
+    const double priceUp = model.calculatePrice(option.withSpot(option.spot + deltaS));
+    const double priceDown = model.calculatePrice(option.withSpot(option.spot - deltaS));
+    g.delta = (priceUp - priceDown) / (2.0 * deltaS);
+    g.gamma = (priceUp - 2.0 * g.price + priceDown) / (deltaS * deltaS);
+    g.vega = calculateVega(model, option, 0.0001);
+    g.theta = calculateTheta(model, option, 1.0 / 365.0);
+    g.rho = calculateRho(model, option, 0.0001);
+    return g;
+}
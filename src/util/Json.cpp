@@ -0,0 +1,311 @@
+#include "util/Json.hpp"
+#include "util/CsvFormat.hpp"
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace {
+
+// Analyse descendante récursive, profondeur bornée
+class JsonParser {
+public:
+    explicit JsonParser(std::string_view text) : text_(text) {}
+
+    JsonValue document() {
+        JsonValue value = parseValue(0);
+        skipSpaces();
+        if (pos_ != text_.size()) {
+            fail("unexpected trailing characters");
+        }
+        return value;
+    }
+
+private:
+    static constexpr int MAX_DEPTH = 64;
+
+    [[noreturn]] void fail(const std::string& message) const {
+        throw std::invalid_argument("JSON: " + message + " at offset " + std::to_string(pos_));
+    }
+
+    void skipSpaces() {
+        while (pos_ < text_.size() &&
+               (text_[pos_] == ' ' || text_[pos_] == '\t' || text_[pos_] == '\n' || text_[pos_] == '\r')) {
+            ++pos_;
+        }
+    }
+
+    bool consume(char c) {
+        skipSpaces();
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c) {
+        if (!consume(c)) {
+            fail(std::string("expected '") + c + "'");
+        }
+    }
+
+    bool literal(std::string_view word) {
+        if (text_.substr(pos_, word.size()) == word) {
+            pos_ += word.size();
+            return true;
+        }
+        return false;
+    }
+
+    JsonValue parseValue(int depth) {
+        if (depth > MAX_DEPTH) {
+            fail("nesting too deep");
+        }
+        skipSpaces();
+        if (pos_ >= text_.size()) {
+            fail("unexpected end of input");
+        }
+        JsonValue value;
+        const char c = text_[pos_];
+        if (c == '{') {
+            ++pos_;
+            value.type = JsonValue::Type::Object;
+            if (!consume('}')) {
+                do {
+                    skipSpaces();
+                    if (pos_ >= text_.size() || text_[pos_] != '"') {
+                        fail("expected a member name");
+                    }
+                    value.keys.push_back(parseString());
+                    expect(':');
+                    value.values.push_back(parseValue(depth + 1));
+                } while (consume(','));
+                expect('}');
+            }
+        } else if (c == '[') {
+            ++pos_;
+            value.type = JsonValue::Type::Array;
+            if (!consume(']')) {
+                do {
+                    value.values.push_back(parseValue(depth + 1));
+                } while (consume(','));
+                expect(']');
+            }
+        } else if (c == '"') {
+            value.type = JsonValue::Type::String;
+            value.string = parseString();
+        } else if (literal("true") || literal("false")) {
+            value.type = JsonValue::Type::Bool;
+            value.boolean = c == 't';
+        } else if (literal("null")) {
+            value.type = JsonValue::Type::Null;
+        } else {
+            value.type = JsonValue::Type::Number;
+            value.number = parseNumber();
+        }
+        return value;
+    }
+
+    double parseNumber() {
+        // Grammaire JSON : -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+        const std::size_t start = pos_;
+        auto digits = [this]() {
+            const std::size_t first = pos_;
+            while (pos_ < text_.size() && text_[pos_] >= '0' && text_[pos_] <= '9') {
+                ++pos_;
+            }
+            return pos_ > first;
+        };
+        if (pos_ < text_.size() && text_[pos_] == '-') {
+            ++pos_;
+        }
+        const std::size_t integer = pos_;
+        if (!digits()) {
+            fail("invalid value");
+        }
+        if (text_[integer] == '0' && pos_ - integer > 1) {
+            fail("leading zero in number");
+        }
+        if (pos_ < text_.size() && text_[pos_] == '.') {
+            ++pos_;
+            if (!digits()) {
+                fail("invalid number");
+            }
+        }
+        if (pos_ < text_.size() && (text_[pos_] == 'e' || text_[pos_] == 'E')) {
+            ++pos_;
+            if (pos_ < text_.size() && (text_[pos_] == '+' || text_[pos_] == '-')) {
+                ++pos_;
+            }
+            if (!digits()) {
+                fail("invalid number");
+            }
+        }
+        return parseCsvNumber(text_.substr(start, pos_ - start), "JSON number");
+    }
+
+    unsigned hex4() {
+        if (pos_ + 4 > text_.size()) {
+            fail("truncated \\u escape");
+        }
+        unsigned code = 0;
+        for (int i = 0; i < 4; ++i) {
+            const char h = text_[pos_++];
+            code <<= 4;
+            if (h >= '0' && h <= '9') {
+                code |= static_cast<unsigned>(h - '0');
+            } else if (h >= 'a' && h <= 'f') {
+                code |= static_cast<unsigned>(h - 'a' + 10);
+            } else if (h >= 'A' && h <= 'F') {
+                code |= static_cast<unsigned>(h - 'A' + 10);
+            } else {
+                fail("invalid \\u escape");
+            }
+        }
+        return code;
+    }
+
+    static void appendUtf8(std::string& out, unsigned code) {
+        if (code < 0x80) {
+            out += static_cast<char>(code);
+        } else if (code < 0x800) {
+            out += static_cast<char>(0xC0 | (code >> 6));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else if (code < 0x10000) {
+            out += static_cast<char>(0xE0 | (code >> 12));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (code >> 18));
+            out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+    }
+
+    std::string parseString() {
+        ++pos_;  // '"'
+        std::string out;
+        while (true) {
+            if (pos_ >= text_.size()) {
+                fail("unterminated string");
+            }
+            const char c = text_[pos_++];
+            if (c == '"') {
+                return out;
+            }
+            if (static_cast<unsigned char>(c) < 0x20) {
+                fail("control character in string");
+            }
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+            if (pos_ >= text_.size()) {
+                fail("unterminated string");
+            }
+            const char escaped = text_[pos_++];
+            switch (escaped) {
+                case '"': out += '"'; break;
+                case '\\': out += '\\'; break;
+                case '/': out += '/'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u': {
+                    unsigned code = hex4();
+                    // Paire de substitution UTF-16
+                    if (code >= 0xD800 && code < 0xDC00 && literal("\\u")) {
+                        const unsigned low = hex4();
+                        if (low < 0xDC00 || low >= 0xE000) {
+                            fail("invalid surrogate pair");
+                        }
+                        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    appendUtf8(out, code);
+                    break;
+                }
+                default:
+                    fail("invalid escape");
+            }
+        }
+    }
+
+    std::string_view text_;
+    std::size_t pos_ = 0;
+};
+
+} // namespace
+
+const JsonValue* JsonValue::find(const std::string& key) const {
+    if (type != Type::Object) {
+        return nullptr;
+    }
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        if (keys[i] == key) {
+            return &values[i];
+        }
+    }
+    return nullptr;
+}
+
+JsonValue parseJson(std::string_view text) {
+    return JsonParser(text).document();
+}
+
+void appendJsonString(std::string& out, std::string_view text) {
+    static const char HEX[] = "0123456789abcdef";
+    out += '"';
+    for (const char c : text) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out += "\\u00";
+                    out += HEX[(c >> 4) & 0xF];
+                    out += HEX[c & 0xF];
+                } else {
+                    out += c;
+                }
+        }
+    }
+    out += '"';
+}
+
+void appendJsonNumber(std::string& out, double value) {
+    if (std::isfinite(value)) {
+        appendShortest(out, value);
+    } else {
+        out += "null";
+    }
+}
+
+void appendJson(std::string& out, const JsonValue& value) {
+    switch (value.type) {
+        case JsonValue::Type::Null: out += "null"; break;
+        case JsonValue::Type::Bool: out += value.boolean ? "true" : "false"; break;
+        case JsonValue::Type::Number: appendJsonNumber(out, value.number); break;
+        case JsonValue::Type::String: appendJsonString(out, value.string); break;
+        case JsonValue::Type::Array:
+        case JsonValue::Type::Object:
+            out += value.type == JsonValue::Type::Array ? '[' : '{';
+            for (std::size_t i = 0; i < value.values.size(); ++i) {
+                if (i > 0) {
+                    out += ',';
+                }
+                if (value.type == JsonValue::Type::Object) {
+                    appendJsonString(out, value.keys[i]);
+                    out += ':';
+                }
+                appendJson(out, value.values[i]);
+            }
+            out += value.type == JsonValue::Type::Array ? ']' : '}';
+            break;
+    }
+}
@@ -0,0 +1,30 @@
+#include "util/LatticeKernel.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+void rollbackLattice(int top, int stopLevel, const LatticeParameters& p, const unsigned char* exercisable,
+                     double* values, double* spots, int tileWidth, int tileLevels) {
+    if (tileWidth < 1 || tileLevels < 1 || stopLevel < 0) {
+        throw std::invalid_argument("rollbackLattice: tile sizes must be positive and stopLevel non-negative");
+    }
+    bool trackSpots = false;
+    for (int s = stopLevel; s < top; ++s) {
+        trackSpots = trackSpots || exercisable[s] != 0;
+    }
+
+    for (int chunkTop = top; chunkTop > stopLevel; chunkTop -= tileLevels) {
+        const int levels = std::min(tileLevels, chunkTop - stopLevel);
+        // Tuiles de gauche à droite : la tuile précédente a déjà produit, à
+        // chaque niveau, le noeud situé juste sous la tuile courante
+        for (int lo = 0; lo < chunkTop; lo += tileWidth) {
+            for (int k = 0; k < levels; ++k) {
+                const int level = chunkTop - 1 - k;
+                const int first = std::max(lo - k, 0);
+                const int last = std::min(lo + tileWidth - k, level + 1);
+                if (first < last) {
+                    lattice::stepLevel(values, spots, first, last, exercisable[level] != 0, trackSpots, p);
+                }
+            }
+        }
+    }
+}
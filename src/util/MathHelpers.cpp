@@ -1,5 +1,6 @@
 #include "util/MathHelpers.hpp"
 #include <cmath>
+#include <initializer_list>
 
 double normcdf(double x)
 {
@@ -22,4 +23,99 @@ double normcdf(double x)
     double y = 1.0 - (((((a5*t + a4)*t) + a3)*t + a2)*t + a1)*t*exp(-x*x);
 
     return 0.5*(1.0 + sign*y);
-}
\ No newline at end of file
+}
+
+double normpdf(double x)
+{
+    return 0.3989422804014327 * exp(-0.5 * x * x);
+}
+
+namespace {
+
+// Points et poids de Gauss-Legendre (moitié négative) à 6, 12 et 20 points
+const double GL_X[3][10] = {
+    {-0.9324695142031522, -0.6612093864662647, -0.2386191860831970},
+    {-0.9815606342467191, -0.9041172563704750, -0.7699026741943050, -0.5873179542866171,
+     -0.3678314989981802, -0.1252334085114692},
+    {-0.9931285991850949, -0.9639719272779138, -0.9122344282513259, -0.8391169718222188,
+     -0.7463319064601508, -0.6360536807265150, -0.5108670019508271, -0.3737060887154196,
+     -0.2277858511416451, -0.07652652113349733}};
+const double GL_W[3][10] = {
+    {0.1713244923791705, 0.3607615730481384, 0.4679139345726904},
+    {0.04717533638651177, 0.1069393259953183, 0.1600783285433464, 0.2031674267230659,
+     0.2334925365383547, 0.2491470458134029},
+    {0.01761400713915212, 0.04060142980038694, 0.06267204833410906, 0.08327674157670475,
+     0.1019301198172404, 0.1181945319615184, 0.1316886384491766, 0.1420961093183821,
+     0.1491729864726037, 0.1527533871307259}};
+
+// P(X > h, Y > k) (BVND de Genz)
+double upperBivariate(double h, double k, double r)
+{
+    const double TWOPI = 6.283185307179586;
+    const int ng = fabs(r) < 0.3 ? 0 : (fabs(r) < 0.75 ? 1 : 2);
+    const int lg = ng == 0 ? 3 : (ng == 1 ? 6 : 10);
+    double hk = h * k;
+    double bvn = 0.0;
+
+    if (fabs(r) < 0.925) {
+        if (fabs(r) > 0.0) {
+            const double hs = (h * h + k * k) / 2.0;
+            const double asr = asin(r);
+            for (int i = 0; i < lg; ++i) {
+                double sn = sin(asr * (GL_X[ng][i] + 1.0) / 2.0);
+                bvn += GL_W[ng][i] * exp((sn * hk - hs) / (1.0 - sn * sn));
+                sn = sin(asr * (-GL_X[ng][i] + 1.0) / 2.0);
+                bvn += GL_W[ng][i] * exp((sn * hk - hs) / (1.0 - sn * sn));
+            }
+            bvn *= asr / (2.0 * TWOPI);
+        }
+        return bvn + normcdf(-h) * normcdf(-k);
+    }
+
+    if (r < 0.0) {
+        k = -k;
+        hk = -hk;
+    }
+    if (fabs(r) < 1.0) {
+        const double as = (1.0 - r) * (1.0 + r);
+        double a = sqrt(as);
+        const double bs = (h - k) * (h - k);
+        const double c = (4.0 - hk) / 8.0;
+        const double d = (12.0 - hk) / 16.0;
+        double asr = -(bs / as + hk) / 2.0;
+        if (asr > -100.0) {
+            bvn = a * exp(asr) * (1.0 - c * (bs - as) * (1.0 - d * bs / 5.0) / 3.0 + c * d * as * as / 5.0);
+        }
+        if (-hk < 100.0) {
+            const double b = sqrt(bs);
+            bvn -= exp(-hk / 2.0) * sqrt(TWOPI) * normcdf(-b / a) * b * (1.0 - c * bs * (1.0 - d * bs / 5.0) / 3.0);
+        }
+        a /= 2.0;
+        for (int i = 0; i < lg; ++i) {
+            for (const double x : {GL_X[ng][i], -GL_X[ng][i]}) {
+                const double xs = a * a * (x + 1.0) * (x + 1.0);
+                const double rs = sqrt(1.0 - xs);
+                asr = -(bs / xs + hk) / 2.0;
+                if (asr > -100.0) {
+                    bvn += a * GL_W[ng][i] * exp(asr) *
+                           (exp(-hk * (1.0 - rs) / (2.0 * (1.0 + rs))) / rs - (1.0 + c * xs * (1.0 + d * xs)));
+                }
+            }
+        }
+        bvn = -bvn / TWOPI;
+    }
+    if (r > 0.0) {
+        bvn += normcdf(-(h > k ? h : k));
+    } else {
+        const double diff = normcdf(-h) - normcdf(-k);
+        bvn = -bvn + (diff > 0.0 ? diff : 0.0);
+    }
+    return bvn;
+}
+
+} // namespace
+
+double bivariateNormcdf(double a, double b, double rho)
+{
+    return upperBivariate(-a, -b, rho);
+}
@@ -1,115 +1,66 @@
 #include "util/OptionDataExporter.hpp"
-#include <iostream>
-#include <iomanip>
+#include <fstream>
+#include <stdexcept>
 
-// Export for FiniteDifferenceModel
-void OptionDataExporter::exportToCSV(const FiniteDifferenceModel& model,
-                                   const Option& option,
-                                   const std::string& filename) {
+// Profil en spot au format CSV historique, commun à tous les modèles
+void OptionDataExporter::exportSpotProfile(const OptionPricingModel& model,
+                                         const OptionSpec& option,
+                                         const std::string& filename) {
     std::ofstream file(filename);
     if (!file.is_open()) {
         throw std::runtime_error("Could not open file: " + filename);
     }
+    CsvScenarioSink sink(file, true);
+    ScenarioGridEngine().run(model, option, ScenarioAxes::spotProfile(option), sink);
+}
 
-    file << std::fixed << std::setprecision(6);
-    
-    // En-tête
-    file << "Spot,Price,Delta,Gamma,Theta,Rho,Vega\n";
-    
-    // Points de données
-    double K = option.getStrikePrice();
-    double spotMin = K * 0.5;
-    double spotMax = K * 1.5;
-    int points = 100;
-    double dS = (spotMax - spotMin) / points;
-    
-    for (double s = spotMin; s <= spotMax; s += dS) {
-        Option tmpOption(s, option.getStrikePrice(), 
-                        option.getRiskFreeRate(), option.getVolatility(),
-                        option.getTimeToMaturity(), option.getType());
-        
-        file << s << ","
-             << model.calculatePrice(tmpOption) << ","
-             << GreeksCalculator::delta(model, tmpOption) << ","
-             << GreeksCalculator::gamma(model, tmpOption) << ","
-             << GreeksCalculator::theta(model, tmpOption) << ","
-             << GreeksCalculator::rho(model, tmpOption) << ","
-             << GreeksCalculator::vega(model, tmpOption) << "\n";
-    }
-    file.close();
+// Export for FiniteDifferenceModel : une résolution (plus quatre décalées pour
+// vega et rho) sert toute la plage de spots
+void OptionDataExporter::exportToCSV(const FiniteDifferenceModel& model,
+                                   const OptionSpec& option,
+                                   const std::string& filename) {
+    exportSpotProfile(model, option, filename);
 }
 
 // Export for AmericanOptionPricer
 void OptionDataExporter::exportToCSV(const AmericanOptionPricer& pricer,
-                                   const Option& option,
+                                   const OptionSpec& option,
                                    const std::string& filename) {
-    std::ofstream file(filename);
-    if (!file.is_open()) {
-        throw std::runtime_error("Could not open file: " + filename);
-    }
-
-    file << std::fixed << std::setprecision(6);
-    
-    // En-tête
-    file << "Spot,Price,Delta,Gamma,Theta,Rho,Vega\n";
-    
-    // Points de données
-    double K = option.getStrikePrice();
-    double spotMin = K * 0.5;
-    double spotMax = K * 1.5;
-    int points = 100;
-    double dS = (spotMax - spotMin) / points;
-    
-    for (double s = spotMin; s <= spotMax; s += dS) {
-        Option tmpOption(s, option.getStrikePrice(), 
-                        option.getRiskFreeRate(), option.getVolatility(),
-                        option.getTimeToMaturity(), option.getType());
-        
-        file << s << ","
-             << pricer.calculatePrice(tmpOption) << ","
-             << GreeksCalculator::delta(pricer, tmpOption) << ","
-             << GreeksCalculator::gamma(pricer, tmpOption) << ","
-             << GreeksCalculator::theta(pricer, tmpOption) << ","
-             << GreeksCalculator::rho(pricer, tmpOption) << ","
-             << GreeksCalculator::vega(pricer, tmpOption) << "\n";
-    }
-    file.close();
+    exportSpotProfile(pricer, option, filename);
 }
 
-// Export for BlackScholesModel
+// Export for BlackScholesModel : prix et Greeks en une seule passe analytique
 void OptionDataExporter::exportToCSV(const BlackScholesModel& model,
-                                   const Option& option,
+                                   const OptionSpec& option,
                                    const std::string& filename) {
+    exportSpotProfile(model, option, filename);
+}
+
+// Export for CachedPricingModel : prix et Greeks d'un point en une seule lecture du cache
+void OptionDataExporter::exportToCSV(const CachedPricingModel& model,
+                                   const OptionSpec& option,
+                                   const std::string& filename) {
+    exportSpotProfile(model, option, filename);
+}
+
+ScenarioReport OptionDataExporter::exportScenarioGrid(const OptionPricingModel& model,
+                                                      const OptionSpec& option,
+                                                      const ScenarioAxes& axes,
+                                                      const std::string& filename,
+                                                      const ScenarioSettings& settings) {
+    const ScenarioGridEngine engine(settings);
+    const std::string extension = ".opcb";
+    if (filename.size() >= extension.size() &&
+        filename.compare(filename.size() - extension.size(), extension.size(), extension) == 0) {
+        ColumnarScenarioSink sink(filename);
+        const ScenarioReport report = engine.run(model, option, axes, sink);
+        sink.close();
+        return report;
+    }
     std::ofstream file(filename);
     if (!file.is_open()) {
         throw std::runtime_error("Could not open file: " + filename);
     }
-
-    file << std::fixed << std::setprecision(6);
-    
-    // En-tête
-    file << "Spot,Price,Delta,Gamma,Theta,Rho,Vega\n";
-    
-    // Points de données
-    double K = option.getStrikePrice();
-    double spotMin = K * 0.5;
-    double spotMax = K * 1.5;
-    int points = 100;
-    double dS = (spotMax - spotMin) / points;
-    
-    for (double s = spotMin; s <= spotMax; s += dS) {
-        Option tmpOption(s, option.getStrikePrice(), 
-                        option.getRiskFreeRate(), option.getVolatility(),
-                        option.getTimeToMaturity(), option.getType());
-        
-        file << s << ","
-             << model.calculatePrice(tmpOption) << ","
-             << GreeksCalculator::delta(model, tmpOption) << ","
-             << GreeksCalculator::gamma(model, tmpOption) << ","
-             << GreeksCalculator::theta(model, tmpOption) << ","
-             << GreeksCalculator::rho(model, tmpOption) << ","
-             << GreeksCalculator::vega(model, tmpOption) << "\n";
-    }
-    file.close();
+    CsvScenarioSink sink(file);
+    return engine.run(model, option, axes, sink);
 }
-
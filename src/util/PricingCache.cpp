@@ -0,0 +1,499 @@
+#include "util/PricingCache.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+const char MAGIC[8] = {'O', 'P', 'C', 'A', 'C', 'H', 'E', '\n'};
+constexpr std::uint32_t VERSION = 2;
+constexpr std::uint64_t PROBE = 8;           // Fenêtre de recherche d'une clé
+constexpr std::uint64_t KEY_WORDS = 7;
+constexpr std::uint64_t VALUE_WORDS = 9;     // Champs de Greeks, dans l'ordre de la structure
+constexpr std::uint64_t KIND_EMPTY = 0;
+constexpr std::uint64_t KIND_PRICE = 1;
+constexpr std::uint64_t KIND_GREEKS = 2;
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+              "Les compteurs partagés entre processus doivent être sans verrou");
+
+// Champs fixés à la création du fichier, relus sous verrou
+struct Layout {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t slotBytes;
+    std::uint64_t capacity;
+};
+
+std::uint64_t mix(std::uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+std::uint64_t bits(double value) {
+    std::uint64_t word;
+    std::memcpy(&word, &value, sizeof(word));
+    return word;
+}
+
+double fromBits(std::uint64_t word) {
+    double value;
+    std::memcpy(&value, &word, sizeof(value));
+    return value;
+}
+
+void toValues(const Greeks& g, double* values) {
+    const double fields[VALUE_WORDS] = {g.price, g.delta, g.gamma, g.vega, g.theta, g.rho, g.vanna, g.volga, g.charm};
+    std::memcpy(values, fields, sizeof(fields));
+}
+
+Greeks fromValues(const double* values) {
+    Greeks g;
+    g.price = values[0];
+    g.delta = values[1];
+    g.gamma = values[2];
+    g.vega = values[3];
+    g.theta = values[4];
+    g.rho = values[5];
+    g.vanna = values[6];
+    g.volga = values[7];
+    g.charm = values[8];
+    return g;
+}
+
+} // namespace
+
+struct PricingCache::Header {
+    Layout layout;
+    unsigned char reserved[40];
+    alignas(64) std::atomic<std::uint64_t> clock;   // Horloge logique des accès (LRU)
+    alignas(64) std::atomic<std::uint64_t> hits;
+    std::atomic<std::uint64_t> misses;
+    std::atomic<std::uint64_t> inserts;
+    std::atomic<std::uint64_t> evictions;
+    std::atomic<std::uint64_t> entries;
+};
+
+struct alignas(64) PricingCache::Slot {
+    std::atomic<std::uint64_t> version;   // Impaire pendant une écriture
+    std::atomic<std::uint64_t> lastUse;   // Valeur de l'horloge au dernier accès
+    std::atomic<std::uint64_t> kind;      // KIND_EMPTY, KIND_PRICE ou KIND_GREEKS
+    std::atomic<std::uint64_t> key[KEY_WORDS];
+    std::atomic<std::uint64_t> values[VALUE_WORDS];
+    std::atomic<std::uint64_t> check;     // Somme de contrôle de kind, key et des valeurs écrites
+};
+
+namespace {
+
+enum class SlotState { Empty, Busy, Other, Match };
+
+std::uint64_t checksum(std::uint64_t kind, const std::uint64_t* key, const double* values) {
+    std::uint64_t h = mix(kind);
+    for (std::uint64_t w = 0; w < KEY_WORDS; ++w) {
+        h = mix(h ^ key[w]);
+    }
+    const std::uint64_t count = kind == KIND_GREEKS ? VALUE_WORDS : 1;
+    for (std::uint64_t v = 0; v < count; ++v) {
+        h = mix(h ^ bits(values[v]));
+    }
+    return h;
+}
+
+// Lecture cohérente d'une entrée : recommencée si un écrivain l'a modifiée entre-temps
+template<typename Slot>
+SlotState readSlot(const Slot& slot, const CacheKey& key, std::uint64_t& version, std::uint64_t& kind,
+                   double* values) {
+    for (int attempt = 0; attempt < 4; ++attempt) {
+        version = slot.version.load(std::memory_order_acquire);
+        if (version & 1) {
+            continue;
+        }
+        kind = slot.kind.load(std::memory_order_relaxed);
+        bool match = kind != KIND_EMPTY;
+        for (std::uint64_t w = 0; w < KEY_WORDS; ++w) {
+            match &= slot.key[w].load(std::memory_order_relaxed) == key.words[w];
+        }
+        if (match) {
+            for (std::uint64_t v = 0; v < VALUE_WORDS; ++v) {
+                values[v] = fromBits(slot.values[v].load(std::memory_order_relaxed));
+            }
+            // Entrée déchirée par un écrivain évincé (voir reserve) : inutilisable, comme une autre clé
+            match = slot.check.load(std::memory_order_relaxed) == checksum(kind, key.words, values);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.version.load(std::memory_order_relaxed) == version) {
+            return kind == KIND_EMPTY ? SlotState::Empty : match ? SlotState::Match : SlotState::Other;
+        }
+    }
+    return SlotState::Busy;
+}
+
+} // namespace
+
+double CacheStats::hitRate() const {
+    const std::uint64_t requests = hits + misses;
+    return requests > 0 ? static_cast<double>(hits) / static_cast<double>(requests) : 0.0;
+}
+
+PricingCache::PricingCache(const std::string& path, const CacheSettings& settings) : path_(path), settings_(settings) {
+    if (!(settings_.relativeTolerance > 0 && settings_.relativeTolerance < 1) || !(settings_.rateTolerance > 0) ||
+        settings_.capacity == 0) {
+        throw std::invalid_argument("PricingCache: tolerances in (0, 1) and a positive capacity required");
+    }
+
+    // Création et dimensionnement sous verrou : deux processus qui démarrent ensemble voient le même fichier.
+    // Un fichier remplacé (rename) pendant l'attente du verrou est rouvert sous son chemin.
+    int fd = -1;
+    struct stat info;
+    while (true) {
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0666);
+        if (fd < 0) {
+            throw std::runtime_error("Could not open file: " + path);
+        }
+        if (::flock(fd, LOCK_EX) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Could not lock file: " + path);
+        }
+        struct stat current;
+        if (::fstat(fd, &info) != 0) {
+            ::flock(fd, LOCK_UN);
+            ::close(fd);
+            throw std::runtime_error("Could not stat file: " + path);
+        }
+        if (::stat(path.c_str(), &current) == 0 && current.st_dev == info.st_dev && current.st_ino == info.st_ino) {
+            break;
+        }
+        ::flock(fd, LOCK_UN);
+        ::close(fd);
+    }
+
+    Layout layout{};
+    const bool ours = info.st_size >= static_cast<off_t>(sizeof(MAGIC)) &&
+                      ::pread(fd, &layout, std::min(sizeof(layout), static_cast<std::size_t>(info.st_size)), 0) >=
+                          static_cast<ssize_t>(sizeof(MAGIC)) &&
+                      std::memcmp(layout.magic, MAGIC, sizeof(MAGIC)) == 0;
+    // Un fichier qui n'est pas un cache (faute de frappe dans le chemin) n'est jamais écrasé
+    if (info.st_size != 0 && !ours) {
+        ::flock(fd, LOCK_UN);
+        ::close(fd);
+        throw std::runtime_error("PricingCache: not a pricing cache file, left untouched: " + path);
+    }
+    bool valid = ours && info.st_size >= static_cast<off_t>(sizeof(Header));
+    valid = valid && layout.version == VERSION &&
+            layout.slotBytes == sizeof(Slot) && layout.capacity >= PROBE &&
+            (layout.capacity & (layout.capacity - 1)) == 0 &&
+            info.st_size == static_cast<off_t>(sizeof(Header) + layout.capacity * sizeof(Slot));
+
+    std::uint64_t capacity = valid ? layout.capacity : PROBE;
+    while (!valid && capacity < settings_.capacity) {
+        capacity <<= 1;
+    }
+    size_ = sizeof(Header) + capacity * sizeof(Slot);
+
+    // Cache d'une autre version ou abîmé : d'autres processus peuvent le projeter encore, et le
+    // tronquer leur vaudrait SIGBUS. Le nouveau cache est construit à côté puis substitué par
+    // rename() ; les anciens utilisateurs gardent l'ancien fichier jusqu'à leur fermeture.
+    int target = fd;
+    std::string replacement;
+    if (!valid && info.st_size != 0) {
+        replacement = path + ".XXXXXX";
+        target = ::mkostemp(&replacement[0], O_CLOEXEC);
+        if (target < 0) {
+            ::flock(fd, LOCK_UN);
+            ::close(fd);
+            throw std::runtime_error("Could not create file next to: " + path);
+        }
+        ::fchmod(target, info.st_mode & 0777);
+    }
+    auto fail = [&](const std::string& message) {
+        if (target != fd) {
+            ::close(target);
+            ::unlink(replacement.c_str());
+        }
+        ::flock(fd, LOCK_UN);
+        ::close(fd);
+        throw std::runtime_error(message + path);
+    };
+
+    // Fichier vide (ou nouveau fichier) : dimensionné, ftruncate le remplit d'octets nuls
+    if (!valid && ::ftruncate(target, static_cast<off_t>(size_)) != 0) {
+        fail("Could not resize file: ");
+    }
+    mapping_ = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, target, 0);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = nullptr;
+        fail("Could not map file: ");
+    }
+    if (!valid) {
+        // Octets nuls : compteurs atomiques et entrées vides ; la signature est écrite en dernier
+        Header* header = static_cast<Header*>(mapping_);
+        header->layout.version = VERSION;
+        header->layout.slotBytes = sizeof(Slot);
+        header->layout.capacity = capacity;
+        std::memcpy(header->layout.magic, MAGIC, sizeof(MAGIC));
+    }
+    if (target != fd && ::rename(replacement.c_str(), path.c_str()) != 0) {
+        ::munmap(mapping_, size_);
+        mapping_ = nullptr;
+        fail("Could not replace file: ");
+    }
+    if (target != fd) {
+        ::close(target);
+    }
+    ::flock(fd, LOCK_UN);
+    ::close(fd);
+
+    header_ = static_cast<Header*>(mapping_);
+    slots_ = reinterpret_cast<Slot*>(static_cast<unsigned char*>(mapping_) + sizeof(Header));
+    mask_ = capacity - 1;
+}
+
+PricingCache::~PricingCache() {
+    ::munmap(mapping_, size_);
+}
+
+std::uint64_t PricingCache::modelId(const std::string& description) const {
+    // FNV-1a sur la description suivie des tolérances : une autre grille donne d'autres valeurs
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    auto add = [&h](const void* data, std::size_t bytes) {
+        const unsigned char* p = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < bytes; ++i) {
+            h = (h ^ p[i]) * 0x100000001b3ULL;
+        }
+    };
+    add(description.data(), description.size() + 1);
+    add(&settings_.relativeTolerance, sizeof(double));
+    add(&settings_.rateTolerance, sizeof(double));
+    return h;
+}
+
+bool PricingCache::makeKey(std::uint64_t model, const OptionSpec& option, CacheKey& key) const {
+    const double logStep = std::log1p(settings_.relativeTolerance);
+    // Bornes des indices : la grille couvre largement toutes les valeurs représentables
+    const double maxIndex = 4e18;
+    key.option = option;
+    key.words[0] = model;
+
+    double* const logScaled[] = {&key.option.spot, &key.option.strike, &key.option.volatility, &key.option.maturity};
+    std::uint64_t* const logWords[] = {&key.words[1], &key.words[2], &key.words[4], &key.words[5]};
+    for (int i = 0; i < 4; ++i) {
+        const double value = *logScaled[i];
+        if (!(value > 0) || !std::isfinite(value)) {
+            return false;
+        }
+        const double index = std::nearbyint(std::log(value) / logStep);
+        if (std::fabs(index) > maxIndex) {
+            return false;
+        }
+        *logWords[i] = static_cast<std::uint64_t>(static_cast<std::int64_t>(index));
+        *logScaled[i] = std::exp(index * logStep);
+    }
+
+    const double rateIndex = std::nearbyint(option.rate / settings_.rateTolerance);
+    if (!std::isfinite(rateIndex) || std::fabs(rateIndex) > maxIndex) {
+        return false;
+    }
+    key.words[3] = static_cast<std::uint64_t>(static_cast<std::int64_t>(rateIndex));
+    key.option.rate = rateIndex * settings_.rateTolerance;
+    key.words[6] = static_cast<std::uint64_t>(option.type);
+
+    std::uint64_t h = 0;
+    for (std::uint64_t w = 0; w < KEY_WORDS; ++w) {
+        h = mix(h ^ key.words[w]);
+    }
+    key.hash = h;
+    return true;
+}
+
+bool PricingCache::find(const CacheKey& key, std::uint64_t kind, double* values) {
+    for (std::uint64_t i = 0; i < PROBE; ++i) {
+        Slot& slot = slots_[(key.hash + i) & mask_];
+        std::uint64_t version;
+        std::uint64_t stored;
+        const SlotState state = readSlot(slot, key, version, stored, values);
+        // Les entrées ne sont jamais vidées une à une : une entrée vide termine la fenêtre
+        if (state == SlotState::Empty) {
+            break;
+        }
+        if (state == SlotState::Match) {
+            if (stored < kind) {
+                break;
+            }
+            slot.lastUse.store(header_->clock.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+            header_->hits.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    header_->misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+bool PricingCache::abandoned(const Slot& slot, std::uint64_t version) const {
+    // Réservée depuis plus d'une génération d'accès (capacité) : son écrivain est mort
+    return (version & 1) && header_->clock.load(std::memory_order_relaxed) -
+                                    slot.lastUse.load(std::memory_order_relaxed) > mask_ + 1;
+}
+
+bool PricingCache::reserve(Slot& slot, std::uint64_t observed, std::uint64_t& reserved) {
+    if ((observed & 1) && !abandoned(slot, observed)) {
+        return false;
+    }
+    // Une entrée abandonnée reste impaire : les lecteurs continuent de l'ignorer. Si l'ancien
+    // écrivain n'était que suspendu, ses écritures tardives échouent à la somme de contrôle.
+    reserved = observed + ((observed & 1) ? 2 : 1);
+    if (!slot.version.compare_exchange_strong(observed, reserved, std::memory_order_acquire,
+                                              std::memory_order_relaxed)) {
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.lastUse.store(header_->clock.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+    return true;
+}
+
+bool PricingCache::release(Slot& slot, std::uint64_t reserved) {
+    return slot.version.compare_exchange_strong(reserved, reserved + 1, std::memory_order_release,
+                                                std::memory_order_relaxed);
+}
+
+void PricingCache::store(const CacheKey& key, std::uint64_t kind, const double* values) {
+    // Cible : l'entrée de la même clé, sinon la première vide, sinon la moins récemment utilisée
+    // (une entrée abandonnée par un écrivain mort compte parmi les candidates)
+    Slot* target = nullptr;
+    std::uint64_t targetVersion = 0;
+    bool empty = false;
+    Slot* oldest = nullptr;
+    std::uint64_t oldestVersion = 0;
+    std::uint64_t oldestUse = std::numeric_limits<std::uint64_t>::max();
+    double current[VALUE_WORDS];
+    for (std::uint64_t i = 0; i < PROBE && !target; ++i) {
+        Slot& slot = slots_[(key.hash + i) & mask_];
+        std::uint64_t version;
+        std::uint64_t stored;
+        const SlotState state = readSlot(slot, key, version, stored, current);
+        if (state == SlotState::Match) {
+            if (stored >= kind) {
+                return;  // Déjà présente, au moins aussi complète
+            }
+            target = &slot;
+            targetVersion = version;
+        } else if (state == SlotState::Empty) {
+            target = &slot;
+            targetVersion = version;
+            empty = true;
+        } else if (state == SlotState::Other || (state == SlotState::Busy && abandoned(slot, version))) {
+            const std::uint64_t use = slot.lastUse.load(std::memory_order_relaxed);
+            if (use < oldestUse) {
+                oldest = &slot;
+                oldestVersion = version;
+                oldestUse = use;
+            }
+        }
+    }
+    const bool evicted = !target;
+    if (evicted) {
+        if (!oldest) {
+            return;  // Fenêtre entièrement en cours d'écriture
+        }
+        target = oldest;
+        targetVersion = oldestVersion;
+    }
+
+    // Réservation : échoue si un autre écrivain est passé depuis la lecture
+    std::uint64_t reserved;
+    if (!reserve(*target, targetVersion, reserved)) {
+        return;
+    }
+    target->kind.store(kind, std::memory_order_relaxed);
+    for (std::uint64_t w = 0; w < KEY_WORDS; ++w) {
+        target->key[w].store(key.words[w], std::memory_order_relaxed);
+    }
+    const std::uint64_t count = kind == KIND_GREEKS ? VALUE_WORDS : 1;
+    for (std::uint64_t v = 0; v < count; ++v) {
+        target->values[v].store(bits(values[v]), std::memory_order_relaxed);
+    }
+    target->check.store(checksum(kind, key.words, values), std::memory_order_relaxed);
+    if (!release(*target, reserved)) {
+        return;  // Reprise entre-temps comme abandonnée
+    }
+
+    header_->inserts.fetch_add(1, std::memory_order_relaxed);
+    if (empty) {
+        header_->entries.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (evicted) {
+        header_->evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool PricingCache::findPrice(const CacheKey& key, double& price) {
+    double values[VALUE_WORDS];
+    if (!find(key, KIND_PRICE, values)) {
+        return false;
+    }
+    price = values[0];
+    return true;
+}
+
+bool PricingCache::findGreeks(const CacheKey& key, Greeks& greeks) {
+    double values[VALUE_WORDS];
+    if (!find(key, KIND_GREEKS, values)) {
+        return false;
+    }
+    greeks = fromValues(values);
+    return true;
+}
+
+void PricingCache::storePrice(const CacheKey& key, double price) {
+    store(key, KIND_PRICE, &price);
+}
+
+void PricingCache::storeGreeks(const CacheKey& key, const Greeks& greeks) {
+    double values[VALUE_WORDS];
+    toValues(greeks, values);
+    store(key, KIND_GREEKS, values);
+}
+
+CacheStats PricingCache::stats() const {
+    CacheStats stats;
+    stats.capacity = mask_ + 1;
+    stats.entries = header_->entries.load(std::memory_order_relaxed);
+    stats.hits = header_->hits.load(std::memory_order_relaxed);
+    stats.misses = header_->misses.load(std::memory_order_relaxed);
+    stats.inserts = header_->inserts.load(std::memory_order_relaxed);
+    stats.evictions = header_->evictions.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void PricingCache::clear() {
+    // Chaque entrée est vidée sous sa propre réservation ; la version continue de croître
+    for (std::uint64_t i = 0; i <= mask_; ++i) {
+        Slot& slot = slots_[i];
+        std::uint64_t reserved;
+        if (!reserve(slot, slot.version.load(std::memory_order_relaxed), reserved)) {
+            continue;
+        }
+        slot.kind.store(KIND_EMPTY, std::memory_order_relaxed);
+        release(slot, reserved);
+    }
+    header_->entries.store(0, std::memory_order_relaxed);
+    header_->hits.store(0, std::memory_order_relaxed);
+    header_->misses.store(0, std::memory_order_relaxed);
+    header_->inserts.store(0, std::memory_order_relaxed);
+    header_->evictions.store(0, std::memory_order_relaxed);
+}
+
+const std::string& PricingCache::path() const {
+    return path_;
+}
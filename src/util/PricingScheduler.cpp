@@ -0,0 +1,250 @@
+#include "util/PricingScheduler.hpp"
+#include "util/GreeksCalculator.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+#include <omp.h>
+
+namespace {
+
+// Calibration initiale : environ une nanoseconde par opération élémentaire
+constexpr double DEFAULT_SECONDS_PER_COST = 1e-9;
+
+// Modèles calibrés au plus : au-delà (modèles éphémères), la table repart de zéro
+constexpr std::size_t MAX_CALIBRATED_MODELS = 1024;
+
+// Paquet de tâches consécutives dans l'ordre de coût décroissant
+struct Chunk {
+    std::size_t begin;
+    std::size_t end;
+    double cost;
+};
+
+// File d'un thread : le propriétaire prend en tête (paquets les plus lourds),
+// les voleurs en queue (paquets les plus légers)
+struct alignas(64) WorkerQueue {
+    std::mutex mutex;
+    std::deque<Chunk> chunks;
+};
+
+void execute(const PricingTask& task, bool computeGreeks, int thread, PricingTaskResult& result) {
+    result.greeks = Greeks();
+    result.thread = thread;
+    try {
+        if (!task.model) {
+            throw std::invalid_argument("PricingScheduler: task without a model");
+        }
+        if (computeGreeks) {
+            result.greeks = GreeksCalculator::greeks(*task.model, task.option);
+        } else {
+            result.greeks.price = task.model->calculatePrice(task.option);
+        }
+    } catch (const std::exception& e) {
+        result.greeks.price = std::numeric_limits<double>::quiet_NaN();
+        result.error = e.what();
+    }
+}
+
+} // namespace
+
+double SchedulerReport::efficiency() const {
+    if (seconds <= 0 || threads <= 0) {
+        return 0.0;
+    }
+    // Un modèle parallèle occupe toute l'équipe pendant sa durée
+    const double busy = taskSeconds - parallelSeconds + parallelSeconds * threads;
+    return std::min(1.0, busy / (seconds * threads));
+}
+
+PricingScheduler::PricingScheduler(const SchedulerSettings& settings) : settings_(settings) {
+    if (settings_.threads < 0 || settings_.chunksPerThread <= 0 || settings_.minChunkSeconds < 0) {
+        throw std::invalid_argument("PricingScheduler: threads >= 0, chunksPerThread > 0 and minChunkSeconds >= 0 required");
+    }
+}
+
+const SchedulerSettings& PricingScheduler::getSettings() const {
+    return settings_;
+}
+
+double PricingScheduler::calibration(const OptionPricingModel& model) const {
+    const auto found = secondsPerCost_.find(&model);
+    return found != secondsPerCost_.end() ? found->second : DEFAULT_SECONDS_PER_COST;
+}
+
+void PricingScheduler::clearCalibration() {
+    secondsPerCost_.clear();
+}
+
+SchedulerReport PricingScheduler::run(const std::vector<PricingTask>& tasks, std::vector<PricingTaskResult>& results) {
+    const auto start = std::chrono::steady_clock::now();
+    const std::size_t n = tasks.size();
+    const int threads = settings_.threads > 0 ? settings_.threads : omp_get_max_threads();
+    const bool computeGreeks = settings_.computeGreeks;
+    results.assign(n, PricingTaskResult());
+
+    SchedulerReport report;
+    report.threads = threads;
+    report.threadSeconds.assign(threads, 0.0);
+
+    // Coût estimé de chaque tâche ; les modèles parallèles sont mis à part
+    std::vector<double> hints(n, 0.0);
+    std::vector<double> costs(n, 0.0);
+    std::vector<std::size_t> serial;
+    std::vector<std::size_t> parallel;
+    serial.reserve(n);
+    // Un portefeuille n'utilise que quelques modèles : calibration relue au changement de modèle
+    const OptionPricingModel* previous = nullptr;
+    double secondsPerCost = 0.0;
+    bool internallyParallel = false;
+    for (std::size_t i = 0; i < n; ++i) {
+        const OptionPricingModel* model = tasks[i].model;
+        if (model) {
+            if (model != previous) {
+                previous = model;
+                secondsPerCost = calibration(*model);
+                internallyParallel = model->isInternallyParallel();
+            }
+            hints[i] = model->costHint(tasks[i].option);
+            costs[i] = hints[i] * secondsPerCost;
+        }
+        (model && internallyParallel ? parallel : serial).push_back(i);
+    }
+
+    // Paquets : tâches par coût décroissant, cumulées jusqu'au coût visé
+    std::stable_sort(serial.begin(), serial.end(), [&](std::size_t a, std::size_t b) { return costs[a] > costs[b]; });
+    double total = 0.0;
+    for (std::size_t i : serial) {
+        total += costs[i];
+    }
+    const double target = std::max(total / (static_cast<double>(threads) * settings_.chunksPerThread),
+                                   settings_.minChunkSeconds);
+    std::vector<Chunk> chunks;
+    for (std::size_t begin = 0; begin < serial.size();) {
+        Chunk chunk{begin, begin, 0.0};
+        while (chunk.end < serial.size() && (chunk.end == begin || chunk.cost + costs[serial[chunk.end]] <= target)) {
+            chunk.cost += costs[serial[chunk.end++]];
+        }
+        chunks.push_back(chunk);
+        begin = chunk.end;
+    }
+    report.chunks = chunks.size();
+
+    // Répartition initiale : chaque paquet (du plus lourd au plus léger) va à la file la moins chargée
+    std::vector<WorkerQueue> queues(threads);
+    using Load = std::pair<double, int>;
+    std::priority_queue<Load, std::vector<Load>, std::greater<Load>> loads;
+    for (int t = 0; t < threads; ++t) {
+        loads.push({0.0, t});
+    }
+    for (const Chunk& chunk : chunks) {
+        Load least = loads.top();
+        loads.pop();
+        queues[least.second].chunks.push_back(chunk);
+        least.first += chunk.cost;
+        loads.push(least);
+    }
+
+    std::atomic<std::size_t> steals{0};
+    #pragma omp parallel num_threads(threads) if (!chunks.empty())
+    {
+        // L'équipe obtenue peut être plus petite : les files orphelines sont vidées par vol
+        const int me = omp_get_thread_num();
+        std::uint32_t state = 2654435761u * static_cast<std::uint32_t>(me + 1);
+        double busy = 0.0;
+        while (true) {
+            Chunk chunk{};
+            bool found = false;
+            {
+                std::lock_guard<std::mutex> lock(queues[me].mutex);
+                if (!queues[me].chunks.empty()) {
+                    chunk = queues[me].chunks.front();
+                    queues[me].chunks.pop_front();
+                    found = true;
+                }
+            }
+            if (!found) {
+                // Victimes dans un ordre pseudo-aléatoire propre à chaque thread
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                const int first = static_cast<int>(state % static_cast<std::uint32_t>(threads));
+                for (int k = 0; k < threads && !found; ++k) {
+                    const int victim = (first + k) % threads;
+                    if (victim == me) {
+                        continue;
+                    }
+                    std::lock_guard<std::mutex> lock(queues[victim].mutex);
+                    if (!queues[victim].chunks.empty()) {
+                        chunk = queues[victim].chunks.back();
+                        queues[victim].chunks.pop_back();
+                        found = true;
+                    }
+                }
+                if (!found) {
+                    // Aucune tâche n'est créée en cours de route : toutes les files sont vides
+                    break;
+                }
+                steals.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // Une lecture d'horloge par tâche : la fin de l'une est le début de la suivante
+            const auto chunkStart = std::chrono::steady_clock::now();
+            auto last = chunkStart;
+            for (std::size_t p = chunk.begin; p < chunk.end; ++p) {
+                const std::size_t i = serial[p];
+                execute(tasks[i], computeGreeks, me, results[i]);
+                const auto now = std::chrono::steady_clock::now();
+                results[i].seconds = std::chrono::duration<double>(now - last).count();
+                last = now;
+            }
+            busy += std::chrono::duration<double>(last - chunkStart).count();
+        }
+        report.threadSeconds[me] = busy;
+    }
+    report.steals = steals.load();
+
+    // Modèles parallèles : un à la fois, hors de toute région parallèle
+    for (std::size_t i : parallel) {
+        const auto taskStart = std::chrono::steady_clock::now();
+        execute(tasks[i], computeGreeks, -1, results[i]);
+        results[i].seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - taskStart).count();
+        report.parallelSeconds += results[i].seconds;
+    }
+
+    // Calibration : secondes mesurées par unité de coût, par modèle
+    std::map<const OptionPricingModel*, std::pair<double, double>> measured;
+    previous = nullptr;
+    std::pair<double, double>* sums = nullptr;
+    for (std::size_t i = 0; i < n; ++i) {
+        report.taskSeconds += results[i].seconds;
+        if (!results[i].error.empty()) {
+            ++report.failed;
+        } else if (hints[i] > 0) {
+            if (tasks[i].model != previous) {
+                previous = tasks[i].model;
+                sums = &measured[previous];
+            }
+            sums->first += results[i].seconds;
+            sums->second += hints[i];
+        }
+    }
+    if (secondsPerCost_.size() + measured.size() > MAX_CALIBRATED_MODELS) {
+        secondsPerCost_.clear();
+    }
+    for (const auto& [model, sums] : measured) {
+        const double observed = sums.first / sums.second;
+        const auto found = secondsPerCost_.find(model);
+        secondsPerCost_[model] = found == secondsPerCost_.end() ? observed : 0.5 * (found->second + observed);
+    }
+
+    report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return report;
+}
@@ -0,0 +1,219 @@
+#include "util/PricingServer.hpp"
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+// Intervalle de contrôle de stop() et de la commande "shutdown" pendant l'attente de connexions
+constexpr int POLL_MILLISECONDS = 100;
+
+sockaddr_un socketAddress(const std::string& path) {
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("Socket path must have 1 to " + std::to_string(sizeof(address.sun_path) - 1) +
+                                    " characters: " + path);
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return address;
+}
+
+int connectTo(const std::string& path) {
+    const sockaddr_un address = socketAddress(path);
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Envoi complet ; faux si le pair a fermé la connexion ou cessé de lire (pas de SIGPIPE)
+bool sendAll(int fd, const std::string& data, int flags = 0) {
+    std::size_t sent = 0;
+    while (sent < data.size()) {
+        const ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL | flags);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        sent += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+} // namespace
+
+PricingServer::PricingServer(const ServerSettings& settings, PricingService& service)
+    : settings_(settings), service_(service) {
+    const sockaddr_un address = socketAddress(settings_.socketPath);
+    listenFd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listenFd_ < 0) {
+        throw std::runtime_error("Could not create socket: " + std::string(std::strerror(errno)));
+    }
+
+    bool bound = ::bind(listenFd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+    if (!bound && errno == EADDRINUSE) {
+        // Socket d'un serveur arrêté sans nettoyage : remplacée ; serveur actif ou autre fichier : erreur
+        struct stat info;
+        const int live = connectTo(settings_.socketPath);
+        if (live >= 0) {
+            ::close(live);
+        } else if (::lstat(settings_.socketPath.c_str(), &info) == 0 && S_ISSOCK(info.st_mode)) {
+            ::unlink(settings_.socketPath.c_str());
+            bound = ::bind(listenFd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+        }
+    }
+    if (!bound || ::listen(listenFd_, SOMAXCONN) != 0) {
+        const std::string reason = std::strerror(errno);
+        ::close(listenFd_);
+        throw std::runtime_error("Could not listen on " + settings_.socketPath + ": " + reason);
+    }
+}
+
+PricingServer::~PricingServer() {
+    ::close(listenFd_);
+    ::unlink(settings_.socketPath.c_str());
+}
+
+const std::string& PricingServer::socketPath() const {
+    return settings_.socketPath;
+}
+
+void PricingServer::stop() {
+    stopping_.store(true);
+}
+
+void PricingServer::run() {
+    while (!stopping_.load() && !service_.shutdownRequested()) {
+        pollfd listening{listenFd_, POLLIN, 0};
+        if (::poll(&listening, 1, POLL_MILLISECONDS) <= 0) {
+            continue;  // Délai écoulé ou signal
+        }
+        const int fd = ::accept4(listenFd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (fd < 0) {
+            continue;
+        }
+        // Un pair qui ne lit plus fait échouer l'envoi au lieu de bloquer son thread (et l'arrêt)
+        const timeval timeout{static_cast<time_t>(settings_.sendTimeoutMilliseconds / 1000),
+                              static_cast<suseconds_t>(settings_.sendTimeoutMilliseconds % 1000 * 1000)};
+        ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        bool refused;
+        {
+            std::lock_guard<std::mutex> lock(connectionsMutex_);
+            refused = connections_.size() >= settings_.maxConnections;
+            if (!refused) {
+                connections_.insert(fd);
+                std::thread(&PricingServer::serve, this, fd).detach();
+            }
+        }
+        if (refused) {
+            // Hors verrou et sans attente : un client refusé ne peut bloquer ni accept ni les connexions servies
+            sendAll(fd, "{\"status\":\"error\",\"error\":\"too many connections (" +
+                            std::to_string(settings_.maxConnections) + ")\"}\n", MSG_DONTWAIT);
+            ::close(fd);
+        }
+    }
+
+    // Plus de nouvelle requête : chaque connexion termine celle en cours puis se ferme ;
+    // une réponse qu'un pair ne lit plus échoue après sendTimeoutMilliseconds
+    std::unique_lock<std::mutex> lock(connectionsMutex_);
+    for (int fd : connections_) {
+        ::shutdown(fd, SHUT_RD);
+    }
+    connectionsDone_.wait(lock, [this]() { return connections_.empty(); });
+}
+
+void PricingServer::serve(int fd) {
+    std::string buffer;
+    std::size_t start = 0;  // Début de la prochaine ligne dans buffer
+    char chunk[1 << 16];
+    while (true) {
+        const std::size_t newline = buffer.find('\n', start);
+        if (newline == std::string::npos) {
+            buffer.erase(0, start);
+            start = 0;
+            if (buffer.size() > settings_.maxRequestBytes) {
+                sendAll(fd, "{\"status\":\"error\",\"error\":\"request exceeds " +
+                                std::to_string(settings_.maxRequestBytes) + " bytes\"}\n");
+                break;
+            }
+            const ssize_t received = ::recv(fd, chunk, sizeof(chunk), 0);
+            if (received < 0 && errno == EINTR) {
+                continue;
+            }
+            if (received <= 0) {
+                break;
+            }
+            buffer.append(chunk, static_cast<std::size_t>(received));
+            continue;
+        }
+
+        std::size_t end = newline;
+        if (end > start && buffer[end - 1] == '\r') {
+            --end;
+        }
+        const std::string line = buffer.substr(start, end - start);
+        start = newline + 1;
+        if (line.find_first_not_of(" \t") == std::string::npos) {
+            continue;
+        }
+        if (!sendAll(fd, service_.handle(line) + '\n')) {
+            break;
+        }
+    }
+
+    // Fermeture sous verrou : le numéro ne peut être réattribué par accept qu'une fois retiré
+    std::lock_guard<std::mutex> lock(connectionsMutex_);
+    connections_.erase(fd);
+    ::close(fd);
+    connectionsDone_.notify_all();
+}
+
+PricingClient::PricingClient(const std::string& socketPath) : fd_(connectTo(socketPath)) {
+    if (fd_ < 0) {
+        throw std::runtime_error("Could not connect to pricing server at " + socketPath + ": " +
+                                 std::strerror(errno));
+    }
+}
+
+PricingClient::~PricingClient() {
+    ::close(fd_);
+}
+
+std::string PricingClient::request(const std::string& line) {
+    if (line.find('\n') != std::string::npos) {
+        throw std::invalid_argument("A request must fit on a single line");
+    }
+    if (!sendAll(fd_, line + '\n')) {
+        throw std::runtime_error("Connection closed by the pricing server");
+    }
+    char chunk[1 << 16];
+    std::size_t newline;
+    while ((newline = buffer_.find('\n')) == std::string::npos) {
+        const ssize_t received = ::recv(fd_, chunk, sizeof(chunk), 0);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            throw std::runtime_error("Connection closed by the pricing server");
+        }
+        buffer_.append(chunk, static_cast<std::size_t>(received));
+    }
+    std::string reply = buffer_.substr(0, newline);
+    buffer_.erase(0, newline + 1);
+    return reply;
+}
@@ -0,0 +1,355 @@
+#include "util/PricingService.hpp"
+#include "Factory/PricingModelFactory.hpp"
+#include "domain/Option.hpp"
+#include "models/CachedPricingModel.hpp"
+#include "util/GreeksCalculator.hpp"
+#include <chrono>
+#include <future>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+#include <omp.h>
+
+namespace {
+
+SchedulerSettings schedulerSettings(const ServiceSettings& settings, bool computeGreeks) {
+    SchedulerSettings scheduler;
+    scheduler.threads = settings.threads;
+    scheduler.computeGreeks = computeGreeks;
+    return scheduler;
+}
+
+double requiredNumber(const JsonValue& object, const char* key) {
+    const JsonValue* value = object.find(key);
+    if (!value || !value->isNumber()) {
+        throw std::invalid_argument(std::string("missing or non-numeric '") + key + "'");
+    }
+    return value->number;
+}
+
+bool optionalFlag(const JsonValue& object, const char* key, bool fallback) {
+    const JsonValue* value = object.find(key);
+    if (!value || value->isNull()) {
+        return fallback;
+    }
+    if (value->type != JsonValue::Type::Bool) {
+        throw std::invalid_argument(std::string("'") + key + "' must be true or false");
+    }
+    return value->boolean;
+}
+
+std::string optionalText(const JsonValue& object, const char* key, const std::string& fallback) {
+    const JsonValue* value = object.find(key);
+    if (!value || value->isNull()) {
+        return fallback;
+    }
+    if (!value->isString()) {
+        throw std::invalid_argument(std::string("'") + key + "' must be a string");
+    }
+    return value->string;
+}
+
+// Mêmes règles que la ligne de commande : constructeur d'Option
+OptionSpec parseOption(const JsonValue& object) {
+    if (!object.isObject()) {
+        throw std::invalid_argument("an option must be a JSON object");
+    }
+    const JsonValue* type = object.find("type");
+    if (!type || !type->isString()) {
+        throw std::invalid_argument("missing or non-text 'type' (call or put)");
+    }
+    return Option(requiredNumber(object, "spot"), requiredNumber(object, "strike"), requiredNumber(object, "rate"),
+                  requiredNumber(object, "volatility"), requiredNumber(object, "maturity"), type->string)
+        .spec();
+}
+
+void appendId(std::string& out, const JsonValue* id) {
+    if (id) {
+        out += "\"id\":";
+        appendJson(out, *id);
+        out += ',';
+    }
+}
+
+void appendField(std::string& out, const char* name, double value) {
+    out += '"';
+    out += name;
+    out += "\":";
+    appendJsonNumber(out, value);
+    out += ',';
+}
+
+void appendGreeks(std::string& out, const Greeks& g, bool withGreeks) {
+    appendField(out, "price", g.price);
+    if (withGreeks) {
+        appendField(out, "delta", g.delta);
+        appendField(out, "gamma", g.gamma);
+        appendField(out, "vega", g.vega);
+        appendField(out, "theta", g.theta);
+        appendField(out, "rho", g.rho);
+    }
+    out += "\"status\":\"ok\"";
+}
+
+void appendError(std::string& out, const std::string& message) {
+    out += "\"status\":\"error\",\"error\":";
+    appendJsonString(out, message);
+}
+
+} // namespace
+
+PricingService::PricingService(const ServiceSettings& settings)
+    : settings_(settings),
+      priceScheduler_(schedulerSettings(settings, false)),
+      greeksScheduler_(schedulerSettings(settings, true)) {
+    pricingThread_ = std::thread(&PricingService::pricingLoop, this);
+    try {
+        // Modèle par défaut validé et équipe OpenMP du thread de pricing démarrée avant la première requête
+        runOnPricingThread([this]() {
+            model(settings_.defaultModel);
+            const int threads = settings_.threads > 0 ? settings_.threads : omp_get_max_threads();
+            #pragma omp parallel num_threads(threads)
+            {
+            }
+        });
+    } catch (...) {
+        stopPricingThread();
+        throw;
+    }
+}
+
+PricingService::~PricingService() {
+    stopPricingThread();
+}
+
+void PricingService::stopPricingThread() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        stopping_ = true;
+    }
+    queueReady_.notify_one();
+    if (pricingThread_.joinable()) {
+        pricingThread_.join();
+    }
+}
+
+void PricingService::pricingLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex_);
+            queueReady_.wait(lock, [this]() { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        task();
+    }
+}
+
+void PricingService::runOnPricingThread(const std::function<void()>& task) {
+    std::packaged_task<void()> job(task);
+    std::future<void> done = job.get_future();
+    {
+        std::lock_guard<std::mutex> lock(queueMutex_);
+        // packaged_task n'est pas copiable : la file garde un pointeur, vivant jusqu'à done.get()
+        queue_.push_back([&job]() { job(); });
+    }
+    queueReady_.notify_one();
+    done.get();
+}
+
+const ServiceSettings& PricingService::getSettings() const {
+    return settings_;
+}
+
+bool PricingService::shutdownRequested() const {
+    return shutdown_.load();
+}
+
+ServiceStats PricingService::stats() const {
+    ServiceStats stats;
+    stats.requests = requests_.load();
+    stats.options = options_.load();
+    stats.failed = failed_.load();
+    return stats;
+}
+
+void PricingService::beginRequest() {
+    ++request_;
+}
+
+const OptionPricingModel* PricingService::model(const std::string& spec) {
+    const auto found = models_.find(spec);
+    if (found != models_.end()) {
+        found->second.request = request_;
+        return found->second.model.get();
+    }
+    if (models_.size() >= MAX_CACHED_MODELS) {
+        // Seuls les modèles de requêtes précédentes peuvent être libérés : aucun pointeur ne les désigne plus
+        for (auto it = models_.begin(); it != models_.end();) {
+            it = it->second.request != request_ ? models_.erase(it) : std::next(it);
+        }
+        // Les adresses libérées peuvent être réattribuées à d'autres modèles
+        priceScheduler_.clearCalibration();
+        greeksScheduler_.clearCalibration();
+        if (models_.size() >= MAX_CACHED_MODELS) {
+            throw std::invalid_argument("more than " + std::to_string(MAX_CACHED_MODELS) +
+                                        " distinct models in one request");
+        }
+    }
+    std::unique_ptr<OptionPricingModel> created;
+    try {
+        created = PricingModelFactory::createModelFromSpec(spec);
+    } catch (const std::exception& e) {
+        throw std::invalid_argument(std::string("model '") + spec + "': " + e.what());
+    }
+    if (!created) {
+        throw std::invalid_argument("unknown model '" + spec + "'");
+    }
+    if (settings_.cache && CachedPricingModel::isWorthCaching(*created)) {
+        created = std::make_unique<CachedPricingModel>(std::shared_ptr<const OptionPricingModel>(std::move(created)),
+                                                       settings_.cache, spec);
+    }
+    return models_.emplace(spec, CachedModel{std::move(created), request_}).first->second.model.get();
+}
+
+std::string PricingService::handle(const std::string& request) {
+    requests_.fetch_add(1, std::memory_order_relaxed);
+    std::string out;
+    JsonValue parsed;
+    const JsonValue* id = nullptr;
+    try {
+        parsed = parseJson(request);
+        if (!parsed.isObject()) {
+            throw std::invalid_argument("a request must be a JSON object");
+        }
+        id = parsed.find("id");
+        if (id && !id->isNumber() && !id->isString()) {
+            id = nullptr;
+            throw std::invalid_argument("'id' must be a number or a string");
+        }
+
+        out += '{';
+        appendId(out, id);
+        if (parsed.find("command")) {
+            command(optionalText(parsed, "command", ""), out);
+        } else if (parsed.find("options")) {
+            runOnPricingThread([&]() { priceBatch(parsed, out); });
+        } else {
+            runOnPricingThread([&]() { priceOne(parsed, out); });
+            options_.fetch_add(1, std::memory_order_relaxed);
+        }
+        out += '}';
+    } catch (const std::exception& e) {
+        failed_.fetch_add(1, std::memory_order_relaxed);
+        out = "{";
+        appendId(out, id);
+        appendError(out, e.what());
+        out += '}';
+    }
+    return out;
+}
+
+void PricingService::priceOne(const JsonValue& request, std::string& out) {
+    beginRequest();
+    const OptionSpec option = parseOption(request);
+    const bool withGreeks = optionalFlag(request, "greeks", false);
+    const OptionPricingModel* pricer = model(optionalText(request, "model", settings_.defaultModel));
+    Greeks g;
+    if (withGreeks) {
+        g = GreeksCalculator::greeks(*pricer, option);
+    } else {
+        g.price = pricer->calculatePrice(option);
+    }
+    appendGreeks(out, g, withGreeks);
+}
+
+void PricingService::priceBatch(const JsonValue& request, std::string& out) {
+    const auto start = std::chrono::steady_clock::now();
+    beginRequest();
+    const JsonValue* options = request.find("options");
+    if (!options->isArray()) {
+        throw std::invalid_argument("'options' must be an array");
+    }
+    const std::string defaultModel = optionalText(request, "model", settings_.defaultModel);
+    const bool withGreeks = optionalFlag(request, "greeks", false);
+    const std::size_t n = options->values.size();
+
+    // Les options invalides reçoivent leur erreur sans être confiées à l'ordonnanceur
+    std::vector<std::string> errors(n);
+    std::vector<PricingTask> tasks;
+    std::vector<std::size_t> taskIndex;
+    tasks.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const JsonValue& item = options->values[i];
+        try {
+            tasks.push_back({parseOption(item), model(optionalText(item, "model", defaultModel))});
+            taskIndex.push_back(i);
+        } catch (const std::exception& e) {
+            errors[i] = e.what();
+        }
+    }
+
+    std::vector<PricingTaskResult> results;
+    (withGreeks ? greeksScheduler_ : priceScheduler_).run(tasks, results);
+
+    std::vector<const Greeks*> greeks(n, nullptr);
+    for (std::size_t t = 0; t < tasks.size(); ++t) {
+        if (results[t].error.empty()) {
+            greeks[taskIndex[t]] = &results[t].greeks;
+        } else {
+            errors[taskIndex[t]] = results[t].error;
+        }
+    }
+
+    std::uint64_t failed = 0;
+    out += "\"results\":[";
+    for (std::size_t i = 0; i < n; ++i) {
+        out += i > 0 ? ",{" : "{";
+        const JsonValue* itemId = options->values[i].find("id");
+        appendId(out, itemId && (itemId->isNumber() || itemId->isString()) ? itemId : nullptr);
+        if (greeks[i]) {
+            appendGreeks(out, *greeks[i], withGreeks);
+        } else {
+            ++failed;
+            appendError(out, errors[i]);
+        }
+        out += '}';
+    }
+    out += "],";
+    options_.fetch_add(n, std::memory_order_relaxed);
+    failed_.fetch_add(failed, std::memory_order_relaxed);
+
+    appendField(out, "failed", static_cast<double>(failed));
+    appendField(out, "seconds", std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    out += "\"status\":\"ok\"";
+}
+
+void PricingService::command(const std::string& name, std::string& out) {
+    if (name == "stats") {
+        const ServiceStats service = stats();
+        appendField(out, "requests", static_cast<double>(service.requests));
+        appendField(out, "options", static_cast<double>(service.options));
+        appendField(out, "failed", static_cast<double>(service.failed));
+        if (settings_.cache) {
+            const CacheStats cache = settings_.cache->stats();
+            out += "\"cache\":{";
+            appendField(out, "hits", static_cast<double>(cache.hits));
+            appendField(out, "misses", static_cast<double>(cache.misses));
+            appendField(out, "entries", static_cast<double>(cache.entries));
+            appendField(out, "capacity", static_cast<double>(cache.capacity));
+            appendField(out, "evictions", static_cast<double>(cache.evictions));
+            out += "\"hitRate\":";
+            appendJsonNumber(out, cache.hitRate());
+            out += "},";
+        }
+    } else if (name == "shutdown") {
+        shutdown_.store(true);
+    } else {
+        throw std::invalid_argument("unknown command '" + name + "' (expected stats or shutdown)");
+    }
+    out += "\"status\":\"ok\"";
+}
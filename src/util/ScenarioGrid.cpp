@@ -0,0 +1,261 @@
+#include "util/ScenarioGrid.hpp"
+#include "util/GreeksCalculator.hpp"
+#include "util/CsvFormat.hpp"
+#include "models/BlackScholesModel.hpp"
+#include "models/FiniteDifferenceModel.hpp"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <ostream>
+#include <stdexcept>
+#include <omp.h>
+
+namespace {
+
+// Pas des résolutions décalées, comme GreeksCalculator pour les différences finies
+constexpr double FD_DELTA_SIGMA = 0.0001;
+constexpr double FD_DELTA_R = 0.0001;
+
+// La grille PDE couvre [0, S_max] avec S_max >= 1.5 S_0 : le spot de résolution
+// est celui de l'option, relevé si besoin pour couvrir le plus grand spot de l'axe
+constexpr double FD_SPOT_COVERAGE = 1.5;
+
+const std::vector<double>& axisOr(const std::vector<double>& axis, std::vector<double>& fallback, double value) {
+    if (!axis.empty()) {
+        return axis;
+    }
+    fallback.assign(1, value);
+    return fallback;
+}
+
+// Tranche (taux, maturité, volatilité) : tous les spots d'une même résolution PDE
+void evaluateFiniteDifferenceSlice(const FiniteDifferenceModel& model, const OptionSpec& slice,
+                                   const std::vector<double>& spots, double maxSpot, ScenarioPoint* out) {
+    const OptionSpec base = slice.withSpot(std::max(slice.spot, maxSpot / FD_SPOT_COVERAGE));
+    const FiniteDifferenceSolution solution = model.solve(base);
+    const FiniteDifferenceSolution rateUp = model.solve(base.withRate(base.rate + FD_DELTA_R));
+    const FiniteDifferenceSolution rateDown = model.solve(base.withRate(base.rate - FD_DELTA_R));
+
+    // Volatilité locale : la volatilité de l'option est ignorée, vega est nul
+    const bool constantVolatility = !model.getLocalVolatility();
+    std::vector<double> volUp, volDown;
+    if (constantVolatility) {
+        const FiniteDifferenceSolution up = model.solve(base.withVol(base.volatility + FD_DELTA_SIGMA));
+        const FiniteDifferenceSolution down = model.solve(base.withVol(base.volatility - FD_DELTA_SIGMA));
+        volUp.reserve(spots.size());
+        volDown.reserve(spots.size());
+        for (double s : spots) {
+            volUp.push_back(up.price(s));
+            volDown.push_back(down.price(s));
+        }
+    }
+
+    for (std::size_t i = 0; i < spots.size(); ++i) {
+        const double s = spots[i];
+        ScenarioPoint& point = out[i];
+        point.option = slice.withSpot(s);
+        point.greeks = solution.greeks(s);
+        point.greeks.rho = (rateUp.price(s) - rateDown.price(s)) / (2.0 * FD_DELTA_R);
+        point.greeks.vega = constantVolatility ? (volUp[i] - volDown[i]) / (2.0 * FD_DELTA_SIGMA) : 0.0;
+    }
+}
+
+Greeks evaluatePoint(const OptionPricingModel& model, const BlackScholesModel* blackScholes,
+                     const OptionSpec& option) {
+    if (blackScholes) {
+        return GreeksCalculator::greeks(*blackScholes, option);
+    }
+    return GreeksCalculator::greeks(model, option);
+}
+
+} // namespace
+
+// ------------------------------------------
+// ScenarioAxes
+// ------------------------------------------
+
+std::vector<double> ScenarioAxes::linspace(double first, double last, int points) {
+    if (points < 1) {
+        throw std::invalid_argument("ScenarioAxes::linspace : au moins un point");
+    }
+    std::vector<double> values(points, first);
+    for (int i = 1; i < points; ++i) {
+        values[i] = first + i * (last - first) / (points - 1);
+    }
+    if (points > 1) {
+        values.back() = last;
+    }
+    return values;
+}
+
+ScenarioAxes ScenarioAxes::spotProfile(const OptionSpec& option, int points) {
+    ScenarioAxes axes;
+    axes.spots = linspace(0.5 * option.strike, 1.5 * option.strike, points);
+    return axes;
+}
+
+// ------------------------------------------
+// Puits
+// ------------------------------------------
+
+CsvScenarioSink::CsvScenarioSink(std::ostream& out, bool spotOnly) : out_(out), spotOnly_(spotOnly) {
+    if (spotOnly_) {
+        out_ << std::fixed << std::setprecision(6);
+        out_ << "Spot,Price,Delta,Gamma,Theta,Rho,Vega\n";
+    } else {
+        out_ << "Spot,Volatility,Maturity,Rate,Price,Delta,Gamma,Theta,Rho,Vega,Vanna,Volga,Charm\n";
+    }
+}
+
+void CsvScenarioSink::write(const ScenarioPoint* points, std::size_t count) {
+    if (spotOnly_) {
+        for (std::size_t i = 0; i < count; ++i) {
+            const Greeks& g = points[i].greeks;
+            out_ << points[i].option.spot << "," << g.price << "," << g.delta << "," << g.gamma << ","
+                 << g.theta << "," << g.rho << "," << g.vega << "\n";
+        }
+    } else {
+        // Nombres au plus court pour une relecture exacte, comme le mode portefeuille
+        std::string text;
+        for (std::size_t i = 0; i < count; ++i) {
+            const OptionSpec& o = points[i].option;
+            const Greeks& g = points[i].greeks;
+            const double row[] = {o.spot, o.volatility, o.maturity, o.rate, g.price, g.delta, g.gamma,
+                                  g.theta, g.rho, g.vega, g.vanna, g.volga, g.charm};
+            for (std::size_t c = 0; c < sizeof(row) / sizeof(row[0]); ++c) {
+                if (c > 0) {
+                    text += ',';
+                }
+                appendShortest(text, row[c]);
+            }
+            text += '\n';
+        }
+        out_ << text;
+    }
+    if (!out_) {
+        throw std::runtime_error("CsvScenarioSink : échec d'écriture");
+    }
+}
+
+ColumnSchema ColumnarScenarioSink::schema() {
+    ColumnSchema columns;
+    for (const char* name : {"spot", "volatility", "maturity", "rate", "price", "delta", "gamma", "theta",
+                             "rho", "vega", "vanna", "volga", "charm"}) {
+        columns.push_back(ColumnDescriptor{name, ColumnType::Float64});
+    }
+    return columns;
+}
+
+ColumnarScenarioSink::ColumnarScenarioSink(const std::string& path)
+    : writer_(path, schema()), columns_(schema().size()) {}
+
+void ColumnarScenarioSink::write(const ScenarioPoint* points, std::size_t count) {
+    for (auto& column : columns_) {
+        column.resize(count);
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        const OptionSpec& o = points[i].option;
+        const Greeks& g = points[i].greeks;
+        const double row[] = {o.spot, o.volatility, o.maturity, o.rate, g.price, g.delta, g.gamma,
+                              g.theta, g.rho, g.vega, g.vanna, g.volga, g.charm};
+        for (std::size_t c = 0; c < columns_.size(); ++c) {
+            columns_[c][i] = row[c];
+        }
+    }
+    std::vector<const void*> pointers;
+    for (const auto& column : columns_) {
+        pointers.push_back(column.data());
+    }
+    writer_.append(count, pointers.data());
+}
+
+void ColumnarScenarioSink::close() {
+    writer_.close();
+}
+
+// ------------------------------------------
+// ScenarioGridEngine
+// ------------------------------------------
+
+ScenarioGridEngine::ScenarioGridEngine(const ScenarioSettings& settings) : settings_(settings) {}
+
+const ScenarioSettings& ScenarioGridEngine::getSettings() const {
+    return settings_;
+}
+
+ScenarioReport ScenarioGridEngine::run(const OptionPricingModel& model, const OptionSpec& option,
+                                       const ScenarioAxes& axes, ScenarioSink& sink) const {
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<double> spotFallback, volFallback, maturityFallback, rateFallback;
+    const std::vector<double>& spots = axisOr(axes.spots, spotFallback, option.spot);
+    const std::vector<double>& vols = axisOr(axes.volatilities, volFallback, option.volatility);
+    const std::vector<double>& maturities = axisOr(axes.maturities, maturityFallback, option.maturity);
+    const std::vector<double>& rates = axisOr(axes.rates, rateFallback, option.rate);
+
+    const auto* finiteDifference = dynamic_cast<const FiniteDifferenceModel*>(&model);
+    const auto* blackScholes = dynamic_cast<const BlackScholesModel*>(&model);
+    const double maxSpot = *std::max_element(spots.begin(), spots.end());
+
+    ScenarioReport report;
+    report.slices = rates.size() * maturities.size() * vols.size();
+    report.points = report.slices * spots.size();
+
+    // Tranche numéro 'index' : taux, puis maturité, puis volatilité
+    auto sliceOption = [&](std::size_t index) {
+        const std::size_t v = index % vols.size();
+        const std::size_t t = (index / vols.size()) % maturities.size();
+        const std::size_t r = index / (vols.size() * maturities.size());
+        return option.withVol(vols[v]).withMaturity(maturities[t]).withRate(rates[r]);
+    };
+
+    // Blocs de tranches entières, écrits dans l'ordre une fois calculés
+    const std::size_t slicesPerBlock = std::max<std::size_t>(1, settings_.blockPoints / spots.size());
+    const int threads = settings_.threads > 0 ? settings_.threads : omp_get_max_threads();
+    const bool parallel = !model.isInternallyParallel();
+    std::vector<ScenarioPoint> buffer;
+
+    for (std::size_t first = 0; first < report.slices; first += slicesPerBlock) {
+        const std::size_t slices = std::min(slicesPerBlock, report.slices - first);
+        buffer.resize(slices * spots.size());
+        std::exception_ptr failure;
+
+        if (finiteDifference) {
+            #pragma omp parallel for schedule(dynamic) num_threads(threads) if(parallel && slices > 1)
+            for (std::size_t k = 0; k < slices; ++k) {
+                try {
+                    evaluateFiniteDifferenceSlice(*finiteDifference, sliceOption(first + k), spots, maxSpot,
+                                                  buffer.data() + k * spots.size());
+                } catch (...) {
+                    #pragma omp critical(scenario_failure)
+                    if (!failure) {
+                        failure = std::current_exception();
+                    }
+                }
+            }
+        } else {
+            const std::size_t count = buffer.size();
+            #pragma omp parallel for schedule(dynamic, 4) num_threads(threads) if(parallel && count > 1)
+            for (std::size_t i = 0; i < count; ++i) {
+                try {
+                    ScenarioPoint& point = buffer[i];
+                    point.option = sliceOption(first + i / spots.size()).withSpot(spots[i % spots.size()]);
+                    point.greeks = evaluatePoint(model, blackScholes, point.option);
+                } catch (...) {
+                    #pragma omp critical(scenario_failure)
+                    if (!failure) {
+                        failure = std::current_exception();
+                    }
+                }
+            }
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        sink.write(buffer.data(), buffer.size());
+    }
+
+    report.solves = finiteDifference ? report.slices * (finiteDifference->getLocalVolatility() ? 3 : 5) : 0;
+    report.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return report;
+}
@@ -0,0 +1,168 @@
+#include "util/SobolSequence.hpp"
+#include "util/Philox.hpp"
+#include <stdexcept>
+
+namespace {
+
+// Entrée de la table de Joe et Kuo : degré s, coefficients a, valeurs initiales m_1..m_s
+struct DirectionEntry {
+    int s;
+    unsigned a;
+    unsigned m[7];
+};
+
+// Dimensions 2 à 21 (la première dimension est la suite de van der Corput)
+const DirectionEntry JOE_KUO[] = {
+    {1, 0,  {1}},
+    {2, 1,  {1, 3}},
+    {3, 1,  {1, 3, 1}},
+    {3, 2,  {1, 1, 1}},
+    {4, 1,  {1, 1, 3, 3}},
+    {4, 4,  {1, 3, 5, 13}},
+    {5, 2,  {1, 1, 5, 5, 17}},
+    {5, 4,  {1, 1, 5, 5, 5}},
+    {5, 7,  {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1,  {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1,  {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4,  {1, 3, 7, 13, 13, 15, 69}},
+};
+
+// Polynôme x^s + a_1 x^(s-1) + ... + a_(s-1) x + 1 sous forme de bits
+unsigned polynomialBits(int s, unsigned a) {
+    return (1u << s) | (a << 1) | 1u;
+}
+
+// Vrai si le polynôme de degré s est primitif sur GF(2) (x d'ordre 2^s - 1)
+bool isPrimitive(int s, unsigned a) {
+    const unsigned p = polynomialBits(s, a);
+    const unsigned period = (1u << s) - 1;
+    unsigned x = 1;
+    for (unsigned k = 1; k <= period; ++k) {
+        x <<= 1;
+        if (x & (1u << s)) {
+            x ^= p;
+        }
+        if (x == 1) {
+            return k == period;
+        }
+    }
+    return false;
+}
+
+// Nombres directeurs v_1..v_32 d'une dimension à partir de (s, a, m)
+void fillDirections(int s, unsigned a, const unsigned* m, std::uint32_t* v) {
+    const int bits = SobolSequence::BITS;
+    for (int k = 0; k < s && k < bits; ++k) {
+        v[k] = m[k] << (bits - 1 - k);
+    }
+    for (int k = s; k < bits; ++k) {
+        std::uint32_t value = v[k - s] ^ (v[k - s] >> s);
+        for (int i = 1; i < s; ++i) {
+            if ((a >> (s - 1 - i)) & 1u) {
+                value ^= v[k - i];
+            }
+        }
+        v[k] = value;
+    }
+}
+
+} // namespace
+
+SobolSequence::SobolSequence(int dimensions)
+    : dimensions_(dimensions), directions_(static_cast<std::size_t>(dimensions) * BITS, 0) {
+    if (dimensions <= 0) {
+        throw std::invalid_argument("SobolSequence: dimensions must be positive");
+    }
+
+    // Première dimension : v_k = 2^(32 - k)
+    for (int k = 0; k < BITS; ++k) {
+        directions_[k] = 1u << (BITS - 1 - k);
+    }
+
+    // Dimensions de la table de Joe et Kuo
+    int d = 1;
+    for (; d < dimensions_ && d < JOE_KUO_DIMENSIONS; ++d) {
+        const DirectionEntry& e = JOE_KUO[d - 1];
+        fillDirections(e.s, e.a, e.m, &directions_[static_cast<std::size_t>(d) * BITS]);
+    }
+
+    // Dimensions supplémentaires : polynômes primitifs suivants, m_i déterministes
+    const Philox4x32 generator(0x50B01);
+    int s = 7;
+    unsigned a = 4;
+    while (d < dimensions_) {
+        ++a;
+        if (a >= (1u << (s - 1))) {
+            ++s;
+            a = 0;
+        }
+        if (s > BITS) {
+            throw std::invalid_argument("SobolSequence: too many dimensions");
+        }
+        if (!isPrimitive(s, a)) {
+            continue;
+        }
+        unsigned m[BITS];
+        for (int i = 0; i < s; ++i) {
+            std::uint32_t words[4];
+            generator.generate(static_cast<std::uint32_t>(d), static_cast<std::uint32_t>(i), 0, 0, words);
+            m[i] = (words[0] & ((1u << (i + 1)) - 1)) | 1u; // Impair et < 2^(i+1)
+        }
+        fillDirections(s, a, m, &directions_[static_cast<std::size_t>(d) * BITS]);
+        ++d;
+    }
+}
+
+int SobolSequence::dimensions() const {
+    return dimensions_;
+}
+
+void SobolSequence::point(std::uint64_t index, std::uint32_t* out) const {
+    if (index >> BITS) {
+        throw std::out_of_range("SobolSequence: index exceeds 2^32 points");
+    }
+    const std::uint64_t gray = index ^ (index >> 1);
+    for (int d = 0; d < dimensions_; ++d) {
+        const std::uint32_t* v = &directions_[static_cast<std::size_t>(d) * BITS];
+        std::uint32_t x = 0;
+        for (int k = 0; k < BITS; ++k) {
+            if ((gray >> k) & 1u) {
+                x ^= v[k];
+            }
+        }
+        out[d] = x;
+    }
+}
+
+void SobolSequence::generate(std::uint64_t first, std::size_t count, int dimension, std::uint32_t* out) const {
+    if (count == 0) {
+        return;
+    }
+    if ((first + count - 1) >> BITS) {
+        throw std::out_of_range("SobolSequence: index exceeds 2^32 points");
+    }
+    const std::uint32_t* v = &directions_[static_cast<std::size_t>(dimension) * BITS];
+
+    // Premier point calculé directement, puis récurrence de Gray (Antonov-Saleev)
+    const std::uint64_t gray = first ^ (first >> 1);
+    std::uint32_t x = 0;
+    for (int k = 0; k < BITS; ++k) {
+        if ((gray >> k) & 1u) {
+            x ^= v[k];
+        }
+    }
+    out[0] = x;
+    for (std::size_t i = 1; i < count; ++i) {
+        const std::uint64_t n = first + i;
+        x ^= v[__builtin_ctzll(n)];
+        out[i] = x;
+    }
+}
@@ -0,0 +1,72 @@
+#include "util/SpotGrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+int buildSpotGrid(GridType type, double sMax, int intervals, double center, double spot,
+                  std::vector<double>& nodes, double concentration) {
+    if (intervals < 2 || sMax <= 0) {
+        throw std::invalid_argument("buildSpotGrid: at least two intervals and a positive sMax are required");
+    }
+    if (spot <= 0 || spot >= sMax) {
+        throw std::out_of_range("buildSpotGrid: spot must lie inside (0, sMax)");
+    }
+    const int M = intervals;
+    nodes.resize(M + 1);
+
+    if (type == GridType::Uniform) {
+        const double ds = sMax / M;
+        for (int i = 0; i <= M; ++i) {
+            nodes[i] = i * ds;
+        }
+        return std::min(static_cast<int>(spot / ds), M - 1);
+    }
+
+    if (center <= 0 || concentration <= 0) {
+        throw std::invalid_argument("buildSpotGrid: center and concentration must be positive");
+    }
+    const double alpha = concentration * center;
+    const double c1 = std::asinh(-center / alpha);
+    const double c2 = std::asinh((sMax - center) / alpha);
+    const auto map = [&](double u) { return center + alpha * std::sinh(c1 + (c2 - c1) * u); };
+
+    // Coordonnée du spot, puis pas uniformes en u de chaque côté du noeud du spot
+    const double uSpot = (std::asinh((spot - center) / alpha) - c1) / (c2 - c1);
+    const int k = std::clamp(static_cast<int>(std::lround(uSpot * M)), 1, M - 1);
+    for (int i = 0; i <= k; ++i) {
+        nodes[i] = map(uSpot * i / k);
+    }
+    for (int i = k + 1; i <= M; ++i) {
+        nodes[i] = map(uSpot + (1.0 - uSpot) * (i - k) / (M - k));
+    }
+    nodes[0] = 0.0;
+    nodes[k] = spot;
+    nodes[M] = sMax;
+    return k;
+}
+
+void blackScholesOperator(const std::vector<double>& nodes, double sigma, double rate,
+                          double* lower, double* diagonal, double* upper) {
+    const int M = static_cast<int>(nodes.size()) - 1;
+    for (int i = 1; i < M; ++i) {
+        const double S = nodes[i];
+        const double hDown = S - nodes[i - 1];
+        const double hUp = nodes[i + 1] - S;
+        const double hSum = hDown + hUp;
+
+        const double diffusion = 0.5 * sigma * sigma * S * S;
+        const double drift = rate * S;
+
+        // V' ~ d1l V_{i-1} + d1c V_i + d1u V_{i+1}, V'' ~ d2l V_{i-1} + d2c V_i + d2u V_{i+1}
+        const double d1l = -hUp / (hDown * hSum);
+        const double d1c = (hUp - hDown) / (hDown * hUp);
+        const double d1u = hDown / (hUp * hSum);
+        const double d2l = 2.0 / (hDown * hSum);
+        const double d2c = -2.0 / (hDown * hUp);
+        const double d2u = 2.0 / (hUp * hSum);
+
+        lower[i - 1] = diffusion * d2l + drift * d1l;
+        diagonal[i - 1] = diffusion * d2c + drift * d1c - rate;
+        upper[i - 1] = diffusion * d2u + drift * d1u;
+    }
+}
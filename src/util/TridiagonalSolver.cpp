@@ -0,0 +1,71 @@
+#include "util/TridiagonalSolver.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+void TridiagonalSolver::factorize(const double* lower, const double* diagonal, const double* upper, int n) {
+    if (n <= 0) {
+        throw std::invalid_argument("TridiagonalSolver: size must be positive");
+    }
+    size_ = n;
+    lower_.resize(n);
+    upper_.resize(n);
+    inversePivot_.resize(n);
+
+    double previousUpper = 0.0;
+    for (int i = 0; i < n; ++i) {
+        const double a = i > 0 ? lower[i] : 0.0;
+        const double pivot = diagonal[i] - a * previousUpper;
+        if (pivot == 0.0 || !std::isfinite(pivot)) {
+            throw std::runtime_error("Échec de la décomposition LU tridiagonale");
+        }
+        inversePivot_[i] = 1.0 / pivot;
+        lower_[i] = a * inversePivot_[i];
+        upper_[i] = i + 1 < n ? upper[i] * inversePivot_[i] : 0.0;
+        previousUpper = upper_[i];
+    }
+}
+
+void TridiagonalSolver::solve(double* x) const {
+    // Descente : une seule opération dépendante de x[i - 1] par ligne
+    x[0] *= inversePivot_[0];
+    for (int i = 1; i < size_; ++i) {
+        x[i] = x[i] * inversePivot_[i] - lower_[i] * x[i - 1];
+    }
+    // Remontée
+    for (int i = size_ - 2; i >= 0; --i) {
+        x[i] -= upper_[i] * x[i + 1];
+    }
+}
+
+void TridiagonalSolver::solveProjected(double* x, const double* obstacle) const {
+    x[0] *= inversePivot_[0];
+    for (int i = 1; i < size_; ++i) {
+        x[i] = x[i] * inversePivot_[i] - lower_[i] * x[i - 1];
+    }
+    // Remontée projetée : la zone d'exercice est traitée en premier
+    x[size_ - 1] = std::max(x[size_ - 1], obstacle[size_ - 1]);
+    for (int i = size_ - 2; i >= 0; --i) {
+        x[i] = std::max(x[i] - upper_[i] * x[i + 1], obstacle[i]);
+    }
+}
+
+int TridiagonalSolver::size() const {
+    return size_;
+}
+
+void multiplyTridiagonal(const double* lower, const double* diagonal, const double* upper, double* x, int n) {
+    if (n == 1) {
+        x[0] *= diagonal[0];
+        return;
+    }
+    // 'left' conserve l'ancienne valeur x_{i-1}, déjà écrasée
+    double left = x[0];
+    x[0] = diagonal[0] * x[0] + upper[0] * x[1];
+    for (int i = 1; i < n - 1; ++i) {
+        const double current = x[i];
+        x[i] = lower[i] * left + diagonal[i] * current + upper[i] * x[i + 1];
+        left = current;
+    }
+    x[n - 1] = lower[n - 1] * left + diagonal[n - 1] * x[n - 1];
+}